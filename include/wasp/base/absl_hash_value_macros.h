@@ -56,6 +56,12 @@
     return H::combine(std::move(h), v.f1, v.f2, v.f3, v.f4, v.f5); \
   }
 
+#define WASP_ABSL_HASH_VALUE_6(Name, f1, f2, f3, f4, f5, f6)             \
+  template <typename H>                                                  \
+  H AbslHashValue(H h, const ::wasp::Name& v) {                          \
+    return H::combine(std::move(h), v.f1, v.f2, v.f3, v.f4, v.f5, v.f6); \
+  }
+
 #define WASP_ABSL_HASH_VALUE_CONTAINER(Name)    \
   template <typename H>                         \
   H AbslHashValue(H h, const ::wasp::Name& v) { \
@@ -0,0 +1,78 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef WASP_BASE_BUFFERED_ERRORS_H_
+#define WASP_BASE_BUFFERED_ERRORS_H_
+
+#include <string>
+#include <vector>
+
+#include "wasp/base/errors.h"
+#include "wasp/base/span.h"
+#include "wasp/base/string_view.h"
+
+namespace wasp {
+
+// Records errors so they can be replayed into another Errors object later,
+// e.g. to merge errors produced on several threads in a fixed order.
+class BufferedErrors : public Errors {
+ public:
+  bool HasError() const override { return has_error_; }
+
+  void ReplayTo(Errors& errors) const {
+    for (const auto& event : events_) {
+      switch (event.kind) {
+        case Event::PushContext:
+          errors.PushContext(event.loc, event.string);
+          break;
+        case Event::PopContext:
+          errors.PopContext();
+          break;
+        case Event::Error:
+          errors.OnError(event.loc, event.string);
+          break;
+      }
+    }
+  }
+
+ protected:
+  void HandlePushContext(Location loc, string_view desc) override {
+    events_.push_back({Event::PushContext, loc, std::string{desc}});
+  }
+
+  void HandlePopContext() override {
+    events_.push_back({Event::PopContext, {}, {}});
+  }
+
+  void HandleOnError(Location loc, string_view message) override {
+    events_.push_back({Event::Error, loc, std::string{message}});
+    has_error_ = true;
+  }
+
+ private:
+  struct Event {
+    enum Kind { PushContext, PopContext, Error } kind;
+    Location loc;
+    std::string string;
+  };
+
+  std::vector<Event> events_;
+  bool has_error_ = false;
+};
+
+}  // namespace wasp
+
+#endif  // WASP_BASE_BUFFERED_ERRORS_H_
@@ -0,0 +1,53 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef WASP_BASE_CONTENT_HASH_H_
+#define WASP_BASE_CONTENT_HASH_H_
+
+#include "wasp/base/span.h"
+#include "wasp/base/types.h"
+
+namespace wasp {
+
+// A streaming 64-bit hash of a byte sequence (XXH64). Unlike absl::Hash, the
+// result is stable across processes and platforms, so it can be stored, e.g.
+// as a cache key. Splitting the input across calls to Update doesn't change
+// the result.
+class ContentHash {
+ public:
+  explicit ContentHash(u64 seed = 0);
+
+  void Update(SpanU8);
+  // Hashes `value` as 8 little-endian bytes.
+  void Update(u64 value);
+
+  u64 Digest() const;
+
+ private:
+  static constexpr size_t kStripeSize = 32;
+
+  u64 acc_[4];
+  u64 seed_;
+  u64 total_size_ = 0;
+  u8 buffer_[kStripeSize];
+  size_t buffer_size_ = 0;
+};
+
+u64 HashContent(SpanU8, u64 seed = 0);
+
+}  // namespace wasp
+
+#endif  // WASP_BASE_CONTENT_HASH_H_
@@ -17,15 +17,36 @@
 namespace wasp {
 
 inline void Errors::PushContext(Location loc, string_view desc) {
-  HandlePushContext(loc, desc);
+  if (context_count_ < kInlineContexts) {
+    contexts_[context_count_] = Context{loc, desc};
+  } else {
+    PushOverflowContext(loc, desc);
+  }
+  context_count_++;
 }
 
 inline void Errors::PopContext() {
-  HandlePopContext();
+  if (context_count_ == handled_context_count_) {
+    HandlePopContext();
+    handled_context_count_--;
+  }
+  context_count_--;
+  if (context_count_ >= kInlineContexts) {
+    overflow_contexts_.pop_back();
+  }
 }
 
 inline void Errors::OnError(Location loc, string_view message) {
+  for (; handled_context_count_ < context_count_; ++handled_context_count_) {
+    const auto& context = GetContext(handled_context_count_);
+    HandlePushContext(context.loc, context.desc);
+  }
   HandleOnError(loc, message);
 }
 
+inline auto Errors::GetContext(size_t index) const -> const Context& {
+  return index < kInlineContexts ? contexts_[index]
+                                 : overflow_contexts_[index - kInlineContexts];
+}
+
 }  // namespace wasp
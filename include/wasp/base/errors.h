@@ -17,11 +17,20 @@
 #ifndef WASP_BASE_ERRORS_H_
 #define WASP_BASE_ERRORS_H_
 
+#include <array>
+#include <vector>
+
 #include "wasp/base/span.h"
 #include "wasp/base/string_view.h"
+#include "wasp/base/types.h"
 
 namespace wasp {
 
+// Contexts are only recorded locally when pushed. They are forwarded to
+// HandlePushContext when an error is reported while they are active, so the
+// common case of reading valid input makes no virtual calls.
+//
+// The `desc` passed to PushContext must outlive the matching PopContext.
 class Errors {
  public:
   virtual ~Errors() {}
@@ -35,6 +44,25 @@ class Errors {
   virtual void HandlePushContext(Location loc, string_view desc) = 0;
   virtual void HandlePopContext() = 0;
   virtual void HandleOnError(Location loc, string_view message) = 0;
+
+ private:
+  struct Context {
+    Location loc;
+    string_view desc;
+  };
+
+  static constexpr size_t kInlineContexts = 32;
+
+  auto GetContext(size_t index) const -> const Context&;
+  void PushOverflowContext(Location loc, string_view desc);
+
+  // Contexts past kInlineContexts are stored in overflow_contexts_.
+  std::array<Context, kInlineContexts> contexts_;
+  std::vector<Context> overflow_contexts_;
+  size_t context_count_ = 0;
+  // The number of contexts, from the bottom of the stack, that have been
+  // passed to HandlePushContext.
+  size_t handled_context_count_ = 0;
 };
 
 }  // namespace wasp
@@ -28,6 +28,33 @@ namespace wasp {
 
 optional<Buffer> ReadFile(string_view filename);
 
+// A read-only view of the contents of a file. Regular files are memory-mapped
+// where the platform supports it, so no copy is made. Anything else (pipes,
+// character devices, or platforms without mmap) falls back to ReadFile.
+class MappedFile {
+ public:
+  MappedFile() = default;
+  MappedFile(const MappedFile&) = delete;
+  MappedFile(MappedFile&&);
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile& operator=(MappedFile&&);
+  ~MappedFile();
+
+  auto data() const -> SpanU8;
+  bool is_mapped() const;
+
+ private:
+  friend optional<MappedFile> MapFile(string_view filename);
+
+  void Unmap();
+
+  u8* mapped_data_ = nullptr;
+  size_t mapped_size_ = 0;
+  Buffer buffer_;
+};
+
+optional<MappedFile> MapFile(string_view filename);
+
 }  // namespace wasp
 
 #endif  // WASP_BASE_FILE_H_
@@ -61,6 +61,13 @@
   }                                                                    \
   bool operator!=(const Name& lhs, const Name& rhs) { return !(lhs == rhs); }
 
+#define WASP_OPERATOR_EQ_NE_6(Name, f1, f2, f3, f4, f5, f6)            \
+  bool operator==(const Name& lhs, const Name& rhs) {                  \
+    return lhs.f1 == rhs.f1 && lhs.f2 == rhs.f2 && lhs.f3 == rhs.f3 && \
+           lhs.f4 == rhs.f4 && lhs.f5 == rhs.f5 && lhs.f6 == rhs.f6;   \
+  }                                                                    \
+  bool operator!=(const Name& lhs, const Name& rhs) { return !(lhs == rhs); }
+
 #define WASP_OPERATOR_EQ_NE_CONTAINER(Name)                            \
   bool operator==(const Name& lhs, const Name& rhs) {                  \
     return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); \
@@ -17,6 +17,7 @@
 #include <utility>
 
 #include "wasp/base/errors_nop.h"
+#include "wasp/binary/module_index.h"
 #include "wasp/binary/name_section/sections.h"
 #include "wasp/binary/read/read_ctx.h"
 #include "wasp/binary/sections.h"
@@ -24,17 +25,19 @@
 namespace wasp::binary {
 
 template <typename F>
-void ForEachFunctionName(LazyModule& module, F&& f) {
+void ForEachFunctionName(const ModuleIndex& index,
+                         const Features& features,
+                         F&& f) {
   ErrorsNop errors;
-  LazyModule copy{module.data, module.ctx.features, errors};
+  ReadCtx ctx{features, errors};
 
   Index imported_function_count = 0;
-  for (auto section : module.sections) {
+  for (auto&& section : index.sections()) {
     if (section->is_known()) {
       auto known = section->known();
       switch (known->id) {
         case SectionId::Import:
-          for (auto import : ReadImportSection(known, copy.ctx).sequence) {
+          for (auto import : ReadImportSection(known, ctx).sequence) {
             if (import->kind() == ExternalKind::Function) {
               f(IndexNamePair{imported_function_count++, import->name});
             }
@@ -42,7 +45,7 @@ void ForEachFunctionName(LazyModule& module, F&& f) {
           break;
 
         case SectionId::Export:
-          for (auto export_ : ReadExportSection(known, copy.ctx).sequence) {
+          for (auto export_ : ReadExportSection(known, ctx).sequence) {
             if (export_->kind == ExternalKind::Function) {
               f(IndexNamePair{export_->index, export_->name});
             }
@@ -55,10 +58,10 @@ void ForEachFunctionName(LazyModule& module, F&& f) {
     } else if (section->is_custom()) {
       auto custom = section->custom();
       if (*custom->name == "name") {
-        for (auto subsection : ReadNameSection(custom, copy.ctx)) {
+        for (auto subsection : ReadNameSection(custom, ctx)) {
           if (subsection->id == NameSubsectionId::FunctionNames) {
             for (auto name_assoc :
-                 ReadFunctionNamesSubsection(*subsection, copy.ctx).sequence) {
+                 ReadFunctionNamesSubsection(*subsection, ctx).sequence) {
               f(IndexNamePair{name_assoc->index, name_assoc->name});
             }
           }
@@ -68,31 +71,28 @@ void ForEachFunctionName(LazyModule& module, F&& f) {
   }
 }
 
+template <typename F>
+void ForEachFunctionName(LazyModule& module, F&& f) {
+  ForEachFunctionName(ModuleIndex{module}, module.ctx.features,
+                      std::forward<F>(f));
+}
+
 template <typename Iterator>
-Iterator CopyFunctionNames(LazyModule& module, Iterator out) {
-  ForEachFunctionName(module,
+Iterator CopyFunctionNames(const ModuleIndex& index,
+                           const Features& features,
+                           Iterator out) {
+  ForEachFunctionName(index, features,
                       [&out](const IndexNamePair& pair) { *out++ = pair; });
   return out;
 }
 
-inline Index GetImportCount(LazyModule& module, ExternalKind kind) {
-  ErrorsNop errors;
-  LazyModule copy{module.data, module.ctx.features, errors};
+template <typename Iterator>
+Iterator CopyFunctionNames(LazyModule& module, Iterator out) {
+  return CopyFunctionNames(ModuleIndex{module}, module.ctx.features, out);
+}
 
-  Index count = 0;
-  for (auto section : copy.sections) {
-    if (section->is_known()) {
-      auto known = section->known();
-      if (known->id == SectionId::Import) {
-        for (auto import : ReadImportSection(known, copy.ctx).sequence) {
-          if (import->kind() == kind) {
-            count++;
-          }
-        }
-      }
-    }
-  }
-  return count;
+inline Index GetImportCount(LazyModule& module, ExternalKind kind) {
+  return ModuleIndex{module}.GetImportCount(kind);
 }
 
 }  // namespace wasp::binary
@@ -29,13 +29,21 @@ class Errors;
 
 namespace binary {
 
+class ModuleIndex;
 struct ReadCtx;
 
 using IndexNamePair = std::pair<Index, string_view>;
 
+// These only read the import, export and "name" sections, found through
+// the ModuleIndex. The LazyModule overloads build a ModuleIndex first, so
+// callers that need more than one of them should build it once instead.
+template <typename F>
+void ForEachFunctionName(const ModuleIndex&, const Features&, F&&);
 template <typename F>
 void ForEachFunctionName(LazyModule&, F&&);
 
+template <typename Iterator>
+Iterator CopyFunctionNames(const ModuleIndex&, const Features&, Iterator out);
 template <typename Iterator>
 Iterator CopyFunctionNames(LazyModule&, Iterator out);
 
@@ -0,0 +1,71 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef WASP_BINARY_MODULE_INDEX_H_
+#define WASP_BINARY_MODULE_INDEX_H_
+
+#include <array>
+#include <vector>
+
+#include "wasp/base/at.h"
+#include "wasp/base/optional.h"
+#include "wasp/base/span.h"
+#include "wasp/base/types.h"
+#include "wasp/binary/types.h"
+
+namespace wasp::binary {
+
+class LazyModule;
+struct ReadCtx;
+
+// Section and code entry offsets of a module, recorded in one pass so that
+// looking up a section or a single function's code doesn't require walking
+// the module again. Code entries are skipped using their length prefix; they
+// are not decoded until requested.
+class ModuleIndex {
+ public:
+  explicit ModuleIndex(const LazyModule&);
+
+  auto sections() const -> const std::vector<At<Section>>& { return sections_; }
+  auto GetKnownSection(SectionId) const -> OptAt<KnownSection>;
+  auto GetCustomSection(string_view name) const -> OptAt<CustomSection>;
+
+  Index GetImportCount(ExternalKind) const;
+  Index imported_function_count() const;
+  Index code_count() const;
+
+  // `func_index` is in the function index space, so it includes imported
+  // functions. Returns nullopt for imported or out-of-range functions.
+  auto GetCode(Index func_index, ReadCtx&) const -> OptAt<Code>;
+
+ private:
+  static constexpr size_t kExternalKindCount = 0
+#define WASP_V(val, Name, str) +1
+#define WASP_FEATURE_V(val, Name, str, feature) WASP_V(val, Name, str)
+#include "wasp/base/inc/external_kind.inc"
+#undef WASP_V
+#undef WASP_FEATURE_V
+      ;
+
+  SpanU8 data_;
+  std::vector<At<Section>> sections_;
+  std::array<Index, kExternalKindCount> import_counts_{};
+  std::vector<u32> code_offsets_;  // Relative to the start of the module.
+};
+
+}  // namespace wasp::binary
+
+#endif  // WASP_BINARY_MODULE_INDEX_H_
@@ -0,0 +1,208 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef WASP_BINARY_PACKED_EXPRESSION_H_
+#define WASP_BINARY_PACKED_EXPRESSION_H_
+
+#include <iterator>
+#include <vector>
+
+#include "wasp/base/at.h"
+#include "wasp/base/optional.h"
+#include "wasp/base/span.h"
+#include "wasp/base/types.h"
+#include "wasp/binary/types.h"
+
+namespace wasp::binary {
+
+struct ReadCtx;
+
+// A fixed-size record for one instruction. Locations are not stored; they
+// are recomputed from `offset`, `length` and the expression's data.
+//
+// br_table targets and typed select types are stored in flat side arenas of
+// the expression, and `immediate` holds their offset and count. A br_table
+// can be longer than `length` allows, so its `length` is 0 and its end is
+// found by skipping over its targets.
+//
+// Instructions whose immediates don't fit in `immediate` (e.g. let, v128
+// constants), or whose locations don't describe a contiguous run of bytes in
+// the expression's data, are stored out of line and `immediate` holds their
+// index.
+struct PackedInstruction {
+  enum class Kind : u8 {
+    OutOfLine,
+    None,
+    S32,
+    S64,
+    F32,
+    F64,
+    Index,
+    BlockTypeVoid,
+    BlockTypeIndex,
+    BlockTypeNumeric,
+    BrOnExn,
+    CallIndirect,
+    Copy,
+    Init,
+    FuncBind,
+    HeapTypeKind,
+    HeapTypeIndex,
+    MemArg,
+    SimdLane,
+    StructField,
+    BrTable,
+    Select,
+  };
+
+  u32 offset;
+  u16 opcode;
+  Kind kind;
+  u8 length;
+  u64 immediate;
+};
+
+static_assert(sizeof(PackedInstruction) == 16,
+              "PackedInstruction should be 16 bytes");
+
+// A compact alternative to UnpackedExpression for holding many function
+// bodies in memory at once. Iterating yields `const At<Instruction>&` without
+// allocating; the reference is only valid until the iterator is advanced.
+class PackedExpression {
+ public:
+  class iterator;
+
+  PackedExpression() = default;
+  explicit PackedExpression(SpanU8 data);
+
+  void Append(const At<Instruction>&);
+  void clear();
+  void reserve(size_t);
+
+  bool empty() const { return instructions_.empty(); }
+  size_t size() const { return instructions_.size(); }
+  SpanU8 data() const { return data_; }
+  span<const PackedInstruction> packed_instructions() const {
+    return instructions_;
+  }
+
+  auto begin() const -> iterator;
+  auto end() const -> iterator;
+
+  auto Unpack(const PackedInstruction&) const -> At<Instruction>;
+
+  // Accessors for the immediates stored in the side arenas, so they can be
+  // read without unpacking the instruction.
+  auto br_table_targets(const PackedInstruction&) const -> span<const Index>;
+  Index br_table_default_target(const PackedInstruction&) const;
+  auto select_types(const PackedInstruction&) const
+      -> span<const At<ValueType>>;
+
+ private:
+  friend auto FastReadPackedExpression(SpanU8, ReadCtx&) -> PackedExpression;
+
+  bool TryPack(const At<Instruction>&, PackedInstruction*);
+
+  // Like Unpack, but reuses the storage of `out`'s br_table targets or select
+  // types, if any.
+  void UnpackInto(const PackedInstruction&, At<Instruction>* out) const;
+
+  SpanU8 data_;
+  std::vector<PackedInstruction> instructions_;
+  std::vector<Index> br_table_targets_;  // Each default target follows.
+  ValueTypeList select_types_;
+  InstructionList out_of_line_;
+};
+
+class PackedExpression::iterator {
+ public:
+  using difference_type = std::ptrdiff_t;
+  using value_type = At<Instruction>;
+  using pointer = const At<Instruction>*;
+  using reference = const At<Instruction>&;
+  using iterator_category = std::input_iterator_tag;
+
+  iterator() = default;
+  // The scratch instruction is overwritten by each operator*, so it isn't
+  // copied.
+  iterator(const iterator& other) : expr_{other.expr_}, index_{other.index_} {}
+  iterator& operator=(const iterator& other) {
+    expr_ = other.expr_;
+    index_ = other.index_;
+    return *this;
+  }
+
+  reference operator*() const;
+  pointer operator->() const { return &**this; }
+
+  iterator& operator++();
+  iterator operator++(int);
+
+  friend bool operator==(const iterator& lhs, const iterator& rhs) {
+    return lhs.index_ == rhs.index_;
+  }
+  friend bool operator!=(const iterator& lhs, const iterator& rhs) {
+    return lhs.index_ != rhs.index_;
+  }
+
+ private:
+  friend class PackedExpression;
+
+  explicit iterator(const PackedExpression*, size_t index);
+
+  const PackedExpression* expr_ = nullptr;
+  size_t index_ = 0;
+  mutable At<Instruction> scratch_{Instruction{At{Opcode::Nop}}};
+};
+
+struct PackedCode {
+  LocalsList locals;
+  PackedExpression body;
+};
+
+// A Module whose function bodies are packed, see ReadPackedModule.
+// `module.codes` is always empty.
+struct PackedModule {
+  Module module;
+  std::vector<At<PackedCode>> codes;
+};
+
+// Decodes one common MVP instruction at the front of `data` into `out`,
+// updating the block state in `ctx` the same way Read<Instruction> does.
+// `out->offset` is left as 0. Returns false, without consuming anything or
+// touching `ctx`, if the instruction needs the full reader.
+bool FastReadInstruction(SpanU8* data, ReadCtx&, PackedInstruction* out);
+
+// Reads all instructions of `expr`, packing them as they are read.
+auto ReadPackedExpression(SpanU8 expr, ReadCtx&) -> PackedExpression;
+auto ReadPackedCode(const At<Code>&, ReadCtx&) -> At<PackedCode>;
+
+// Same result as ReadPackedExpression, but common MVP instructions are
+// decoded straight into PackedInstructions, without building At<> values or
+// error contexts. Any other instruction, or any instruction the fast path
+// can't decode, is re-read by Read<Instruction> with full locations, so
+// diagnostics are identical.
+auto FastReadPackedExpression(SpanU8 expr, ReadCtx&) -> PackedExpression;
+auto FastReadPackedCode(const At<Code>&, ReadCtx&) -> At<PackedCode>;
+
+// Same as ReadModule, but the function bodies are read with
+// FastReadPackedCode, so each instruction takes 16 bytes instead of a full
+// At<Instruction>. Errors are the same as ReadModule's.
+auto ReadPackedModule(SpanU8, ReadCtx&) -> optional<PackedModule>;
+
+}  // namespace wasp::binary
+
+#endif  // WASP_BINARY_PACKED_EXPRESSION_H_
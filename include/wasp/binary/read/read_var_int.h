@@ -17,9 +17,14 @@
 #ifndef WASP_BINARY_READ_READ_VAR_INT_H_
 #define WASP_BINARY_READ_READ_VAR_INT_H_
 
+#include <cstring>
 #include <type_traits>
 #include <iomanip>
 
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
 #include "wasp/base/concat.h"
 #include "wasp/base/errors_context_guard.h"
 #include "wasp/base/features.h"
@@ -44,8 +49,86 @@ S SignExtend(std::make_unsigned_t<S> x, int N) {
   return static_cast<S>(x << (kNumBits - N - 1)) >> (kNumBits - N - 1);
 }
 
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ && \
+    (defined(__GNUC__) || defined(__clang__))
+#define WASP_VAR_INT_FAST_PATH 1
+#else
+#define WASP_VAR_INT_FAST_PATH 0
+#endif
+
+// Decodes a well-formed varint that ends within the next 8 bytes using a
+// single 64-bit load. Returns nullopt without consuming anything if there are
+// fewer than 8 bytes left, or if the varint is long or malformed; the caller
+// must then use the byte-at-a-time reader, which reports any errors.
+template <typename T>
+OptAt<T> ReadVarIntFast(SpanU8* data) {
+#if WASP_VAR_INT_FAST_PATH
+  using U = std::make_unsigned_t<T>;
+  constexpr bool is_signed = std::is_signed_v<T>;
+  constexpr int kMaxBytes = VarInt<T>::kMaxBytes;
+  constexpr int kLastByteMaskBits =
+      VarInt<T>::kUsedBitsInLastByte - (is_signed ? 1 : 0);
+  constexpr u8 kLastByteMask = ~((1 << kLastByteMaskBits) - 1);
+  constexpr u8 kLastByteOnes = kLastByteMask & VarInt<T>::kByteMask;
+
+  if (data->size() < 8) {
+    return nullopt;
+  }
+
+  const u8* begin = data->data();
+  u64 word;
+  memcpy(&word, begin, sizeof(word));
+
+  // The varint ends at the first byte without the extend bit set.
+  const u64 ends = ~word & 0x8080808080808080ull;
+  if (ends == 0) {
+    return nullopt;
+  }
+  const int length = __builtin_ctzll(ends) / 8 + 1;
+  if (length > kMaxBytes) {
+    return nullopt;
+  } else if (length == kMaxBytes) {
+    const u8 byte = begin[length - 1];
+    if (!((byte & kLastByteMask) == 0 ||
+          (is_signed && (byte & kLastByteMask) == kLastByteOnes))) {
+      return nullopt;
+    }
+  }
+
+  if (length < 8) {
+    word &= (u64{1} << (length * 8)) - 1;
+  }
+#if defined(__BMI2__)
+  u64 bits = _pext_u64(word, 0x7f7f7f7f7f7f7f7full);
+#else
+  // Squeeze out the extend bits: 8x7 -> 4x14 -> 2x28 -> 1x56.
+  u64 bits = word & 0x7f7f7f7f7f7f7f7full;
+  bits = ((bits & 0x7f007f007f007f00ull) >> 1) |
+         (bits & 0x007f007f007f007full);
+  bits = ((bits & 0x3fff00003fff0000ull) >> 2) |
+         (bits & 0x00003fff00003fffull);
+  bits = ((bits & 0x0fffffff00000000ull) >> 4) |
+         (bits & 0x000000000fffffffull);
+#endif
+
+  U result = static_cast<U>(bits);
+  data->remove_prefix(length);
+  Location loc = MakeSpan(begin, begin + length);
+  if (is_signed && length < kMaxBytes) {
+    return At{loc, SignExtend<T>(result, 6 + (length - 1) * 7)};
+  }
+  return At{loc, T(result)};
+#else
+  return nullopt;
+#endif
+}
+
 template <typename T>
 OptAt<T> ReadVarInt(SpanU8* data, ReadCtx& ctx, string_view desc) {
+  if (auto result = ReadVarIntFast<T>(data)) {
+    return result;
+  }
+
   using U = std::make_unsigned_t<T>;
   constexpr bool is_signed = std::is_signed_v<T>;
   constexpr int kByteMask = VarInt<T>::kByteMask;
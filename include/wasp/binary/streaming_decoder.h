@@ -0,0 +1,214 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef WASP_BINARY_STREAMING_DECODER_H_
+#define WASP_BINARY_STREAMING_DECODER_H_
+
+#include <algorithm>
+#include <vector>
+
+#include "wasp/base/features.h"
+#include "wasp/base/optional.h"
+#include "wasp/base/span.h"
+#include "wasp/base/types.h"
+#include "wasp/binary/encoding.h"
+#include "wasp/binary/lazy_module.h"
+#include "wasp/binary/var_int.h"
+#include "wasp/binary/visitor.h"
+
+namespace wasp {
+
+class Errors;
+
+namespace binary::visit {
+
+// Drives a Visitor from a module that arrives in chunks, e.g. from a socket.
+// Each section is visited as soon as all of its bytes have been pushed, using
+// the same callbacks as Visit.
+//
+// Sections that lie entirely within one chunk are visited in place; only a
+// section that straddles a chunk boundary is copied into an internal buffer.
+// So memory use is bounded by the largest section rather than by the module.
+//
+// Locations passed to the visitor point into the pushed chunk or the internal
+// buffer, and are only valid until the section has been visited. They are
+// not offsets into one contiguous module, so an Errors implementation that
+// converts locations to module offsets (e.g. BinaryErrors) can't be used.
+template <typename Visitor>
+class StreamingDecoder {
+ public:
+  explicit StreamingDecoder(const Features&, Errors&, Visitor&);
+  StreamingDecoder(const StreamingDecoder&) = delete;
+  StreamingDecoder& operator=(const StreamingDecoder&) = delete;
+
+  // Returns Result::Fail if the visitor failed; malformed input is reported
+  // to the Errors object.
+  Result Push(SpanU8 chunk);
+
+  // Signals the end of the input. Reports a truncated module and, if
+  // BeginModule was called and succeeded, calls EndModule. Returns
+  // Result::Fail if the header was malformed.
+  Result Finish();
+
+ private:
+  enum class State { Header, Sections, Done };
+
+  static constexpr span_extent_t kHeaderSize =
+      sizeof(encoding::Magic) + sizeof(encoding::Version);
+
+  optional<span_extent_t> NextElementSize(SpanU8) const;
+  void ProcessElement(SpanU8);
+
+  Features features_;
+  Errors& errors_;
+  Visitor& visitor_;
+  State state_ = State::Header;
+  Result result_ = Result::Ok;
+  bool began_module_ = false;
+  u8 header_[kHeaderSize];
+  optional<LazyModule> module_;
+  std::vector<u8> buffer_;
+};
+
+template <typename Visitor>
+StreamingDecoder<Visitor>::StreamingDecoder(const Features& features,
+                                            Errors& errors,
+                                            Visitor& visitor)
+    : features_{features}, errors_{errors}, visitor_{visitor} {}
+
+template <typename Visitor>
+Result StreamingDecoder<Visitor>::Push(SpanU8 chunk) {
+  while (!chunk.empty() && state_ != State::Done) {
+    if (buffer_.empty()) {
+      // Visit complete elements directly from the chunk.
+      auto size = NextElementSize(chunk);
+      if (size && *size <= chunk.size()) {
+        ProcessElement(chunk.first(*size));
+        chunk.remove_prefix(*size);
+      } else {
+        buffer_.insert(buffer_.end(), chunk.begin(), chunk.end());
+        break;
+      }
+    } else {
+      // Complete the buffered element. If its size isn't known yet, the
+      // section header is incomplete, so only take one more byte.
+      auto size = NextElementSize(buffer_);
+      if (size && buffer_.size() >= *size) {
+        ProcessElement(buffer_);
+        buffer_.clear();
+        continue;
+      }
+      auto count = size ? std::min(*size - buffer_.size(), chunk.size()) : 1;
+      buffer_.insert(buffer_.end(), chunk.begin(), chunk.begin() + count);
+      chunk.remove_prefix(count);
+    }
+  }
+
+  if (state_ != State::Done && !buffer_.empty()) {
+    auto size = NextElementSize(buffer_);
+    if (size && buffer_.size() >= *size) {
+      ProcessElement(buffer_);
+      buffer_.clear();
+    }
+  }
+  return result_ == Result::Fail ? Result::Fail : Result::Ok;
+}
+
+template <typename Visitor>
+Result StreamingDecoder<Visitor>::Finish() {
+  if (state_ == State::Header) {
+    // Let LazyModule report the truncated header.
+    module_.emplace(SpanU8{buffer_}, features_, errors_);
+    return Result::Fail;
+  }
+
+  if (state_ == State::Sections && !buffer_.empty()) {
+    // The input ended partway through a section; reading it reports the same
+    // error that ReadLazyModule would.
+    SpanU8 rest{buffer_};
+    Read<Section>(&rest, module_->ctx);
+    buffer_.clear();
+  }
+  state_ = State::Done;
+
+  if (!began_module_) {
+    // The header was malformed, so there is no module to end.
+    return Result::Fail;
+  }
+  if (result_ != Result::Ok) {
+    return result_;
+  }
+  EndModule(SpanU8{}, module_->ctx);
+  return visitor_.EndModule(*module_);
+}
+
+template <typename Visitor>
+auto StreamingDecoder<Visitor>::NextElementSize(SpanU8 data) const
+    -> optional<span_extent_t> {
+  if (state_ == State::Header) {
+    return kHeaderSize;
+  }
+
+  // Section id, followed by the LEB128 encoded section length.
+  constexpr span_extent_t kMaxHeaderSize = 1 + VarInt<u32>::kMaxBytes;
+  u32 length = 0;
+  int shift = 0;
+  for (span_extent_t i = 1; i < std::min(data.size(), kMaxHeaderSize); ++i) {
+    length |= static_cast<u32>(data[i] & VarInt<u32>::kByteMask) << shift;
+    shift += VarInt<u32>::kBitsPerByte;
+    if ((data[i] & VarInt<u32>::kExtendBit) == 0) {
+      return i + 1 + length;
+    }
+  }
+
+  if (data.size() >= kMaxHeaderSize) {
+    // The length is malformed; Read<Section> reports it.
+    return data.size();
+  }
+  return nullopt;
+}
+
+template <typename Visitor>
+void StreamingDecoder<Visitor>::ProcessElement(SpanU8 data) {
+  if (state_ == State::Header) {
+    std::copy(data.begin(), data.end(), header_);
+    module_.emplace(SpanU8{header_}, features_, errors_);
+    if (!module_->magic || !module_->version) {
+      state_ = State::Done;
+      return;
+    }
+    result_ = visitor_.BeginModule(*module_);
+    began_module_ = true;
+    state_ = result_ == Result::Ok ? State::Sections : State::Done;
+    return;
+  }
+
+  auto section = Read<Section>(&data, module_->ctx);
+  if (!section) {
+    // Same as ReadLazyModule; no further sections are read after an error.
+    state_ = State::Done;
+    return;
+  }
+  if (VisitSection(*module_, *section, visitor_) == Result::Fail) {
+    result_ = Result::Fail;
+    state_ = State::Done;
+  }
+}
+
+}  // namespace binary::visit
+}  // namespace wasp
+
+#endif  // WASP_BINARY_STREAMING_DECODER_H_
@@ -17,6 +17,8 @@
 #ifndef WASP_TEXT_READ_LEX_H_
 #define WASP_TEXT_READ_LEX_H_
 
+#include <vector>
+
 #include "wasp/base/span.h"
 #include "wasp/text/read/token.h"
 
@@ -25,6 +27,11 @@ namespace wasp::text {
 auto Lex(SpanU8* data) -> Token;
 auto LexNoWhitespace(SpanU8* data) -> Token;
 
+// Splits `data` into its top-level parenthesized groups (e.g. the fields of a
+// module) without lexing the tokens in them. Stops at the first token that
+// isn't whitespace, a comment or `(`, or at the first group that isn't closed.
+auto SplitParenGroups(SpanU8 data) -> std::vector<SpanU8>;
+
 }  // namespace wasp::text
 
 #endif  // WASP_TEXT_READ_LEX_H_
@@ -17,11 +17,17 @@
 #ifndef WASP_TEXT_READ_NAME_MAP_H_
 #define WASP_TEXT_READ_NAME_MAP_H_
 
+#include <vector>
+
+#include "wasp/base/hashmap.h"
 #include "wasp/base/string_view.h"
 #include "wasp/text/types.h"
 
 namespace wasp::text {
 
+// Names are bound in scopes, which are pushed and popped for labels and let
+// locals. A name can be bound again in an inner scope, shadowing the outer
+// binding until the inner scope is popped.
 class NameMap {
  public:
   explicit NameMap();
@@ -39,10 +45,19 @@ class NameMap {
   auto Size() const -> Index;
 
  private:
-  optional<size_t> FindInRange(size_t begin, size_t end, BindVar) const;
+  static constexpr size_t kNone = ~size_t{0};
+
+  struct Entry {
+    optional<BindVar> name;
+    size_t shadowed;  // The previous entry with the same name, or kNone.
+  };
+
+  optional<size_t> Find(BindVar) const;
 
-  std::vector<optional<BindVar>> names_;
+  std::vector<Entry> names_;
   std::vector<size_t> stack_;
+  // The innermost entry for each bound name.
+  flat_hash_map<BindVar, size_t> index_;
 };
 
 }  // namespace wasp::text
@@ -18,6 +18,7 @@
 #define WASP_TEXT_READ_CONTEXT_H_
 
 #include "wasp/base/features.h"
+#include "wasp/base/types.h"
 
 namespace wasp {
 
@@ -34,6 +35,11 @@ struct ReadCtx {
   Features features;
   Errors& errors;
 
+  // If greater than 1, ReadModule splits the module into its fields up front
+  // and reads them on this many threads. The result and the errors are the
+  // same as reading them in order.
+  Index thread_count = 1;
+
   bool seen_non_import = false;
   bool seen_start = false;
 };
@@ -77,4 +77,16 @@ inline auto Tokenizer::MatchLpar(TokenType token_type) -> optional<Token> {
   return Read();
 }
 
+inline auto Tokenizer::Remaining() -> SpanU8 {
+  return MakeSpan(Peek().loc.begin(), data_.end());
+}
+
+inline void Tokenizer::Seek(const u8* pos, Token previous) {
+  assert(pos >= Peek().loc.begin() && pos <= data_.end());
+  data_ = MakeSpan(pos, data_.end());
+  current_ = 0;
+  count_ = 0;
+  previous_token_ = previous;
+}
+
 }  // namespace wasp::text
@@ -38,6 +38,13 @@ class Tokenizer {
   auto Match(TokenType) -> optional<Token>;
   auto MatchLpar(TokenType) -> optional<Token>;
 
+  // The data that hasn't been read yet, starting at the next token.
+  auto Remaining() -> SpanU8;
+
+  // Continues reading at `pos`, which must be at the start of a token in
+  // Remaining(). `previous` is the token before it, as returned by Previous().
+  void Seek(const u8* pos, Token previous);
+
  private:
   SpanU8 data_;
   int current_ = 0;
@@ -0,0 +1,72 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef WASP_VALID_INDEX_BIT_SET_H_
+#define WASP_VALID_INDEX_BIT_SET_H_
+
+#include <vector>
+
+#include "wasp/base/types.h"
+
+namespace wasp::valid {
+
+// A set of indexes stored as one bit per index, for indexes into a dense
+// index space such as the function index space. The storage grows to fit the
+// largest index inserted, so only valid indexes should be inserted.
+class IndexBitSet {
+ public:
+  void reserve(Index size) { words_.reserve(WordCount(size)); }
+
+  void insert(Index index) {
+    size_t word = index / kBitsPerWord;
+    if (word >= words_.size()) {
+      words_.resize(word + 1);
+    }
+    u64 bit = u64{1} << (index % kBitsPerWord);
+    if ((words_[word] & bit) == 0) {
+      words_[word] |= bit;
+      ++size_;
+    }
+  }
+
+  auto count(Index index) const -> size_t {
+    size_t word = index / kBitsPerWord;
+    return word < words_.size() &&
+           (words_[word] >> (index % kBitsPerWord)) & 1;
+  }
+
+  auto size() const -> size_t { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  void clear() {
+    words_.clear();
+    size_ = 0;
+  }
+
+ private:
+  static constexpr Index kBitsPerWord = 64;
+
+  static size_t WordCount(Index size) {
+    return (size_t{size} + kBitsPerWord - 1) / kBitsPerWord;
+  }
+
+  std::vector<u64> words_;
+  size_t size_ = 0;
+};
+
+}  // namespace wasp::valid
+
+#endif  // WASP_VALID_INDEX_BIT_SET_H_
@@ -22,17 +22,23 @@
 
 #include "wasp/base/optional.h"
 #include "wasp/binary/types.h"
+#include "wasp/valid/types.h"
 
 namespace wasp::valid {
 
 class LocalMap {
  public:
-  explicit LocalMap();
+  // Functions with at most this many locals also keep a dense array with the
+  // StackType of each local, so GetStackType is a single load.
+  static constexpr Index kDefaultDenseLimit = 65536;
+
+  explicit LocalMap(Index dense_limit = kDefaultDenseLimit);
 
   void Reset();
 
   auto GetCount() const -> Index;
   auto GetType(Index) const -> optional<binary::ValueType>;
+  auto GetStackType(Index) const -> optional<StackType>;
   bool Append(Index count, binary::ValueType);
   bool Append(const binary::ValueTypeList&);
 
@@ -58,6 +64,7 @@ class LocalMap {
 
   bool CanAppend(Index count) const;
   void AdjustPartialSums(Pairs::iterator first, Index count);
+  void InsertDense(Index at, Index count, binary::ValueType);
 
   // Index is a partial sum, so the vector can be binary-searched, e.g.
   //
@@ -73,6 +80,13 @@ class LocalMap {
   // vector will never be empty; there is an implicit "let" block for the
   // function itself.
   std::vector<Index> let_stack_;
+
+  // The type of each local, in order, while GetCount() <= dense_limit_. Once
+  // a function has more locals, only `pairs_` is used until the next Reset.
+  // The buffer is reused across functions.
+  std::vector<StackType> dense_;
+  bool use_dense_ = true;
+  Index dense_limit_;
 };
 
 }  // namespace wasp::valid
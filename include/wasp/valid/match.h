@@ -17,6 +17,8 @@
 #ifndef WASP_VALID_MATCH_H_
 #define WASP_VALID_MATCH_H_
 
+#include <vector>
+
 #include "wasp/base/types.h"
 #include "wasp/valid/types.h"
 
@@ -104,6 +106,13 @@ bool IsMatch(ValidCtx& ctx,
              const binary::DefinedType& expected,
              const binary::DefinedType& actual);
 
+// Partitions `types` into classes of types that are the same according to
+// IsSame, and returns the class of each type. Types are first bucketed by
+// their structure with type indexes erased, then the buckets are refined
+// until the types in each one refer to types in the same buckets.
+auto ComputeTypeClasses(const std::vector<binary::DefinedType>&)
+    -> std::vector<Index>;
+
 }  // namespace wasp::valid
 
 #endif  // WASP_VALID_MATCH_H_
@@ -28,10 +28,23 @@ namespace wasp::valid {
 
 struct Any {};
 
+// A location-free encoding of a value type, or "any". Stack types are pushed
+// and popped for every operand of every instruction, so they are stored as a
+// small, trivially copyable value rather than as a binary::ValueType, which
+// is a tree of variants with locations. Use value_type() to convert back.
 struct StackType {
+  enum class Kind : u8 {
+    Any,
+    NumericType,    // `code` is a NumericType.
+    ReferenceKind,  // `code` is a ReferenceKind.
+    Ref,            // `code` is a HeapKind, or `index` is a type index.
+    Rtt,            // Same as Ref, and `depth` is the rtt depth.
+  };
+
   explicit StackType();
   explicit StackType(binary::ValueType);
   explicit StackType(Any);
+  explicit StackType(NumericType);
 
   static StackType I32();
   static StackType I64();
@@ -45,13 +58,19 @@ struct StackType {
   static StackType I31ref();
   static StackType Exnref();
 
-  bool is_value_type() const;
-  bool is_any() const;
+  bool is_value_type() const { return kind != Kind::Any; }
+  bool is_any() const { return kind == Kind::Any; }
+  bool is_numeric_type() const { return kind == Kind::NumericType; }
 
-  auto value_type() -> binary::ValueType&;
-  auto value_type() const -> const binary::ValueType&;
+  // Returns the value type without locations. Must not be called for "any".
+  auto value_type() const -> binary::ValueType;
 
-  variant<binary::ValueType, Any> type;
+  Kind kind;
+  u8 code;
+  bool nullable;
+  bool has_index;
+  Index index;
+  Index depth;
 };
 
 using StackTypeList = std::vector<StackType>;
@@ -89,7 +108,7 @@ auto AsNonNullableType(StackType) -> StackType;
 
 #define WASP_VALID_STRUCTS_CUSTOM_FORMAT(WASP_V) \
   WASP_V(valid::Any, 0)            \
-  WASP_V(valid::StackType, 1, type)
+  WASP_V(valid::StackType, 6, kind, code, nullable, has_index, index, depth)
 
 #define WASP_VALID_CONTAINERS(WASP_V) \
   WASP_V(valid::StackTypeList)        \
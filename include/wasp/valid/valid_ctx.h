@@ -18,16 +18,17 @@
 #define WASP_VALID_CONTEXT_H_
 
 #include <map>
-#include <set>
 #include <vector>
 
 #include "wasp/base/errors.h"
 #include "wasp/base/features.h"
+#include "wasp/base/hashmap.h"
 #include "wasp/base/span.h"
 #include "wasp/base/string_view.h"
 #include "wasp/base/types.h"
 #include "wasp/binary/types.h"
 #include "wasp/valid/disjoint_set.h"
+#include "wasp/valid/index_bit_set.h"
 #include "wasp/valid/local_map.h"
 #include "wasp/valid/types.h"
 
@@ -44,19 +45,22 @@ enum class LabelType {
   Let,
 };
 
+// A label's param types and result types are stored contiguously in
+// ValidCtx::label_types, starting at `types_begin`. Labels are pushed and
+// popped in stack order, so their types are too, and pushing a label doesn't
+// allocate once label_types has grown to fit the deepest nesting. Use
+// ValidCtx::GetParamTypes() etc. to access them.
 struct Label {
   Label(LabelType,
-        StackTypeSpan param_types,
-        StackTypeSpan result_types,
+        Index types_begin,
+        Index param_count,
+        Index result_count,
         Index type_stack_limit);
 
-  const StackTypeList& br_types() const {
-    return label_type == LabelType::Loop ? param_types : result_types;
-  }
-
   LabelType label_type;
-  StackTypeList param_types;
-  StackTypeList result_types;
+  Index types_begin;
+  Index param_count;
+  Index result_count;
   Index type_stack_limit;
   bool unreachable;
 };
@@ -65,6 +69,12 @@ class SameTypes {
  public:
   void Reset(Index);
 
+  // Merges the types in each equivalence class, as computed by
+  // ComputeTypeClasses. After this, Get() is an exact answer for any two of
+  // these types, and no assumptions are needed.
+  void SetClasses(const std::vector<Index>& type_classes);
+  bool IsSameClass(Index, Index);
+
   auto Get(Index, Index) -> optional<bool>;
   void Assume(Index, Index);
   void Resolve(Index, Index, bool);
@@ -73,6 +83,7 @@ class SameTypes {
   void MaybeSwapIndexes(Index&, Index&);
 
   DisjointSet disjoint_set_;
+  Index classified_count_ = 0;
   std::map<std::pair<Index, Index>, bool> assume_;
 };
 
@@ -85,7 +96,7 @@ class MatchTypes {
   void Resolve(Index, Index, bool);
 
  private:
-  std::map<std::pair<Index, Index>, bool> assume_;
+  flat_hash_map<std::pair<Index, Index>, bool> assume_;
   Index num_types_ = 0;
 };
 
@@ -96,6 +107,19 @@ struct ValidCtx {
 
   void Reset();
 
+  // Appends the types to label_types, and pushes a label that uses them.
+  void PushLabel(LabelType,
+                 const binary::ValueTypeList& param_types,
+                 const binary::ValueTypeList& result_types,
+                 Index type_stack_limit);
+  // Pops the top label, and removes its types from label_types.
+  void PopLabel();
+  void ClearLabels();
+
+  auto GetParamTypes(const Label&) const -> StackTypeSpan;
+  auto GetResultTypes(const Label&) const -> StackTypeSpan;
+  auto GetBrTypes(const Label&) const -> StackTypeSpan;
+
   bool IsStackPolymorphic() const;
   bool IsFunctionType(Index) const;
   bool IsStructType(Index) const;
@@ -119,8 +143,9 @@ struct ValidCtx {
   LocalMap locals;
   StackTypeList type_stack;
   std::vector<Label> label_stack;
-  std::set<string_view> export_names;
-  std::set<Index> declared_functions;
+  StackTypeList label_types;
+  flat_hash_set<string_view> export_names;
+  IndexBitSet declared_functions;
 
   SameTypes same_types;
   MatchTypes match_types;
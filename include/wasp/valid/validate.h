@@ -18,6 +18,7 @@
 #define WASP_VALID_VALIDATE_H_
 
 #include "wasp/base/types.h"
+#include "wasp/binary/packed_expression.h"
 #include "wasp/valid/types.h"
 
 namespace wasp::valid {
@@ -27,7 +28,14 @@ enum class RequireDefaultable {
   Yes,
 };
 
+enum class ExpressionResult {
+  Valid,
+  Invalid,    // An instruction is invalid.
+  ReadError,  // The expression could not be read, but is valid up to there.
+};
+
 struct ValidCtx;
+struct ValidationSnapshot;
 
 bool BeginTypeSection(ValidCtx&, Index type_count);
 bool EndTypeSection(ValidCtx&);
@@ -102,8 +110,26 @@ bool Validate(ValidCtx&,
 bool Validate(ValidCtx&, const binary::ValueTypeList&);
 bool Validate(ValidCtx&, const At<binary::UnpackedCode>&);
 bool Validate(ValidCtx&, const At<binary::UnpackedExpression>&);
+bool Validate(ValidCtx&, const At<binary::PackedCode>&);
+bool Validate(ValidCtx&, const binary::PackedExpression&);
+
+// Reads and validates the function body `expr` in one pass, without building
+// a binary::Instruction for the common instructions. Reports the same errors
+// as validating each instruction of binary::ReadExpression(expr, read_ctx),
+// followed by binary::EndCode. Read errors are reported to `read_ctx`, and
+// stop the body early, but (like binary::visit::Visit) don't stop validation
+// of the bodies that follow.
+auto ReadAndValidateExpression(ValidCtx&,
+                                binary::ReadCtx& read_ctx,
+                                SpanU8 expr) -> ExpressionResult;
 
 bool Validate(ValidCtx&, const binary::Module&);
+bool Validate(ValidCtx&, const binary::PackedModule&);
+
+// Same as above, but function bodies that are unchanged since `snapshot` was
+// taken are not validated again. `snapshot` is replaced with the result of
+// this validation; pass an empty snapshot to validate the whole module.
+bool Validate(ValidCtx&, const binary::Module&, ValidationSnapshot& snapshot);
 
 }  // namespace wasp::valid
 
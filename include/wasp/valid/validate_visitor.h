@@ -17,9 +17,13 @@
 #ifndef WASP_VALID_VALIDATE_VISITOR_H_
 #define WASP_VALID_VALIDATE_VISITOR_H_
 
+#include <vector>
+
+#include "wasp/base/optional.h"
 #include "wasp/binary/visitor.h"
 #include "wasp/valid/valid_ctx.h"
 #include "wasp/valid/validate.h"
+#include "wasp/valid/validation_snapshot.h"
 
 namespace wasp {
 
@@ -30,8 +34,19 @@ namespace valid {
 struct ValidateVisitor : binary::visit::Visitor {
   using Result = binary::visit::Result;
 
-  explicit ValidateVisitor(Features features, Errors& errors);
+  // If `thread_count` is greater than 1, the function bodies are collected
+  // and validated in parallel at the end of the code section. Errors are
+  // reported in the same order as for serial validation.
+  //
+  // If `snapshot` is non-null, function bodies that are unchanged since it was
+  // taken are skipped, and it is replaced with the result of this validation;
+  // see ValidationSnapshot.
+  explicit ValidateVisitor(Features features,
+                           Errors& errors,
+                           Index thread_count = 1,
+                           ValidationSnapshot* snapshot = nullptr);
 
+  auto BeginModule(const binary::LazyModule&) -> Result;
   auto BeginTypeSection(binary::LazyTypeSection) -> Result;
   auto OnType(const At<binary::DefinedType>&) -> Result;
   auto EndTypeSection(binary::LazyTypeSection) -> Result;
@@ -41,19 +56,36 @@ struct ValidateVisitor : binary::visit::Visitor {
   auto OnMemory(const At<binary::Memory>&) -> Result;
   auto OnGlobal(const At<binary::Global>&) -> Result;
   auto OnEvent(const At<binary::Event>&) -> Result;
+  auto BeginExportSection(binary::LazyExportSection) -> Result;
   auto OnExport(const At<binary::Export>&) -> Result;
   auto OnStart(const At<binary::Start>&) -> Result;
   auto OnElement(const At<binary::ElementSegment>&) -> Result;
   auto OnDataCount(const At<binary::DataCount>&) -> Result;
+  auto BeginCodeSection(binary::LazyCodeSection) -> Result;
   auto BeginCode(const At<binary::Code>&) -> Result;
   auto OnInstruction(const At<binary::Instruction>&) -> Result;
+  auto EndCode(const At<binary::Code>&) -> Result;
+  auto EndCodeSection(binary::LazyCodeSection) -> Result;
   auto OnData(const At<binary::DataSegment>&) -> Result;
 
+  template <typename T>
+  auto ValidateContextItem(binary::SectionId, const At<T>&) -> Result;
   auto FailUnless(bool) -> Result;
+  bool ValidateCodesInParallel();
 
   ValidCtx ctx;
   Features features;
   Errors& errors;
+  Index thread_count;
+  std::vector<At<binary::Code>> codes;
+  std::vector<char> skip_codes;
+  ValidationSnapshot* snapshot;
+  optional<ValidationSnapshotBuilder> snapshot_builder;
+
+  // If true, each function body is read and validated in a single pass with
+  // ReadAndValidateExpression, and OnInstruction is not called. The same
+  // errors are reported either way.
+  bool fused = false;
 };
 
 }  // namespace valid
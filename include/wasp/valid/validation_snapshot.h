@@ -0,0 +1,82 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef WASP_VALID_VALIDATION_SNAPSHOT_H_
+#define WASP_VALID_VALIDATION_SNAPSHOT_H_
+
+#include <vector>
+
+#include "wasp/base/content_hash.h"
+#include "wasp/base/features.h"
+#include "wasp/base/optional.h"
+#include "wasp/base/span.h"
+#include "wasp/base/types.h"
+#include "wasp/binary/types.h"
+
+namespace wasp::valid {
+
+// The result of a previous validation, used to avoid re-validating function
+// bodies that haven't changed.
+//
+// A function body is only validated against the module-level items that
+// precede the code section (types, imports, functions, tables, ...). Those
+// are hashed together with the enabled features into `context_hash`; if that
+// hash differs, every body is validated again. Otherwise a body is skipped if
+// its bytes hash to the same value as the body at the same index did last
+// time, and that body was valid.
+//
+// The hashes are computed from the module bytes, via the locations of the
+// items. If any module-level item has no location (e.g. it was constructed
+// in memory) there is no context hash, and nothing is skipped.
+struct ValidationSnapshot {
+  struct Code {
+    u64 hash;
+    bool valid;
+  };
+
+  optional<u64> context_hash;
+  bool context_valid = false;
+  std::vector<Code> codes;
+};
+
+// Builds a new ValidationSnapshot while a module is validated. The previous
+// contents of `snapshot` are moved out when constructed, and the new result
+// is written to it as validation proceeds, so if validation stops early the
+// snapshot covers the functions validated so far.
+class ValidationSnapshotBuilder {
+ public:
+  explicit ValidationSnapshotBuilder(const Features&, ValidationSnapshot&);
+
+  void OnContextItem(binary::SectionId, Location);
+  void EndContext(bool valid);
+
+  // Records the body of function `code_index`, i.e. the next function body.
+  // Returns true if it is unchanged since the previous snapshot and doesn't
+  // need to be validated.
+  bool BeginCode(Index code_index, Location);
+  void EndCode(Index code_index, bool valid);
+
+ private:
+  ValidationSnapshot previous_;
+  ValidationSnapshot& snapshot_;
+  ContentHash context_hash_;
+  bool has_context_hash_ = true;
+  bool reuse_codes_ = false;
+};
+
+}  // namespace wasp::valid
+
+#endif  // WASP_VALID_VALIDATION_SNAPSHOT_H_
@@ -0,0 +1,158 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "wasp/base/content_hash.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace wasp {
+
+namespace {
+
+constexpr u64 kPrime1 = 11400714785074694791ull;
+constexpr u64 kPrime2 = 14029467366897019727ull;
+constexpr u64 kPrime3 = 1609587929392839161ull;
+constexpr u64 kPrime4 = 9650029242287828579ull;
+constexpr u64 kPrime5 = 2870177450012600261ull;
+
+inline u64 RotateLeft(u64 x, int n) {
+  return (x << n) | (x >> (64 - n));
+}
+
+inline u64 ReadU64(const u8* p) {
+  u64 result;
+  memcpy(&result, p, sizeof(result));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  result = __builtin_bswap64(result);
+#endif
+  return result;
+}
+
+inline u64 ReadU32(const u8* p) {
+  u32 result;
+  memcpy(&result, p, sizeof(result));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  result = __builtin_bswap32(result);
+#endif
+  return result;
+}
+
+inline u64 Round(u64 acc, u64 input) {
+  acc += input * kPrime2;
+  acc = RotateLeft(acc, 31);
+  return acc * kPrime1;
+}
+
+inline u64 MergeRound(u64 acc, u64 value) {
+  acc ^= Round(0, value);
+  return acc * kPrime1 + kPrime4;
+}
+
+inline void ConsumeStripe(u64* acc, const u8* p) {
+  acc[0] = Round(acc[0], ReadU64(p));
+  acc[1] = Round(acc[1], ReadU64(p + 8));
+  acc[2] = Round(acc[2], ReadU64(p + 16));
+  acc[3] = Round(acc[3], ReadU64(p + 24));
+}
+
+}  // namespace
+
+ContentHash::ContentHash(u64 seed)
+    : acc_{seed + kPrime1 + kPrime2, seed + kPrime2, seed, seed - kPrime1},
+      seed_{seed} {}
+
+void ContentHash::Update(SpanU8 data) {
+  const u8* p = data.data();
+  size_t size = data.size();
+  total_size_ += size;
+
+  if (buffer_size_ > 0) {
+    size_t count = std::min(kStripeSize - buffer_size_, size);
+    memcpy(buffer_ + buffer_size_, p, count);
+    buffer_size_ += count;
+    p += count;
+    size -= count;
+    if (buffer_size_ < kStripeSize) {
+      return;
+    }
+    ConsumeStripe(acc_, buffer_);
+    buffer_size_ = 0;
+  }
+
+  for (; size >= kStripeSize; p += kStripeSize, size -= kStripeSize) {
+    ConsumeStripe(acc_, p);
+  }
+
+  if (size > 0) {
+    memcpy(buffer_, p, size);
+    buffer_size_ = size;
+  }
+}
+
+void ContentHash::Update(u64 value) {
+  u8 bytes[8];
+  for (int i = 0; i < 8; ++i) {
+    bytes[i] = static_cast<u8>(value >> (i * 8));
+  }
+  Update(SpanU8{bytes, 8});
+}
+
+u64 ContentHash::Digest() const {
+  u64 h;
+  if (total_size_ >= kStripeSize) {
+    h = RotateLeft(acc_[0], 1) + RotateLeft(acc_[1], 7) +
+        RotateLeft(acc_[2], 12) + RotateLeft(acc_[3], 18);
+    for (auto acc : acc_) {
+      h = MergeRound(h, acc);
+    }
+  } else {
+    h = seed_ + kPrime5;
+  }
+  h += total_size_;
+
+  const u8* p = buffer_;
+  size_t size = buffer_size_;
+  for (; size >= 8; p += 8, size -= 8) {
+    h ^= Round(0, ReadU64(p));
+    h = RotateLeft(h, 27) * kPrime1 + kPrime4;
+  }
+  if (size >= 4) {
+    h ^= ReadU32(p) * kPrime1;
+    h = RotateLeft(h, 23) * kPrime2 + kPrime3;
+    p += 4;
+    size -= 4;
+  }
+  for (; size > 0; ++p, --size) {
+    h ^= *p * kPrime5;
+    h = RotateLeft(h, 11) * kPrime1;
+  }
+
+  h ^= h >> 33;
+  h *= kPrime2;
+  h ^= h >> 29;
+  h *= kPrime3;
+  h ^= h >> 32;
+  return h;
+}
+
+u64 HashContent(SpanU8 data, u64 seed) {
+  ContentHash hash{seed};
+  hash.Update(data);
+  return hash.Digest();
+}
+
+}  // namespace wasp
@@ -17,7 +17,19 @@
 #include "wasp/base/file.h"
 
 #include <fstream>
+#include <iterator>
 #include <string>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define WASP_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define WASP_HAS_MMAP 0
+#endif
 
 namespace wasp {
 
@@ -29,9 +41,21 @@ optional<Buffer> ReadFile(string_view filename) {
 
   Buffer buffer;
   stream.seekg(0, std::ios::end);
-  buffer.resize(stream.tellg());
+  auto size = stream.tellg();
+  if (size < 0) {
+    // Not seekable (e.g. a pipe); read until EOF instead.
+    stream.clear();
+    buffer.assign(std::istreambuf_iterator<char>{stream},
+                  std::istreambuf_iterator<char>{});
+    if (stream.bad()) {
+      return nullopt;
+    }
+    return buffer;
+  }
+
+  buffer.resize(size);
   stream.seekg(0, std::ios::beg);
-  stream.read(reinterpret_cast<char*>(&buffer[0]), buffer.size());
+  stream.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
   if (stream.fail()) {
     return nullopt;
   }
@@ -39,4 +63,78 @@ optional<Buffer> ReadFile(string_view filename) {
   return buffer;
 }
 
+MappedFile::MappedFile(MappedFile&& other)
+    : mapped_data_{std::exchange(other.mapped_data_, nullptr)},
+      mapped_size_{std::exchange(other.mapped_size_, 0)},
+      buffer_{std::move(other.buffer_)} {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) {
+  if (this != &other) {
+    Unmap();
+    mapped_data_ = std::exchange(other.mapped_data_, nullptr);
+    mapped_size_ = std::exchange(other.mapped_size_, 0);
+    buffer_ = std::move(other.buffer_);
+  }
+  return *this;
+}
+
+MappedFile::~MappedFile() {
+  Unmap();
+}
+
+auto MappedFile::data() const -> SpanU8 {
+  if (mapped_data_) {
+    return SpanU8{mapped_data_, mapped_size_};
+  }
+  return SpanU8{buffer_};
+}
+
+bool MappedFile::is_mapped() const {
+  return mapped_data_ != nullptr;
+}
+
+void MappedFile::Unmap() {
+#if WASP_HAS_MMAP
+  if (mapped_data_) {
+    munmap(mapped_data_, mapped_size_);
+  }
+#endif
+  mapped_data_ = nullptr;
+  mapped_size_ = 0;
+}
+
+optional<MappedFile> MapFile(string_view filename) {
+  MappedFile result;
+#if WASP_HAS_MMAP
+  int fd = open(std::string{filename}.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return nullopt;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+    size_t size = st.st_size;
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr != MAP_FAILED) {
+      // The readers walk the module front to back, so ask the kernel to read
+      // ahead aggressively.
+      madvise(addr, size, MADV_SEQUENTIAL);
+      madvise(addr, size, MADV_WILLNEED);
+      close(fd);
+      result.mapped_data_ = static_cast<u8*>(addr);
+      result.mapped_size_ = size;
+      return result;
+    }
+  }
+  close(fd);
+#endif
+
+  auto optbuf = ReadFile(filename);
+  if (!optbuf) {
+    return nullopt;
+  }
+  result.buffer_ = std::move(*optbuf);
+  return result;
+}
+
 }  // namespace wasp
@@ -16,6 +16,7 @@
 
 #include "wasp/binary/encoding.h"
 
+#include <array>
 #include <cassert>
 
 #include "wasp/base/features.h"
@@ -254,28 +255,6 @@ optional<::wasp::Null> Null::Decode(u8 val) {
   }
 }
 
-// static
-bool Opcode::IsPrefixByte(u8 code, const Features& features) {
-  switch (code) {
-    case GcPrefix:
-      return features.gc_enabled();
-
-    case MiscPrefix:
-      return features.saturating_float_to_int_enabled() ||
-             features.bulk_memory_enabled() ||
-             features.reference_types_enabled();
-
-    case SimdPrefix:
-      return features.simd_enabled();
-
-    case ThreadsPrefix:
-      return features.threads_enabled();
-
-    default:
-      return false;
-  }
-}
-
 // static
 EncodedOpcode Opcode::Encode(::wasp::Opcode decoded) {
   switch (decoded) {
@@ -296,56 +275,141 @@ EncodedOpcode Opcode::Encode(::wasp::Opcode decoded) {
   }
 }
 
-// static
-optional<::wasp::Opcode> Opcode::Decode(u8 code, const Features& features) {
-  switch (code) {
+namespace {
+
+// The feature bits required by each opcode, named by the lowercase feature
+// variable used in opcode.inc.
+namespace feature_bits {
+#define WASP_V(enum_, variable, flag, default_) \
+  constexpr Features::Bits variable = Features::enum_;
+#include "wasp/base/features.inc"
+#undef WASP_V
+}  // namespace feature_bits
+
+// One entry of an opcode decoding table. All bits of `features` must be
+// enabled for an opcode to decode. A prefix byte is valid if any bit of
+// `features` is enabled, since e.g. 0xfc is shared by several proposals.
+struct OpcodeTableEntry {
+  enum class Kind : u8 { Invalid, Opcode, Prefix };
+
+  Kind kind;
+  ::wasp::Opcode opcode;
+  Features::Bits features;
+};
+
+bool HasFeatureBits(const Features& features, Features::Bits bits) {
+  return (features.bits() & bits) == bits;
+}
+
+constexpr auto MakeOpcodeTable() -> std::array<OpcodeTableEntry, 256> {
+  using Kind = OpcodeTableEntry::Kind;
+  std::array<OpcodeTableEntry, 256> table{};
 #define WASP_V(prefix, code, Name, str) \
-  case code:                            \
-    return ::wasp::Opcode::Name;
+  table[code] = {Kind::Opcode, ::wasp::Opcode::Name, 0};
 #define WASP_FEATURE_V(prefix, code, Name, str, feature) \
-  case code:                                             \
-    if (features.feature##_enabled()) {                  \
-      return ::wasp::Opcode::Name;                       \
-    }                                                    \
-    break;
-#define WASP_PREFIX_V(...) /* Invalid. */
+  table[code] = {Kind::Opcode, ::wasp::Opcode::Name, feature_bits::feature};
+#define WASP_PREFIX_V(prefix, code, Name, str, feature) \
+  table[prefix].kind = Kind::Prefix;                    \
+  table[prefix].features |= feature_bits::feature;
 #include "wasp/base/inc/opcode.inc"
 #undef WASP_V
 #undef WASP_FEATURE_V
 #undef WASP_PREFIX_V
-    default:
-      break;
-  }
-  return nullopt;
+  return table;
 }
 
-constexpr u64 MakePrefixCode(u8 prefix, u32 code) {
-  return (u64{prefix} << 32) | code;
+constexpr u32 PrefixTableSize(u8 prefix) {
+  u32 size = 0;
+#define WASP_V(...) /* Invalid. */
+#define WASP_FEATURE_V(...) /* Invalid. */
+#define WASP_PREFIX_V(prefix_, code, Name, str, feature) \
+  if (prefix_ == prefix && code >= size) {               \
+    size = code + 1;                                     \
+  }
+#include "wasp/base/inc/opcode.inc"
+#undef WASP_V
+#undef WASP_FEATURE_V
+#undef WASP_PREFIX_V
+  return size;
 }
 
-// static
-optional<::wasp::Opcode> Opcode::Decode(u8 prefix,
-                                        u32 code,
-                                        const Features& features) {
-  switch (MakePrefixCode(prefix, code)) {
+template <u8 Prefix>
+constexpr auto MakePrefixOpcodeTable()
+    -> std::array<OpcodeTableEntry, PrefixTableSize(Prefix)> {
+  std::array<OpcodeTableEntry, PrefixTableSize(Prefix)> table{};
 #define WASP_V(...) /* Invalid. */
 #define WASP_FEATURE_V(...) /* Invalid. */
-#define WASP_PREFIX_V(prefix, code, Name, str, feature) \
-  case MakePrefixCode(prefix, code):                    \
-    if (features.feature##_enabled()) {                 \
-      return ::wasp::Opcode::Name;                      \
-    }                                                   \
-    break;
+#define WASP_PREFIX_V(prefix, code, Name, str, feature)                    \
+  if (prefix == Prefix) {                                                  \
+    table[code] = {OpcodeTableEntry::Kind::Opcode, ::wasp::Opcode::Name, \
+                   feature_bits::feature};                               \
+  }
 #include "wasp/base/inc/opcode.inc"
 #undef WASP_V
 #undef WASP_FEATURE_V
 #undef WASP_PREFIX_V
-    default:
-      break;
+  return table;
+}
+
+// Indexed by the opcode byte, or by the u32 code following a prefix byte.
+constexpr auto kOpcodeTable = MakeOpcodeTable();
+constexpr auto kGcOpcodeTable = MakePrefixOpcodeTable<Opcode::GcPrefix>();
+constexpr auto kMiscOpcodeTable = MakePrefixOpcodeTable<Opcode::MiscPrefix>();
+constexpr auto kSimdOpcodeTable = MakePrefixOpcodeTable<Opcode::SimdPrefix>();
+constexpr auto kThreadsOpcodeTable =
+    MakePrefixOpcodeTable<Opcode::ThreadsPrefix>();
+
+template <size_t N>
+optional<::wasp::Opcode> DecodeFromTable(
+    const std::array<OpcodeTableEntry, N>& table,
+    u32 code,
+    const Features& features) {
+  if (code < N) {
+    const auto& entry = table[code];
+    if (entry.kind == OpcodeTableEntry::Kind::Opcode &&
+        HasFeatureBits(features, entry.features)) {
+      return entry.opcode;
+    }
   }
   return nullopt;
 }
 
+}  // namespace
+
+// static
+bool Opcode::IsPrefixByte(u8 code, const Features& features) {
+  const auto& entry = kOpcodeTable[code];
+  return entry.kind == OpcodeTableEntry::Kind::Prefix &&
+         (features.bits() & entry.features) != 0;
+}
+
+// static
+optional<::wasp::Opcode> Opcode::Decode(u8 code, const Features& features) {
+  return DecodeFromTable(kOpcodeTable, code, features);
+}
+
+// static
+optional<::wasp::Opcode> Opcode::Decode(u8 prefix,
+                                        u32 code,
+                                        const Features& features) {
+  switch (prefix) {
+    case GcPrefix:
+      return DecodeFromTable(kGcOpcodeTable, code, features);
+
+    case MiscPrefix:
+      return DecodeFromTable(kMiscOpcodeTable, code, features);
+
+    case SimdPrefix:
+      return DecodeFromTable(kSimdOpcodeTable, code, features);
+
+    case ThreadsPrefix:
+      return DecodeFromTable(kThreadsOpcodeTable, code, features);
+
+    default:
+      return nullopt;
+  }
+}
+
 // static
 bool RefType::Is(u8 val) {
   return val == Ref || val == RefNull;
@@ -0,0 +1,112 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "wasp/binary/module_index.h"
+
+#include "wasp/base/errors_nop.h"
+#include "wasp/binary/lazy_module.h"
+#include "wasp/binary/read.h"
+#include "wasp/binary/read/read_ctx.h"
+#include "wasp/binary/sections.h"
+
+namespace wasp::binary {
+
+ModuleIndex::ModuleIndex(const LazyModule& module) : data_{module.data} {
+  // Errors are reported when the indexed items are actually read.
+  ErrorsNop errors;
+  LazyModule copy{module.data, module.ctx.features, errors};
+
+  for (auto section : copy.sections) {
+    sections_.push_back(section);
+    if (!section->is_known()) {
+      continue;
+    }
+
+    auto known = section->known();
+    switch (known->id) {
+      case SectionId::Import:
+        for (auto import : ReadImportSection(known, copy.ctx).sequence) {
+          import_counts_[static_cast<size_t>(import->kind())]++;
+        }
+        break;
+
+      case SectionId::Code: {
+        SpanU8 data = known->data;
+        auto count = ReadCount(&data, copy.ctx);
+        if (!count) {
+          break;
+        }
+        code_offsets_.reserve(*count);
+        for (Index i = 0; i < *count; ++i) {
+          auto offset = static_cast<u32>(data.data() - data_.data());
+          auto length = ReadLength(&data, copy.ctx);
+          if (!length || !ReadBytes(&data, *length, copy.ctx)) {
+            break;
+          }
+          code_offsets_.push_back(offset);
+        }
+        break;
+      }
+
+      default:
+        break;
+    }
+  }
+}
+
+auto ModuleIndex::GetKnownSection(SectionId id) const -> OptAt<KnownSection> {
+  for (auto&& section : sections_) {
+    if (section->is_known() && section->known()->id == id) {
+      return section->known();
+    }
+  }
+  return nullopt;
+}
+
+auto ModuleIndex::GetCustomSection(string_view name) const
+    -> OptAt<CustomSection> {
+  for (auto&& section : sections_) {
+    if (section->is_custom() && section->custom()->name == name) {
+      return section->custom();
+    }
+  }
+  return nullopt;
+}
+
+Index ModuleIndex::GetImportCount(ExternalKind kind) const {
+  return import_counts_[static_cast<size_t>(kind)];
+}
+
+Index ModuleIndex::imported_function_count() const {
+  return GetImportCount(ExternalKind::Function);
+}
+
+Index ModuleIndex::code_count() const {
+  return static_cast<Index>(code_offsets_.size());
+}
+
+auto ModuleIndex::GetCode(Index func_index, ReadCtx& ctx) const
+    -> OptAt<Code> {
+  if (func_index < imported_function_count() ||
+      func_index - imported_function_count() >= code_count()) {
+    return nullopt;
+  }
+  SpanU8 data =
+      data_.subspan(code_offsets_[func_index - imported_function_count()]);
+  return Read<Code>(&data, ctx);
+}
+
+}  // namespace wasp::binary
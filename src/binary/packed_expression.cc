@@ -0,0 +1,766 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "wasp/binary/packed_expression.h"
+
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "wasp/base/bitcast.h"
+#include "wasp/base/macros.h"
+#include "wasp/binary/encoding.h"
+#include "wasp/binary/lazy_expression.h"
+#include "wasp/binary/read.h"
+#include "wasp/binary/read/read_ctx.h"
+#include "wasp/binary/var_int.h"
+
+namespace wasp::binary {
+
+namespace {
+
+using Kind = PackedInstruction::Kind;
+
+u64 Pack2(u32 lo, u32 hi) {
+  return u64{lo} | (u64{hi} << 32);
+}
+
+u32 Lo(u64 x) {
+  return static_cast<u32>(x);
+}
+
+u32 Hi(u64 x) {
+  return static_cast<u32>(x >> 32);
+}
+
+// Length of the LEB128 encoded value at `p`, not reading past `end`.
+span_extent_t LebLength(const u8* p, const u8* end) {
+  const u8* start = p;
+  while (p < end && (*p & 0x80)) {
+    ++p;
+  }
+  return p < end ? p - start + 1 : p - start;
+}
+
+bool SameLoc(Location lhs, Location rhs) {
+  return lhs.data() == rhs.data() && lhs.size() == rhs.size();
+}
+
+// The end of the opcode of the instruction at `begin`, which is where its
+// immediate starts.
+const u8* ImmediateBegin(Opcode opcode, const u8* begin, const u8* end) {
+  return begin + (encoding::Opcode::Encode(opcode).u32_code
+                      ? 1 + LebLength(begin + 1, end)
+                      : 1);
+}
+
+// The location of the alternative held by `value`; every alternative is an
+// At<T>, except for monostate.
+template <typename Variant>
+Location VariantLoc(const Variant& value) {
+  return visit(
+      [](const auto& alt) -> Location {
+        if constexpr (std::is_same_v<std::decay_t<decltype(alt)>,
+                                     monostate>) {
+          return {};
+        } else {
+          return alt.loc();
+        }
+      },
+      value);
+}
+
+// Single-byte opcodes that don't require any feature, indexed by encoding.
+constexpr std::array<Opcode, 256> MakeMvpOpcodeTable() {
+  std::array<Opcode, 256> table{};
+#define WASP_V(prefix, val, Name, str, ...) table[val] = Opcode::Name;
+#define WASP_FEATURE_V(...)
+#define WASP_PREFIX_V(...)
+#include "wasp/base/inc/opcode.inc"
+#undef WASP_V
+#undef WASP_FEATURE_V
+#undef WASP_PREFIX_V
+  return table;
+}
+
+constexpr std::array<Opcode, 256> kMvpOpcodes = MakeMvpOpcodeTable();
+
+// Reads a LEB128 value that is shorter than the maximum encoding length of
+// T. Such values are always valid, so longer ones (and truncated ones) are
+// left for ReadVarInt to accept or diagnose.
+template <typename T>
+bool FastReadVarInt(const u8** p, const u8* end, T* out) {
+  using U = std::make_unsigned_t<T>;
+  U result = 0;
+  int shift = 0;
+  for (const u8* q = *p; q < end && q < *p + VarInt<T>::kMaxBytes - 1; ++q) {
+    result |= static_cast<U>(*q & VarInt<T>::kByteMask) << shift;
+    shift += VarInt<T>::kBitsPerByte;
+    if ((*q & VarInt<T>::kExtendBit) == 0) {
+      if (std::is_signed_v<T> && (*q & VarInt<T>::kSignBit)) {
+        result |= ~U{0} << shift;
+      }
+      *p = q + 1;
+      *out = static_cast<T>(result);
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename T>
+bool FastReadBytes(const u8** p, const u8* end, T* out) {
+  if (end - *p < static_cast<ptrdiff_t>(sizeof(T))) {
+    return false;
+  }
+  memcpy(out, *p, sizeof(T));
+  *p += sizeof(T);
+  return true;
+}
+
+}  // namespace
+
+bool FastReadInstruction(SpanU8* data, ReadCtx& ctx, PackedInstruction* out) {
+  if (ctx.seen_final_end || data->empty()) {
+    return false;
+  }
+
+  const u8* begin = data->data();
+  const u8* end = begin + data->size();
+  const u8* p = begin + 1;
+  const u8 byte = *begin;
+  const Opcode opcode = kMvpOpcodes[byte];
+  Kind kind = Kind::None;
+  u64 immediate = 0;
+
+  switch (byte) {
+    case 0x00:  // unreachable
+    case 0x01:  // nop
+    case 0x0f:  // return
+    case 0x1a:  // drop
+    case 0x1b:  // select
+      break;
+
+    case 0x02:  // block
+    case 0x03:  // loop
+    case 0x04: {  // if
+      if (p == end) {
+        return false;
+      }
+      const u8 block_type = *p++;
+      if (block_type == 0x40) {
+        kind = Kind::BlockTypeVoid;
+      } else if (block_type >= 0x7c && block_type <= 0x7f) {
+        kind = Kind::BlockTypeNumeric;
+        immediate = block_type;
+      } else {
+        return false;
+      }
+      ctx.open_blocks.push_back(At{MakeSpan(begin, begin + 1), opcode});
+      break;
+    }
+
+    case 0x05:  // else
+      if (ctx.open_blocks.empty() || ctx.open_blocks.back() != Opcode::If) {
+        return false;
+      }
+      ctx.open_blocks.back() = At{MakeSpan(begin, begin + 1), opcode};
+      break;
+
+    case 0x0b:  // end
+      if (ctx.open_blocks.empty()) {
+        ctx.seen_final_end = true;
+      } else if (ctx.open_blocks.back() == Opcode::Try) {
+        return false;
+      } else {
+        ctx.open_blocks.pop_back();
+      }
+      break;
+
+    case 0x0c:  // br
+    case 0x0d:  // br_if
+    case 0x10:  // call
+    case 0x20:  // local.get
+    case 0x21:  // local.set
+    case 0x22:  // local.tee
+    case 0x23:  // global.get
+    case 0x24: {  // global.set
+      u32 index;
+      if (!FastReadVarInt(&p, end, &index)) {
+        return false;
+      }
+      kind = Kind::Index;
+      immediate = index;
+      break;
+    }
+
+    case 0x41: {  // i32.const
+      s32 value;
+      if (!FastReadVarInt(&p, end, &value)) {
+        return false;
+      }
+      kind = Kind::S32;
+      immediate = static_cast<u32>(value);
+      break;
+    }
+
+    case 0x42: {  // i64.const
+      s64 value;
+      if (!FastReadVarInt(&p, end, &value)) {
+        return false;
+      }
+      kind = Kind::S64;
+      immediate = static_cast<u64>(value);
+      break;
+    }
+
+    case 0x43: {  // f32.const
+      u32 bits;
+      if (!FastReadBytes(&p, end, &bits)) {
+        return false;
+      }
+      kind = Kind::F32;
+      immediate = bits;
+      break;
+    }
+
+    case 0x44: {  // f64.const
+      u64 bits;
+      if (!FastReadBytes(&p, end, &bits)) {
+        return false;
+      }
+      kind = Kind::F64;
+      immediate = bits;
+      break;
+    }
+
+    default:
+      if (byte >= 0x28 && byte <= 0x3e) {  // loads and stores
+        u32 align_log2, offset;
+        if (!FastReadVarInt(&p, end, &align_log2) ||
+            !FastReadVarInt(&p, end, &offset)) {
+          return false;
+        }
+        kind = Kind::MemArg;
+        immediate = Pack2(align_log2, offset);
+      } else if (byte >= 0x45 && byte <= 0xbf) {  // numeric instructions
+        break;
+      } else {
+        return false;
+      }
+      break;
+  }
+
+  *out = PackedInstruction{0, static_cast<u16>(opcode), kind,
+                           static_cast<u8>(p - begin), immediate};
+  data->remove_prefix(p - begin);
+  return true;
+}
+
+PackedExpression::PackedExpression(SpanU8 data) : data_{data} {}
+
+void PackedExpression::Append(const At<Instruction>& instr) {
+  PackedInstruction packed;
+  if (!TryPack(instr, &packed)) {
+    packed = PackedInstruction{0, static_cast<u16>(*instr->opcode),
+                               Kind::OutOfLine, 0, out_of_line_.size()};
+    out_of_line_.push_back(instr);
+  }
+  instructions_.push_back(packed);
+}
+
+void PackedExpression::clear() {
+  instructions_.clear();
+  br_table_targets_.clear();
+  select_types_.clear();
+  out_of_line_.clear();
+}
+
+void PackedExpression::reserve(size_t size) {
+  instructions_.reserve(size);
+}
+
+auto PackedExpression::begin() const -> iterator {
+  return iterator{this, 0};
+}
+
+auto PackedExpression::end() const -> iterator {
+  return iterator{this, instructions_.size()};
+}
+
+auto PackedExpression::br_table_targets(const PackedInstruction& packed) const
+    -> span<const Index> {
+  assert(packed.kind == Kind::BrTable);
+  return span<const Index>{br_table_targets_.data() + Lo(packed.immediate),
+                           Hi(packed.immediate)};
+}
+
+Index PackedExpression::br_table_default_target(
+    const PackedInstruction& packed) const {
+  assert(packed.kind == Kind::BrTable);
+  return br_table_targets_[Lo(packed.immediate) + Hi(packed.immediate)];
+}
+
+auto PackedExpression::select_types(const PackedInstruction& packed) const
+    -> span<const At<ValueType>> {
+  assert(packed.kind == Kind::Select);
+  return span<const At<ValueType>>{select_types_.data() + Lo(packed.immediate),
+                                   Hi(packed.immediate)};
+}
+
+bool PackedExpression::TryPack(const At<Instruction>& instr,
+                               PackedInstruction* out) {
+  Location loc = instr.loc();
+  if (loc.empty() || loc.data() < data_.data() ||
+      loc.data() + loc.size() > data_.data() + data_.size()) {
+    return false;
+  }
+
+  const bool is_br_table = instr->kind() == InstructionKind::BrTable;
+  if (!is_br_table && loc.size() > std::numeric_limits<u8>::max()) {
+    return false;
+  }
+
+  // Only pack the instruction if Unpack would rebuild the same locations,
+  // which is always the case for an instruction read from `data_`. Only the
+  // locations need checking; the values are copied as-is.
+  const u8* begin = loc.data();
+  const u8* end = begin + loc.size();
+  const u8* imm_begin = ImmediateBegin(*instr->opcode, begin, end);
+  const Location imm_loc = MakeSpan(imm_begin, end);
+  const u8* mid = imm_begin + LebLength(imm_begin, end);
+  const Location loc1 = MakeSpan(imm_begin, mid);
+  const Location loc2 = MakeSpan(mid, end);
+  if (!SameLoc(instr->opcode.loc(), MakeSpan(begin, imm_begin)) ||
+      (!instr->has_no_immediate() &&
+       !SameLoc(VariantLoc(instr->immediate), imm_loc))) {
+    return false;
+  }
+
+  auto same_locs = [&](const auto& lhs, const auto& rhs) {
+    return SameLoc(lhs.loc(), loc1) && SameLoc(rhs.loc(), loc2);
+  };
+
+  PackedInstruction packed{static_cast<u32>(begin - data_.data()),
+                           static_cast<u16>(*instr->opcode), Kind::None,
+                           static_cast<u8>(loc.size()), 0};
+
+  switch (instr->kind()) {
+    case InstructionKind::None:
+      packed.kind = Kind::None;
+      break;
+
+    case InstructionKind::S32:
+      packed.kind = Kind::S32;
+      packed.immediate = static_cast<u32>(*instr->s32_immediate());
+      break;
+
+    case InstructionKind::S64:
+      packed.kind = Kind::S64;
+      packed.immediate = static_cast<u64>(*instr->s64_immediate());
+      break;
+
+    case InstructionKind::F32:
+      packed.kind = Kind::F32;
+      packed.immediate = Bitcast<u32>(*instr->f32_immediate());
+      break;
+
+    case InstructionKind::F64:
+      packed.kind = Kind::F64;
+      packed.immediate = Bitcast<u64>(*instr->f64_immediate());
+      break;
+
+    case InstructionKind::Index:
+      packed.kind = Kind::Index;
+      packed.immediate = *instr->index_immediate();
+      break;
+
+    case InstructionKind::BlockType: {
+      const auto& block_type = *instr->block_type_immediate();
+      if (!SameLoc(VariantLoc(block_type.type), imm_loc)) {
+        return false;
+      }
+      if (block_type.is_void()) {
+        packed.kind = Kind::BlockTypeVoid;
+      } else if (block_type.is_index()) {
+        packed.kind = Kind::BlockTypeIndex;
+        packed.immediate = *block_type.index();
+      } else if (block_type.value_type()->is_numeric_type() &&
+                 SameLoc(block_type.value_type()->numeric_type().loc(),
+                         imm_loc)) {
+        packed.kind = Kind::BlockTypeNumeric;
+        packed.immediate =
+            static_cast<u64>(*block_type.value_type()->numeric_type());
+      } else {
+        return false;
+      }
+      break;
+    }
+
+    case InstructionKind::BrOnExn: {
+      const auto& imm = *instr->br_on_exn_immediate();
+      if (!same_locs(imm.target, imm.event_index)) {
+        return false;
+      }
+      packed.kind = Kind::BrOnExn;
+      packed.immediate = Pack2(imm.target, imm.event_index);
+      break;
+    }
+
+    case InstructionKind::BrTable: {
+      const auto& imm = *instr->br_table_immediate();
+      // Each target is the next LEB128 value after the target count.
+      const u8* p = mid;
+      for (const auto& target : imm.targets) {
+        const u8* next = p + LebLength(p, end);
+        if (!SameLoc(target.loc(), MakeSpan(p, next))) {
+          return false;
+        }
+        p = next;
+      }
+      if (!SameLoc(imm.default_target.loc(), MakeSpan(p, end))) {
+        return false;
+      }
+      packed.kind = Kind::BrTable;
+      packed.length = 0;
+      packed.immediate = Pack2(static_cast<u32>(br_table_targets_.size()),
+                               static_cast<u32>(imm.targets.size()));
+      for (const auto& target : imm.targets) {
+        br_table_targets_.push_back(target);
+      }
+      br_table_targets_.push_back(imm.default_target);
+      break;
+    }
+
+    case InstructionKind::CallIndirect: {
+      const auto& imm = *instr->call_indirect_immediate();
+      if (!same_locs(imm.index, imm.table_index)) {
+        return false;
+      }
+      packed.kind = Kind::CallIndirect;
+      packed.immediate = Pack2(imm.index, imm.table_index);
+      break;
+    }
+
+    case InstructionKind::Copy: {
+      const auto& imm = *instr->copy_immediate();
+      if (!same_locs(imm.dst_index, imm.src_index)) {
+        return false;
+      }
+      packed.kind = Kind::Copy;
+      packed.immediate = Pack2(imm.dst_index, imm.src_index);
+      break;
+    }
+
+    case InstructionKind::Init: {
+      const auto& imm = *instr->init_immediate();
+      if (!same_locs(imm.segment_index, imm.dst_index)) {
+        return false;
+      }
+      packed.kind = Kind::Init;
+      packed.immediate = Pack2(imm.segment_index, imm.dst_index);
+      break;
+    }
+
+    case InstructionKind::FuncBind: {
+      const auto& imm = *instr->func_bind_immediate();
+      if (!SameLoc(imm.index.loc(), imm_loc)) {
+        return false;
+      }
+      packed.kind = Kind::FuncBind;
+      packed.immediate = *imm.index;
+      break;
+    }
+
+    case InstructionKind::HeapType: {
+      const auto& heap_type = *instr->heap_type_immediate();
+      if (!SameLoc(VariantLoc(heap_type.type), imm_loc)) {
+        return false;
+      }
+      if (heap_type.is_heap_kind()) {
+        packed.kind = Kind::HeapTypeKind;
+        packed.immediate = static_cast<u64>(*heap_type.heap_kind());
+      } else {
+        packed.kind = Kind::HeapTypeIndex;
+        packed.immediate = *heap_type.index();
+      }
+      break;
+    }
+
+    case InstructionKind::MemArg: {
+      const auto& imm = *instr->mem_arg_immediate();
+      if (!same_locs(imm.align_log2, imm.offset)) {
+        return false;
+      }
+      packed.kind = Kind::MemArg;
+      packed.immediate = Pack2(imm.align_log2, imm.offset);
+      break;
+    }
+
+    case InstructionKind::Select: {
+      // The types keep their own locations.
+      const auto& types = *instr->select_immediate();
+      packed.kind = Kind::Select;
+      packed.immediate = Pack2(static_cast<u32>(select_types_.size()),
+                               static_cast<u32>(types.size()));
+      select_types_.insert(select_types_.end(), types.begin(), types.end());
+      break;
+    }
+
+    case InstructionKind::SimdLane:
+      packed.kind = Kind::SimdLane;
+      packed.immediate = *instr->simd_lane_immediate();
+      break;
+
+    case InstructionKind::StructField: {
+      const auto& imm = *instr->struct_field_immediate();
+      if (!same_locs(imm.struct_, imm.field)) {
+        return false;
+      }
+      packed.kind = Kind::StructField;
+      packed.immediate = Pack2(imm.struct_, imm.field);
+      break;
+    }
+
+    default:
+      return false;
+  }
+
+  *out = packed;
+  return true;
+}
+
+auto PackedExpression::Unpack(const PackedInstruction& packed) const
+    -> At<Instruction> {
+  At<Instruction> result{Instruction{At{Opcode::Nop}}};
+  UnpackInto(packed, &result);
+  return result;
+}
+
+void PackedExpression::UnpackInto(const PackedInstruction& packed,
+                                  At<Instruction>* out) const {
+  if (packed.kind == Kind::OutOfLine) {
+    *out = out_of_line_[packed.immediate];
+    return;
+  }
+
+  const u8* data_end = data_.data() + data_.size();
+  const u8* begin = data_.data() + packed.offset;
+  auto opcode = static_cast<Opcode>(packed.opcode);
+  const u8* imm_begin = ImmediateBegin(opcode, begin, data_end);
+  const u32 lo = Lo(packed.immediate);
+  const u32 hi = Hi(packed.immediate);
+
+  const u8* end = begin + packed.length;
+  if (packed.kind == Kind::BrTable) {
+    // Skip the target count, the targets and the default target.
+    end = imm_begin;
+    for (u64 i = 0; i < u64{hi} + 2; ++i) {
+      end += LebLength(end, data_end);
+    }
+  }
+
+  const Location loc = MakeSpan(begin, end);
+  const Location imm_loc = MakeSpan(imm_begin, end);
+  const At<Opcode> opcode_at{MakeSpan(begin, imm_begin), opcode};
+
+  // Split the immediate into two LEB128 encoded parts.
+  const u8* mid = imm_begin + LebLength(imm_begin, end);
+  const Location loc1 = MakeSpan(imm_begin, mid);
+  const Location loc2 = MakeSpan(mid, end);
+
+  auto make = [&](auto immediate) {
+    return At{loc, Instruction{opcode_at, At{imm_loc, std::move(immediate)}}};
+  };
+
+  switch (packed.kind) {
+    case Kind::None:
+      *out = At{loc, Instruction{opcode_at}};
+      return;
+
+    case Kind::S32:
+      *out = make(static_cast<s32>(lo));
+      return;
+
+    case Kind::S64:
+      *out = make(static_cast<s64>(packed.immediate));
+      return;
+
+    case Kind::F32:
+      *out = make(Bitcast<f32>(lo));
+      return;
+
+    case Kind::F64:
+      *out = make(Bitcast<f64>(packed.immediate));
+      return;
+
+    case Kind::Index:
+      *out = make(Index{lo});
+      return;
+
+    case Kind::BlockTypeVoid:
+      *out = make(BlockType{At{imm_loc, VoidType{}}});
+      return;
+
+    case Kind::BlockTypeIndex:
+      *out = make(BlockType{At{imm_loc, Index{lo}}});
+      return;
+
+    case Kind::BlockTypeNumeric:
+      *out = make(BlockType{At{
+          imm_loc, ValueType{At{imm_loc, static_cast<NumericType>(lo)}}}});
+      return;
+
+    case Kind::BrOnExn:
+      *out = make(BrOnExnImmediate{At{loc1, lo}, At{loc2, hi}});
+      return;
+
+    case Kind::BrTable: {
+      IndexList targets;
+      if ((*out)->has_br_table_immediate()) {
+        targets = std::move((*out)->br_table_immediate()->targets);
+        targets.clear();
+      }
+      const u8* p = mid;
+      for (Index target : br_table_targets(packed)) {
+        const u8* next = p + LebLength(p, end);
+        targets.push_back(At{MakeSpan(p, next), target});
+        p = next;
+      }
+      At<Index> default_target{MakeSpan(p, end),
+                               br_table_default_target(packed)};
+      *out = make(BrTableImmediate{std::move(targets), default_target});
+      return;
+    }
+
+    case Kind::CallIndirect:
+      *out = make(CallIndirectImmediate{At{loc1, lo}, At{loc2, hi}});
+      return;
+
+    case Kind::Copy:
+      *out = make(CopyImmediate{At{loc1, lo}, At{loc2, hi}});
+      return;
+
+    case Kind::Init:
+      *out = make(InitImmediate{At{loc1, lo}, At{loc2, hi}});
+      return;
+
+    case Kind::FuncBind:
+      *out = make(FuncBindImmediate{At{imm_loc, lo}});
+      return;
+
+    case Kind::HeapTypeKind:
+      *out = make(HeapType{At{imm_loc, static_cast<HeapKind>(lo)}});
+      return;
+
+    case Kind::HeapTypeIndex:
+      *out = make(HeapType{At{imm_loc, Index{lo}}});
+      return;
+
+    case Kind::MemArg:
+      *out = make(MemArgImmediate{At{loc1, lo}, At{loc2, hi}});
+      return;
+
+    case Kind::Select: {
+      SelectImmediate types;
+      if ((*out)->has_select_immediate()) {
+        types = std::move(*(*out)->select_immediate());
+      }
+      auto arena_types = select_types(packed);
+      types.assign(arena_types.begin(), arena_types.end());
+      *out = make(std::move(types));
+      return;
+    }
+
+    case Kind::SimdLane:
+      *out = make(static_cast<SimdLaneImmediate>(lo));
+      return;
+
+    case Kind::StructField:
+      *out = make(StructFieldImmediate{At{loc1, lo}, At{loc2, hi}});
+      return;
+
+    case Kind::OutOfLine:
+      break;
+  }
+  WASP_UNREACHABLE();
+}
+
+PackedExpression::iterator::iterator(const PackedExpression* expr,
+                                     size_t index)
+    : expr_{expr}, index_{index} {}
+
+auto PackedExpression::iterator::operator*() const -> reference {
+  const auto& packed = expr_->instructions_[index_];
+  if (packed.kind == Kind::OutOfLine) {
+    return expr_->out_of_line_[packed.immediate];
+  }
+  expr_->UnpackInto(packed, &scratch_);
+  return scratch_;
+}
+
+auto PackedExpression::iterator::operator++() -> iterator& {
+  ++index_;
+  return *this;
+}
+
+auto PackedExpression::iterator::operator++(int) -> iterator {
+  return iterator{expr_, index_++};
+}
+
+auto ReadPackedExpression(SpanU8 expr, ReadCtx& ctx) -> PackedExpression {
+  PackedExpression result{expr};
+  for (auto&& instr : ReadExpression(expr, ctx)) {
+    result.Append(instr);
+  }
+  return result;
+}
+
+auto ReadPackedCode(const At<Code>& code, ReadCtx& ctx) -> At<PackedCode> {
+  auto body = ReadPackedExpression(code->body->data, ctx);
+  return At{code.loc(), PackedCode{code->locals, std::move(body)}};
+}
+
+auto FastReadPackedExpression(SpanU8 expr, ReadCtx& ctx) -> PackedExpression {
+  PackedExpression result{expr};
+  ctx.seen_final_end = false;
+  SpanU8 data = expr;
+  while (!data.empty()) {
+    PackedInstruction packed;
+    auto offset = static_cast<u32>(data.data() - expr.data());
+    if (FastReadInstruction(&data, ctx, &packed)) {
+      packed.offset = offset;
+      result.instructions_.push_back(packed);
+    } else {
+      auto instr = Read<Instruction>(&data, ctx);
+      if (!instr) {
+        break;
+      }
+      result.Append(*instr);
+    }
+  }
+  return result;
+}
+
+auto FastReadPackedCode(const At<Code>& code, ReadCtx& ctx) -> At<PackedCode> {
+  auto body = FastReadPackedExpression(code->body->data, ctx);
+  return At{code.loc(), PackedCode{code->locals, std::move(body)}};
+}
+
+}  // namespace wasp::binary
@@ -16,8 +16,11 @@
 
 #include "wasp/binary/read.h"
 
+#include <algorithm>
+
 #include "wasp/base/errors_context_guard.h"
 #include "wasp/binary/lazy_module.h"
+#include "wasp/binary/packed_expression.h"
 #include "wasp/binary/read/location_guard.h"
 #include "wasp/binary/read/macros.h"
 #include "wasp/binary/visitor.h"
@@ -29,6 +32,61 @@ using visit::Result;
 struct EagerModuleVisitor : visit::Visitor {
   explicit EagerModuleVisitor(Module& module) : module{module} {}
 
+  auto BeginTypeSection(LazyTypeSection section) -> Result {
+    Reserve(module.types, section);
+    return Result::Ok;
+  }
+
+  auto BeginImportSection(LazyImportSection section) -> Result {
+    Reserve(module.imports, section);
+    return Result::Ok;
+  }
+
+  auto BeginFunctionSection(LazyFunctionSection section) -> Result {
+    Reserve(module.functions, section);
+    return Result::Ok;
+  }
+
+  auto BeginTableSection(LazyTableSection section) -> Result {
+    Reserve(module.tables, section);
+    return Result::Ok;
+  }
+
+  auto BeginMemorySection(LazyMemorySection section) -> Result {
+    Reserve(module.memories, section);
+    return Result::Ok;
+  }
+
+  auto BeginGlobalSection(LazyGlobalSection section) -> Result {
+    Reserve(module.globals, section);
+    return Result::Ok;
+  }
+
+  auto BeginEventSection(LazyEventSection section) -> Result {
+    Reserve(module.events, section);
+    return Result::Ok;
+  }
+
+  auto BeginExportSection(LazyExportSection section) -> Result {
+    Reserve(module.exports, section);
+    return Result::Ok;
+  }
+
+  auto BeginElementSection(LazyElementSection section) -> Result {
+    Reserve(module.element_segments, section);
+    return Result::Ok;
+  }
+
+  auto BeginCodeSection(LazyCodeSection section) -> Result {
+    Reserve(module.codes, section);
+    return Result::Ok;
+  }
+
+  auto BeginDataSection(LazyDataSection section) -> Result {
+    Reserve(module.data_segments, section);
+    return Result::Ok;
+  }
+
   auto OnType(const At<DefinedType>& type) -> Result {
     module.types.push_back(type);
     return Result::Ok;
@@ -86,6 +144,20 @@ struct EagerModuleVisitor : visit::Visitor {
 
   auto BeginCode(const At<Code>& code) -> Result {
     module.codes.push_back(At{code.loc(), UnpackedCode{code->locals, {}}});
+    module.codes.back()->body.instructions.reserve(
+        std::min(code->body->data.size() / kBytesPerInstruction,
+                 kMaxReservedInstructions));
+    return Result::Ok;
+  }
+
+  auto EndCode(const At<Code>&) -> Result {
+    // A body can have far fewer instructions than its size suggests (e.g.
+    // one large br_table), so give back the unused space. This way only the
+    // body being read is ever over-reserved.
+    auto& instructions = module.codes.back()->body.instructions;
+    if (instructions.capacity() > 2 * instructions.size()) {
+      instructions.shrink_to_fit();
+    }
     return Result::Ok;
   }
 
@@ -99,9 +171,50 @@ struct EagerModuleVisitor : visit::Visitor {
     return Result::Ok;
   }
 
+  // ReadCount only checks that a section's count is no larger than its size
+  // in bytes, but each element takes hundreds of bytes in memory (e.g.
+  // At<Import>), so the count is capped. Larger sections grow as usual.
+  template <typename T, typename Section>
+  static void Reserve(std::vector<T>& vec, const Section& section) {
+    if (section.count) {
+      vec.reserve(vec.size() + std::min(size_t{section.count->value()},
+                                        kMaxReservedItems));
+    }
+  }
+
+  // Rough average encoded size of an instruction, used to pre-size the
+  // instruction list from the size of the function body.
+  static constexpr size_t kBytesPerInstruction = 2;
+
+  // Larger bodies grow their instruction list as usual.
+  static constexpr size_t kMaxReservedInstructions = 4096;
+
+  static constexpr size_t kMaxReservedItems = 4096;
+
   Module& module;
 };
 
+// Like EagerModuleVisitor, but function bodies are packed as they are read.
+struct PackedModuleVisitor : EagerModuleVisitor {
+  explicit PackedModuleVisitor(PackedModule& packed, ReadCtx& ctx)
+      : EagerModuleVisitor{packed.module}, packed{packed}, ctx{ctx} {}
+
+  auto BeginCodeSection(LazyCodeSection section) -> Result {
+    Reserve(packed.codes, section);
+    return Result::Ok;
+  }
+
+  auto BeginCode(const At<Code>& code) -> Result {
+    packed.codes.push_back(FastReadPackedCode(code, ctx));
+    binary::EndCode(code->body->data.last(0), ctx);
+    // The body has already been read.
+    return Result::Skip;
+  }
+
+  PackedModule& packed;
+  ReadCtx& ctx;
+};
+
 auto ReadModule(SpanU8 data, ReadCtx& ctx) -> optional<Module> {
   ErrorsContextGuard error_guard{ctx.errors, data, "module"};
   LazyModule lazy_module{data, ctx.features, ctx.errors};
@@ -117,4 +230,19 @@ auto ReadModule(SpanU8 data, ReadCtx& ctx) -> optional<Module> {
   return module;
 }
 
+auto ReadPackedModule(SpanU8 data, ReadCtx& ctx) -> optional<PackedModule> {
+  ErrorsContextGuard error_guard{ctx.errors, data, "module"};
+  LazyModule lazy_module{data, ctx.features, ctx.errors};
+  if (!(lazy_module.magic.has_value() && lazy_module.version.has_value())) {
+    return nullopt;
+  }
+
+  PackedModule packed;
+  PackedModuleVisitor visitor{packed, lazy_module.ctx};
+  if (Visit(lazy_module, visitor) == Result::Fail || ctx.errors.HasError()) {
+    return nullopt;
+  }
+  return packed;
+}
+
 }  // namespace wasp::binary
@@ -17,6 +17,7 @@
 
 import argparse
 import collections
+import io
 import os
 import sys
 
@@ -28,6 +29,58 @@ class Error(Exception):
     pass
 
 
+# Keywords that are a prefix of a longer token (e.g. `align=8`) can't be
+# found by looking up the whole token, so Lex handles them itself.
+PREFIX_TOKEN_TYPES = (
+    ('TokenType::AlignEqNat',),
+    ('TokenType::OffsetEqNat',),
+    ('TokenType::Float', 'LiteralKind::NanPayload'),
+)
+
+# The TokenType of keywords that are given without one, by immediate kind.
+DEFAULT_TOKEN_TYPES = {
+    'Opcode': 'TokenType::BareInstr',
+    'NumericType': 'TokenType::NumericType',
+    'ReferenceKind': 'TokenType::ReferenceKind',
+    'PackedType': 'TokenType::PackedType',
+    'SimdShape': 'TokenType::SimdShape',
+}
+
+# Must match HashKeyword, MixKeywordHash and ReduceKeywordHash in lex.cc.
+MAX_DISPLACEMENT = 0xffff
+
+
+def LoadLittleEndian(data):
+    return sum(c << (8 * i) for i, c in enumerate(data))
+
+
+def HashKeyword(key):
+    # Hashes the first, middle and last 8 bytes, which may overlap, and the
+    # length.
+    data = key.encode('ascii')
+    size = len(data)
+    lo = LoadLittleEndian(data[:8])
+    hi = LoadLittleEndian(data[-8:]) if size > 8 else lo
+    mid = LoadLittleEndian(data[size // 2 - 4:][:8]) if size > 16 else lo
+    x = ((lo * 0x9e3779b97f4a7c15) ^ (hi * 0xc2b2ae3d27d4eb4f) ^
+         (mid * 0x165667b19e3779f9) ^ size)
+    x &= 0xffffffffffffffff
+    return (x ^ (x >> 32)) & 0xffffffff
+
+
+def MixKeywordHash(x):
+    x ^= x >> 16
+    x = (x * 0x7feb352d) & 0xffffffff
+    x ^= x >> 15
+    x = (x * 0x846ca68b) & 0xffffffff
+    x ^= x >> 16
+    return x
+
+
+def ReduceKeywordHash(x, n):
+    return (x * n) >> 32
+
+
 class Runner(object):
 
     def __init__(self, filename, options):
@@ -46,59 +99,87 @@ class Runner(object):
                 self.values[parts[0]] = parts[1:]
 
     def Run(self):
+        # Generate everything first, so a failure doesn't clobber the output.
+        self.output_file = io.StringIO()
+        self.Emit(self.keys)
+        output = self.output_file.getvalue()
+        self.output_file = None
         if self.options.output:
             with open(self.options.output, 'w') as output_file:
-                self.output_file = output_file
-                self.Emit(self.keys)
+                output_file.write(output)
         else:
-            self.output_file = sys.stdout
-            self.Emit(self.keys)
-        self.output_file = None
+            sys.stdout.write(output)
 
-    def DistinctChars(self, keys, index):
-        distinct = collections.defaultdict(list)
+    def GetEntry(self, key):
+        values = list(self.values[key])
+        if values[0].startswith('TokenType::'):
+            token_type = values.pop(0)
+        else:
+            token_type = DEFAULT_TOKEN_TYPES[values[0].split('::')[0]]
+
+        features = '0'
+        if values and values[-1].startswith('Features::'):
+            features = values.pop()
+
+        if not values:
+            return token_type, 'None', '0', features
+        assert len(values) == 1, key
+        kind = values[0].split('::')[0]
+        return token_type, kind, 'u32(%s)' % values[0], features
+
+    def MakePerfectHash(self, keys):
+        # "Hash and displace": each key's hash picks a bucket, and each bucket
+        # has a displacement, chosen so that the keys of all buckets land in
+        # distinct slots.
+        count = len(keys)
+        bucket_count = (count + 1) // 2
+        buckets = collections.defaultdict(list)
         for key in keys:
-            assert(index <= len(key))
-            if index < len(key):
-                distinct[key[index]].append(key)
-            else:
-                distinct['\0'].append(key)
-        return len(distinct), index, distinct
-
-    def Emit(self, keys, indent=''):
-        min_length = min(len(key) for key in keys)
-        _, index, distinct = max(self.DistinctChars(keys, i)
-                                 for i in range(min_length + 1))
-        self.Print(indent, 'switch (PeekChar(data, {})) {{'.format(index))
-        has_default = False
-        for char in sorted(distinct.keys()):
-            subkeys = distinct[char]
-            if char == '\0':
-                has_default = True
-                self.Print(indent, "  default:", end='')
+            buckets[ReduceKeywordHash(HashKeyword(key), bucket_count)].append(key)
+
+        displacements = [0] * bucket_count
+        slots = [None] * count
+        for bucket, bucket_keys in sorted(buckets.items(),
+                                          key=lambda item: -len(item[1])):
+            for displacement in range(MAX_DISPLACEMENT + 1):
+                candidate = [
+                    ReduceKeywordHash(
+                        MixKeywordHash(HashKeyword(key) ^ displacement), count)
+                    for key in bucket_keys]
+                if (len(set(candidate)) == len(candidate) and
+                        all(slots[slot] is None for slot in candidate)):
+                    break
             else:
-                self.Print(indent, "  case '{}':".format(char), end='')
-
-            if len(subkeys) == 1:
-                key = subkeys[0]
-                values = tuple(self.values[key])
-                if values[0] in ('TokenType::AlignEqNat',
-                                 'TokenType::OffsetEqNat'):
-                  self.Print('', ' return LexNameEqNum(data, "{}", {});'.format(
-                             key, values[0]))
-                elif values == ('TokenType::Float', 'LiteralKind::NanPayload'):
-                  self.Print('', ' return LexNan(data);')
-                else:
-                  self.Print('', ' return LexKeyword(data, "{}", {});'.format(
-                             key, ', '.join(values)))
-            else:
-                self.Print()
-                self.Emit(subkeys, indent + '    ')
-
-        if not has_default:
-            self.Print(indent, '  default: break;')
-        self.Print(indent, '}')
-        self.Print(indent, 'break;')
+                raise Error('No displacement found for bucket %d' % bucket)
+            displacements[bucket] = displacement
+            for key, slot in zip(bucket_keys, candidate):
+                slots[slot] = key
+        return displacements, slots
+
+    def Emit(self, keys):
+        keys = [key for key in keys
+                if tuple(self.values[key]) not in PREFIX_TOKEN_TYPES]
+        displacements, slots = self.MakePerfectHash(keys)
+
+        self.Print('// Generated by gen-keywords.py from keywords.txt. '
+                   'Do not edit.')
+        self.Print()
+        self.Print('constexpr u32 kKeywordCount = {};'.format(len(slots)))
+        self.Print('constexpr u32 kKeywordBucketCount = {};'.format(
+            len(displacements)))
+        self.Print()
+        self.Print('constexpr u16 kKeywordDisplacements[] = {')
+        for i in range(0, len(displacements), 10):
+            self.Print('   ', ''.join(
+                ' {},'.format(d) for d in displacements[i:i + 10]))
+        self.Print('};')
+        self.Print()
+        self.Print('constexpr Keyword kKeywords[] = {')
+        for key in slots:
+            token_type, kind, value, features = self.GetEntry(key)
+            self.Print('    {{"{}", {}, {}, KeywordImmediate::{}, {}, {}}},'.format(
+                key, len(key), token_type, kind, value, features))
+        self.Print('};')
 
     def Print(self, indent='', line='', end=None):
         print('{}{}'.format(indent, line), end=end, file=self.output_file)
@@ -1,2031 +1,643 @@
-switch (PeekChar(data, 2)) {
-  default:
-    switch (PeekChar(data, 1)) {
-      case '8': return LexKeyword(data, "i8", PackedType::I8);
-      case 'f': return LexKeyword(data, "if", TokenType::BlockInstr, Opcode::If);
-      case 'q': return LexKeyword(data, "eq", TokenType::HeapKind, HeapKind::Eq);
-      case 'r': return LexKeyword(data, "br", TokenType::VarInstr, Opcode::Br);
-      default: break;
-    }
-    break;
-  case '1':
-    switch (PeekChar(data, 3)) {
-      default: return LexKeyword(data, "i31", TokenType::HeapKind, HeapKind::I31);
-      case '.':
-        switch (PeekChar(data, 7)) {
-          default: return LexKeyword(data, "i31.new", Opcode::I31New, Features::GC);
-          case '_':
-            switch (PeekChar(data, 8)) {
-              case 's': return LexKeyword(data, "i31.get_s", Opcode::I31GetS, Features::GC);
-              case 'u': return LexKeyword(data, "i31.get_u", Opcode::I31GetU, Features::GC);
-              default: break;
-            }
-            break;
-        }
-        break;
-      case 'r': return LexKeyword(data, "i31ref", ReferenceKind::I31ref);
-    }
-    break;
-  case '2':
-    switch (PeekChar(data, 3)) {
-      default:
-        switch (PeekChar(data, 0)) {
-          case 'f': return LexKeyword(data, "f32", NumericType::F32);
-          case 'i': return LexKeyword(data, "i32", NumericType::I32);
-          default: break;
-        }
-        break;
-      case '.':
-        switch (PeekChar(data, 6)) {
-          default:
-            switch (PeekChar(data, 4)) {
-              case 'e':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f32.eq", Opcode::F32Eq);
-                  case 'i': return LexKeyword(data, "i32.eq", Opcode::I32Eq);
-                  default: break;
-                }
-                break;
-              case 'g':
-                switch (PeekChar(data, 5)) {
-                  case 'e': return LexKeyword(data, "f32.ge", Opcode::F32Ge);
-                  case 't': return LexKeyword(data, "f32.gt", Opcode::F32Gt);
-                  default: break;
-                }
-                break;
-              case 'l':
-                switch (PeekChar(data, 5)) {
-                  case 'e': return LexKeyword(data, "f32.le", Opcode::F32Le);
-                  case 't': return LexKeyword(data, "f32.lt", Opcode::F32Lt);
-                  default: break;
-                }
-                break;
-              case 'n':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f32.ne", Opcode::F32Ne);
-                  case 'i': return LexKeyword(data, "i32.ne", Opcode::I32Ne);
-                  default: break;
-                }
-                break;
-              case 'o': return LexKeyword(data, "i32.or", Opcode::I32Or);
-              default: break;
-            }
-            break;
-          case '_':
-            switch (PeekChar(data, 7)) {
-              case 's':
-                switch (PeekChar(data, 5)) {
-                  case 'e':
-                    switch (PeekChar(data, 4)) {
-                      case 'g': return LexKeyword(data, "i32.ge_s", Opcode::I32GeS);
-                      case 'l': return LexKeyword(data, "i32.le_s", Opcode::I32LeS);
-                      default: break;
-                    }
-                    break;
-                  case 't':
-                    switch (PeekChar(data, 4)) {
-                      case 'g': return LexKeyword(data, "i32.gt_s", Opcode::I32GtS);
-                      case 'l': return LexKeyword(data, "i32.lt_s", Opcode::I32LtS);
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-              case 'u':
-                switch (PeekChar(data, 5)) {
-                  case 'e':
-                    switch (PeekChar(data, 4)) {
-                      case 'g': return LexKeyword(data, "i32.ge_u", Opcode::I32GeU);
-                      case 'l': return LexKeyword(data, "i32.le_u", Opcode::I32LeU);
-                      default: break;
-                    }
-                    break;
-                  case 't':
-                    switch (PeekChar(data, 4)) {
-                      case 'g': return LexKeyword(data, "i32.gt_u", Opcode::I32GtU);
-                      case 'l': return LexKeyword(data, "i32.lt_u", Opcode::I32LtU);
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-              default: break;
-            }
-            break;
-          case 'a':
-            switch (PeekChar(data, 8)) {
-              default:
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f32.load", TokenType::MemoryInstr, Opcode::F32Load);
-                  case 'i': return LexKeyword(data, "i32.load", TokenType::MemoryInstr, Opcode::I32Load);
-                  default: break;
-                }
-                break;
-              case '/': return LexKeyword(data, "i32.wrap/i64", Opcode::I32WrapI64);
-              case '1':
-                switch (PeekChar(data, 11)) {
-                  case 's': return LexKeyword(data, "i32.load16_s", TokenType::MemoryInstr, Opcode::I32Load16S);
-                  case 'u': return LexKeyword(data, "i32.load16_u", TokenType::MemoryInstr, Opcode::I32Load16U);
-                  default: break;
-                }
-                break;
-              case '8':
-                switch (PeekChar(data, 10)) {
-                  case 's': return LexKeyword(data, "i32.load8_s", TokenType::MemoryInstr, Opcode::I32Load8S);
-                  case 'u': return LexKeyword(data, "i32.load8_u", TokenType::MemoryInstr, Opcode::I32Load8U);
-                  default: break;
-                }
-                break;
-              case '_': return LexKeyword(data, "i32.wrap_i64", Opcode::I32WrapI64);
-              case 'e': return LexKeyword(data, "f32.nearest", Opcode::F32Nearest);
-            }
-            break;
-          case 'b':
-            switch (PeekChar(data, 0)) {
-              case 'f': return LexKeyword(data, "f32.sub", Opcode::F32Sub);
-              case 'i': return LexKeyword(data, "i32.sub", Opcode::I32Sub);
-              default: break;
-            }
-            break;
-          case 'd':
-            switch (PeekChar(data, 5)) {
-              case 'd':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f32.add", Opcode::F32Add);
-                  case 'i': return LexKeyword(data, "i32.add", Opcode::I32Add);
-                  default: break;
-                }
-                break;
-              case 'n': return LexKeyword(data, "i32.and", Opcode::I32And);
-              default: break;
-            }
-            break;
-          case 'g': return LexKeyword(data, "f32.neg", Opcode::F32Neg);
-          case 'i':
-            switch (PeekChar(data, 8)) {
-              default: return LexKeyword(data, "f32.ceil", Opcode::F32Ceil);
-              case 't':
-                switch (PeekChar(data, 16)) {
-                  case 'f':
-                    switch (PeekChar(data, 15)) {
-                      case '/': return LexKeyword(data, "i32.reinterpret/f32", Opcode::I32ReinterpretF32);
-                      case '_': return LexKeyword(data, "i32.reinterpret_f32", Opcode::I32ReinterpretF32);
-                      default: break;
-                    }
-                    break;
-                  case 'i':
-                    switch (PeekChar(data, 15)) {
-                      case '/': return LexKeyword(data, "f32.reinterpret/i32", Opcode::F32ReinterpretI32);
-                      case '_': return LexKeyword(data, "f32.reinterpret_i32", Opcode::F32ReinterpretI32);
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-            }
-            break;
-          case 'l':
-            switch (PeekChar(data, 5)) {
-              case 'h': return LexKeyword(data, "i32.shl", Opcode::I32Shl);
-              case 'u':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f32.mul", Opcode::F32Mul);
-                  case 'i': return LexKeyword(data, "i32.mul", Opcode::I32Mul);
-                  default: break;
-                }
-                break;
-              default: break;
-            }
-            break;
-          case 'm':
-            switch (PeekChar(data, 8)) {
-              case 's': return LexKeyword(data, "i32.rem_s", Opcode::I32RemS);
-              case 't':
-                switch (PeekChar(data, 10)) {
-                  case '/': return LexKeyword(data, "f32.demote/f64", Opcode::F32DemoteF64);
-                  case '_': return LexKeyword(data, "f32.demote_f64", Opcode::F32DemoteF64);
-                  default: break;
-                }
-                break;
-              case 'u': return LexKeyword(data, "i32.rem_u", Opcode::I32RemU);
-              default: break;
-            }
-            break;
-          case 'n':
-            switch (PeekChar(data, 7)) {
-              default: return LexKeyword(data, "f32.min", Opcode::F32Min);
-              case 's':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f32.const", TokenType::F32ConstInstr, Opcode::F32Const);
-                  case 'i': return LexKeyword(data, "i32.const", TokenType::I32ConstInstr, Opcode::I32Const);
-                  default: break;
-                }
-                break;
-              case 'v':
-                switch (PeekChar(data, 16)) {
-                  case '2':
-                    switch (PeekChar(data, 12)) {
-                      case 's': return LexKeyword(data, "f32.convert_s/i32", Opcode::F32ConvertI32S);
-                      case 'u': return LexKeyword(data, "f32.convert_u/i32", Opcode::F32ConvertI32U);
-                      default: break;
-                    }
-                    break;
-                  case '4':
-                    switch (PeekChar(data, 12)) {
-                      case 's': return LexKeyword(data, "f32.convert_s/i64", Opcode::F32ConvertI64S);
-                      case 'u': return LexKeyword(data, "f32.convert_u/i64", Opcode::F32ConvertI64U);
-                      default: break;
-                    }
-                    break;
-                  case 's':
-                    switch (PeekChar(data, 14)) {
-                      case '2': return LexKeyword(data, "f32.convert_i32_s", Opcode::F32ConvertI32S);
-                      case '4': return LexKeyword(data, "f32.convert_i64_s", Opcode::F32ConvertI64S);
-                      default: break;
-                    }
-                    break;
-                  case 'u':
-                    switch (PeekChar(data, 14)) {
-                      case '2': return LexKeyword(data, "f32.convert_i32_u", Opcode::F32ConvertI32U);
-                      case '4': return LexKeyword(data, "f32.convert_i64_u", Opcode::F32ConvertI64U);
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-            }
-            break;
-          case 'o':
-            switch (PeekChar(data, 9)) {
-              default:
-                switch (PeekChar(data, 8)) {
-                  case 'e':
-                    switch (PeekChar(data, 0)) {
-                      case 'f': return LexKeyword(data, "f32.store", TokenType::MemoryInstr, Opcode::F32Store);
-                      case 'i': return LexKeyword(data, "i32.store", TokenType::MemoryInstr, Opcode::I32Store);
-                      default: break;
-                    }
-                    break;
-                  case 'r': return LexKeyword(data, "f32.floor", Opcode::F32Floor);
-                  default: break;
-                }
-                break;
-              case '1': return LexKeyword(data, "i32.store16", TokenType::MemoryInstr, Opcode::I32Store16);
-              case '8': return LexKeyword(data, "i32.store8", TokenType::MemoryInstr, Opcode::I32Store8);
-              case 'c':
-                switch (PeekChar(data, 15)) {
-                  default: return LexKeyword(data, "i32.atomic.load", TokenType::MemoryInstr, Opcode::I32AtomicLoad, Features::Threads);
-                  case '.':
-                    switch (PeekChar(data, 17)) {
-                      case 'c': return LexKeyword(data, "i32.atomic.rmw8.xchg_u", TokenType::MemoryInstr, Opcode::I32AtomicRmw8XchgU, Features::Threads);
-                      case 'd': return LexKeyword(data, "i32.atomic.rmw8.add_u", TokenType::MemoryInstr, Opcode::I32AtomicRmw8AddU, Features::Threads);
-                      case 'm': return LexKeyword(data, "i32.atomic.rmw8.cmpxchg_u", TokenType::MemoryInstr, Opcode::I32AtomicRmw8CmpxchgU, Features::Threads);
-                      case 'n': return LexKeyword(data, "i32.atomic.rmw8.and_u", TokenType::MemoryInstr, Opcode::I32AtomicRmw8AndU, Features::Threads);
-                      case 'o': return LexKeyword(data, "i32.atomic.rmw8.xor_u", TokenType::MemoryInstr, Opcode::I32AtomicRmw8XorU, Features::Threads);
-                      case 'r': return LexKeyword(data, "i32.atomic.rmw8.or_u", TokenType::MemoryInstr, Opcode::I32AtomicRmw8OrU, Features::Threads);
-                      case 'u': return LexKeyword(data, "i32.atomic.rmw8.sub_u", TokenType::MemoryInstr, Opcode::I32AtomicRmw8SubU, Features::Threads);
-                      default: break;
-                    }
-                    break;
-                  case '1': return LexKeyword(data, "i32.atomic.load16_u", TokenType::MemoryInstr, Opcode::I32AtomicLoad16U, Features::Threads);
-                  case '6':
-                    switch (PeekChar(data, 18)) {
-                      case 'c': return LexKeyword(data, "i32.atomic.rmw16.xchg_u", TokenType::MemoryInstr, Opcode::I32AtomicRmw16XchgU, Features::Threads);
-                      case 'd': return LexKeyword(data, "i32.atomic.rmw16.add_u", TokenType::MemoryInstr, Opcode::I32AtomicRmw16AddU, Features::Threads);
-                      case 'm': return LexKeyword(data, "i32.atomic.rmw16.cmpxchg_u", TokenType::MemoryInstr, Opcode::I32AtomicRmw16CmpxchgU, Features::Threads);
-                      case 'n': return LexKeyword(data, "i32.atomic.rmw16.and_u", TokenType::MemoryInstr, Opcode::I32AtomicRmw16AndU, Features::Threads);
-                      case 'o': return LexKeyword(data, "i32.atomic.rmw16.xor_u", TokenType::MemoryInstr, Opcode::I32AtomicRmw16XorU, Features::Threads);
-                      case 'r': return LexKeyword(data, "i32.atomic.rmw16.or_u", TokenType::MemoryInstr, Opcode::I32AtomicRmw16OrU, Features::Threads);
-                      case 'u': return LexKeyword(data, "i32.atomic.rmw16.sub_u", TokenType::MemoryInstr, Opcode::I32AtomicRmw16SubU, Features::Threads);
-                      default: break;
-                    }
-                    break;
-                  case '8': return LexKeyword(data, "i32.atomic.load8_u", TokenType::MemoryInstr, Opcode::I32AtomicLoad8U, Features::Threads);
-                  case 'a':
-                    switch (PeekChar(data, 16)) {
-                      case 'd': return LexKeyword(data, "i32.atomic.rmw.add", TokenType::MemoryInstr, Opcode::I32AtomicRmwAdd, Features::Threads);
-                      case 'n': return LexKeyword(data, "i32.atomic.rmw.and", TokenType::MemoryInstr, Opcode::I32AtomicRmwAnd, Features::Threads);
-                      default: break;
-                    }
-                    break;
-                  case 'c': return LexKeyword(data, "i32.atomic.rmw.cmpxchg", TokenType::MemoryInstr, Opcode::I32AtomicRmwCmpxchg, Features::Threads);
-                  case 'e':
-                    switch (PeekChar(data, 16)) {
-                      default: return LexKeyword(data, "i32.atomic.store", TokenType::MemoryInstr, Opcode::I32AtomicStore, Features::Threads);
-                      case '1': return LexKeyword(data, "i32.atomic.store16", TokenType::MemoryInstr, Opcode::I32AtomicStore16, Features::Threads);
-                      case '8': return LexKeyword(data, "i32.atomic.store8", TokenType::MemoryInstr, Opcode::I32AtomicStore8, Features::Threads);
-                    }
-                    break;
-                  case 'o': return LexKeyword(data, "i32.atomic.rmw.or", TokenType::MemoryInstr, Opcode::I32AtomicRmwOr, Features::Threads);
-                  case 's': return LexKeyword(data, "i32.atomic.rmw.sub", TokenType::MemoryInstr, Opcode::I32AtomicRmwSub, Features::Threads);
-                  case 'x':
-                    switch (PeekChar(data, 18)) {
-                      default: return LexKeyword(data, "i32.atomic.rmw.xor", TokenType::MemoryInstr, Opcode::I32AtomicRmwXor, Features::Threads);
-                      case 'g': return LexKeyword(data, "i32.atomic.rmw.xchg", TokenType::MemoryInstr, Opcode::I32AtomicRmwXchg, Features::Threads);
-                    }
-                    break;
-                }
-                break;
-            }
-            break;
-          case 'p':
-            switch (PeekChar(data, 10)) {
-              default: return LexKeyword(data, "i32.popcnt", Opcode::I32Popcnt);
-              case 'g': return LexKeyword(data, "f32.copysign", Opcode::F32Copysign);
-            }
-            break;
-          case 'r':
-            switch (PeekChar(data, 7)) {
-              default: return LexKeyword(data, "i32.xor", Opcode::I32Xor);
-              case '_':
-                switch (PeekChar(data, 8)) {
-                  case 's': return LexKeyword(data, "i32.shr_s", Opcode::I32ShrS);
-                  case 'u': return LexKeyword(data, "i32.shr_u", Opcode::I32ShrU);
-                  default: break;
-                }
-                break;
-              case 't': return LexKeyword(data, "f32.sqrt", Opcode::F32Sqrt);
-            }
-            break;
-          case 's': return LexKeyword(data, "f32.abs", Opcode::F32Abs);
-          case 't':
-            switch (PeekChar(data, 7)) {
-              case 'e':
-                switch (PeekChar(data, 13)) {
-                  default: return LexKeyword(data, "i32.extend8_s", Opcode::I32Extend8S, Features::SignExtension);
-                  case 's': return LexKeyword(data, "i32.extend16_s", Opcode::I32Extend16S, Features::SignExtension);
-                }
-                break;
-              case 'l': return LexKeyword(data, "i32.rotl", Opcode::I32Rotl);
-              case 'r': return LexKeyword(data, "i32.rotr", Opcode::I32Rotr);
-              default: break;
-            }
-            break;
-          case 'u':
-            switch (PeekChar(data, 9)) {
-              default: return LexKeyword(data, "f32.trunc", Opcode::F32Trunc);
-              case '_':
-                switch (PeekChar(data, 14)) {
-                  case '2':
-                    switch (PeekChar(data, 10)) {
-                      case 's': return LexKeyword(data, "i32.trunc_s/f32", Opcode::I32TruncF32S);
-                      case 'u': return LexKeyword(data, "i32.trunc_u/f32", Opcode::I32TruncF32U);
-                      default: break;
-                    }
-                    break;
-                  case '4':
-                    switch (PeekChar(data, 10)) {
-                      case 's': return LexKeyword(data, "i32.trunc_s/f64", Opcode::I32TruncF64S);
-                      case 'u': return LexKeyword(data, "i32.trunc_u/f64", Opcode::I32TruncF64U);
-                      default: break;
-                    }
-                    break;
-                  case 'f':
-                    switch (PeekChar(data, 18)) {
-                      case 's':
-                        switch (PeekChar(data, 16)) {
-                          case '2': return LexKeyword(data, "i32.trunc_sat_f32_s", Opcode::I32TruncSatF32S, Features::SaturatingFloatToInt);
-                          case '4': return LexKeyword(data, "i32.trunc_sat_f64_s", Opcode::I32TruncSatF64S, Features::SaturatingFloatToInt);
-                          default: break;
-                        }
-                        break;
-                      case 'u':
-                        switch (PeekChar(data, 16)) {
-                          case '2': return LexKeyword(data, "i32.trunc_sat_f32_u", Opcode::I32TruncSatF32U, Features::SaturatingFloatToInt);
-                          case '4': return LexKeyword(data, "i32.trunc_sat_f64_u", Opcode::I32TruncSatF64U, Features::SaturatingFloatToInt);
-                          default: break;
-                        }
-                        break;
-                      default: break;
-                    }
-                    break;
-                  case 's':
-                    switch (PeekChar(data, 12)) {
-                      case '2': return LexKeyword(data, "i32.trunc_f32_s", Opcode::I32TruncF32S);
-                      case '4': return LexKeyword(data, "i32.trunc_f64_s", Opcode::I32TruncF64S);
-                      default: break;
-                    }
-                    break;
-                  case 't':
-                    switch (PeekChar(data, 18)) {
-                      case '2':
-                        switch (PeekChar(data, 10)) {
-                          case 's': return LexKeyword(data, "i32.trunc_s:sat/f32", Opcode::I32TruncSatF32S, Features::SaturatingFloatToInt);
-                          case 'u': return LexKeyword(data, "i32.trunc_u:sat/f32", Opcode::I32TruncSatF32U, Features::SaturatingFloatToInt);
-                          default: break;
-                        }
-                        break;
-                      case '4':
-                        switch (PeekChar(data, 10)) {
-                          case 's': return LexKeyword(data, "i32.trunc_s:sat/f64", Opcode::I32TruncSatF64S, Features::SaturatingFloatToInt);
-                          case 'u': return LexKeyword(data, "i32.trunc_u:sat/f64", Opcode::I32TruncSatF64U, Features::SaturatingFloatToInt);
-                          default: break;
-                        }
-                        break;
-                      default: break;
-                    }
-                    break;
-                  case 'u':
-                    switch (PeekChar(data, 12)) {
-                      case '2': return LexKeyword(data, "i32.trunc_f32_u", Opcode::I32TruncF32U);
-                      case '4': return LexKeyword(data, "i32.trunc_f64_u", Opcode::I32TruncF64U);
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-            }
-            break;
-          case 'v':
-            switch (PeekChar(data, 7)) {
-              default: return LexKeyword(data, "f32.div", Opcode::F32Div);
-              case '_':
-                switch (PeekChar(data, 8)) {
-                  case 's': return LexKeyword(data, "i32.div_s", Opcode::I32DivS);
-                  case 'u': return LexKeyword(data, "i32.div_u", Opcode::I32DivU);
-                  default: break;
-                }
-                break;
-            }
-            break;
-          case 'x': return LexKeyword(data, "f32.max", Opcode::F32Max);
-          case 'z':
-            switch (PeekChar(data, 5)) {
-              case 'l': return LexKeyword(data, "i32.clz", Opcode::I32Clz);
-              case 'q': return LexKeyword(data, "i32.eqz", Opcode::I32Eqz);
-              case 't': return LexKeyword(data, "i32.ctz", Opcode::I32Ctz);
-              default: break;
-            }
-            break;
-        }
-        break;
-      case '8':
-        switch (PeekChar(data, 4)) {
-          default: return LexKeyword(data, "v128", NumericType::V128);
-          case '.':
-            switch (PeekChar(data, 5)) {
-              case 'a':
-                switch (PeekChar(data, 8)) {
-                  default: return LexKeyword(data, "v128.and", Opcode::V128And, Features::Simd);
-                  case 'n': return LexKeyword(data, "v128.andnot", Opcode::V128Andnot, Features::Simd);
-                }
-                break;
-              case 'b': return LexKeyword(data, "v128.bitselect", Opcode::V128BitSelect, Features::Simd);
-              case 'c': return LexKeyword(data, "v128.const", TokenType::SimdConstInstr, Opcode::V128Const, Features::Simd);
-              case 'l':
-                switch (PeekChar(data, 9)) {
-                  default: return LexKeyword(data, "v128.load", TokenType::MemoryInstr, Opcode::V128Load, Features::Simd);
-                  case '1':
-                    switch (PeekChar(data, 14)) {
-                      case 'l': return LexKeyword(data, "v128.load16_splat", TokenType::MemoryInstr, Opcode::V128Load16Splat, Features::Simd);
-                      case 's': return LexKeyword(data, "v128.load16x4_s", TokenType::MemoryInstr, Opcode::V128Load16X4S, Features::Simd);
-                      case 'u': return LexKeyword(data, "v128.load16x4_u", TokenType::MemoryInstr, Opcode::V128Load16X4U, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case '3':
-                    switch (PeekChar(data, 14)) {
-                      case 'l': return LexKeyword(data, "v128.load32_splat", TokenType::MemoryInstr, Opcode::V128Load32Splat, Features::Simd);
-                      case 'r': return LexKeyword(data, "v128.load32_zero", TokenType::MemoryInstr, Opcode::V128Load32Zero, Features::Simd);
-                      case 's': return LexKeyword(data, "v128.load32x2_s", TokenType::MemoryInstr, Opcode::V128Load32X2S, Features::Simd);
-                      case 'u': return LexKeyword(data, "v128.load32x2_u", TokenType::MemoryInstr, Opcode::V128Load32X2U, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case '6':
-                    switch (PeekChar(data, 16)) {
-                      default: return LexKeyword(data, "v128.load64_zero", TokenType::MemoryInstr, Opcode::V128Load64Zero, Features::Simd);
-                      case 't': return LexKeyword(data, "v128.load64_splat", TokenType::MemoryInstr, Opcode::V128Load64Splat, Features::Simd);
-                    }
-                    break;
-                  case '8':
-                    switch (PeekChar(data, 13)) {
-                      case 'l': return LexKeyword(data, "v128.load8_splat", TokenType::MemoryInstr, Opcode::V128Load8Splat, Features::Simd);
-                      case 's': return LexKeyword(data, "v128.load8x8_s", TokenType::MemoryInstr, Opcode::V128Load8X8S, Features::Simd);
-                      case 'u': return LexKeyword(data, "v128.load8x8_u", TokenType::MemoryInstr, Opcode::V128Load8X8U, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                }
-                break;
-              case 'n': return LexKeyword(data, "v128.not", Opcode::V128Not, Features::Simd);
-              case 'o': return LexKeyword(data, "v128.or", Opcode::V128Or, Features::Simd);
-              case 's': return LexKeyword(data, "v128.store", TokenType::MemoryInstr, Opcode::V128Store, Features::Simd);
-              case 'x': return LexKeyword(data, "v128.xor", Opcode::V128Xor, Features::Simd);
-              default: break;
-            }
-            break;
-        }
-        break;
-      case 'x':
-        switch (PeekChar(data, 5)) {
-          default:
-            switch (PeekChar(data, 0)) {
-              case 'f': return LexKeyword(data, "f32x4", SimdShape::F32X4);
-              case 'i': return LexKeyword(data, "i32x4", SimdShape::I32X4);
-              default: break;
-            }
-            break;
-          case '.':
-            switch (PeekChar(data, 8)) {
-              default:
-                switch (PeekChar(data, 6)) {
-                  case 'e':
-                    switch (PeekChar(data, 0)) {
-                      case 'f': return LexKeyword(data, "f32x4.eq", Opcode::F32X4Eq, Features::Simd);
-                      case 'i': return LexKeyword(data, "i32x4.eq", Opcode::I32X4Eq, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case 'g':
-                    switch (PeekChar(data, 7)) {
-                      case 'e': return LexKeyword(data, "f32x4.ge", Opcode::F32X4Ge, Features::Simd);
-                      case 't': return LexKeyword(data, "f32x4.gt", Opcode::F32X4Gt, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case 'l':
-                    switch (PeekChar(data, 7)) {
-                      case 'e': return LexKeyword(data, "f32x4.le", Opcode::F32X4Le, Features::Simd);
-                      case 't': return LexKeyword(data, "f32x4.lt", Opcode::F32X4Lt, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case 'n':
-                    switch (PeekChar(data, 0)) {
-                      case 'f': return LexKeyword(data, "f32x4.ne", Opcode::F32X4Ne, Features::Simd);
-                      case 'i': return LexKeyword(data, "i32x4.ne", Opcode::I32X4Ne, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-              case '_':
-                switch (PeekChar(data, 9)) {
-                  case 's':
-                    switch (PeekChar(data, 7)) {
-                      case 'e':
-                        switch (PeekChar(data, 6)) {
-                          case 'g': return LexKeyword(data, "i32x4.ge_s", Opcode::I32X4GeS, Features::Simd);
-                          case 'l': return LexKeyword(data, "i32x4.le_s", Opcode::I32X4LeS, Features::Simd);
-                          default: break;
-                        }
-                        break;
-                      case 't':
-                        switch (PeekChar(data, 6)) {
-                          case 'g': return LexKeyword(data, "i32x4.gt_s", Opcode::I32X4GtS, Features::Simd);
-                          case 'l': return LexKeyword(data, "i32x4.lt_s", Opcode::I32X4LtS, Features::Simd);
-                          default: break;
-                        }
-                        break;
-                      default: break;
-                    }
-                    break;
-                  case 'u':
-                    switch (PeekChar(data, 7)) {
-                      case 'e':
-                        switch (PeekChar(data, 6)) {
-                          case 'g': return LexKeyword(data, "i32x4.ge_u", Opcode::I32X4GeU, Features::Simd);
-                          case 'l': return LexKeyword(data, "i32x4.le_u", Opcode::I32X4LeU, Features::Simd);
-                          default: break;
-                        }
-                        break;
-                      case 't':
-                        switch (PeekChar(data, 6)) {
-                          case 'g': return LexKeyword(data, "i32x4.gt_u", Opcode::I32X4GtU, Features::Simd);
-                          case 'l': return LexKeyword(data, "i32x4.lt_u", Opcode::I32X4LtU, Features::Simd);
-                          default: break;
-                        }
-                        break;
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-              case 'a':
-                switch (PeekChar(data, 10)) {
-                  default: return LexKeyword(data, "f32x4.pmax", Opcode::F32X4Pmax, Features::Simd);
-                  case 'e': return LexKeyword(data, "f32x4.nearest", Opcode::F32X4Nearest, Features::Simd);
-                }
-                break;
-              case 'b':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f32x4.sub", Opcode::F32X4Sub, Features::Simd);
-                  case 'i': return LexKeyword(data, "i32x4.sub", Opcode::I32X4Sub, Features::Simd);
-                  default: break;
-                }
-                break;
-              case 'd':
-                switch (PeekChar(data, 9)) {
-                  default:
-                    switch (PeekChar(data, 0)) {
-                      case 'f': return LexKeyword(data, "f32x4.add", Opcode::F32X4Add, Features::Simd);
-                      case 'i': return LexKeyword(data, "i32x4.add", Opcode::I32X4Add, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case 'e':
-                    switch (PeekChar(data, 23)) {
-                      default:
-                        switch (PeekChar(data, 22)) {
-                          case 's': return LexKeyword(data, "i32x4.widen_low_i16x8_s", Opcode::I32X4WidenLowI16X8S, Features::Simd);
-                          case 'u': return LexKeyword(data, "i32x4.widen_low_i16x8_u", Opcode::I32X4WidenLowI16X8U, Features::Simd);
-                          default: break;
-                        }
-                        break;
-                      case 's': return LexKeyword(data, "i32x4.widen_high_i16x8_s", Opcode::I32X4WidenHighI16X8S, Features::Simd);
-                      case 'u': return LexKeyword(data, "i32x4.widen_high_i16x8_u", Opcode::I32X4WidenHighI16X8U, Features::Simd);
-                    }
-                    break;
-                }
-                break;
-              case 'g':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f32x4.neg", Opcode::F32X4Neg, Features::Simd);
-                  case 'i': return LexKeyword(data, "i32x4.neg", Opcode::I32X4Neg, Features::Simd);
-                  default: break;
-                }
-                break;
-              case 'i':
-                switch (PeekChar(data, 9)) {
-                  case 'l': return LexKeyword(data, "f32x4.ceil", Opcode::F32X4Ceil, Features::Simd);
-                  case 'n': return LexKeyword(data, "f32x4.pmin", Opcode::F32X4Pmin, Features::Simd);
-                  default: break;
-                }
-                break;
-              case 'l':
-                switch (PeekChar(data, 7)) {
-                  case 'h': return LexKeyword(data, "i32x4.shl", Opcode::I32X4Shl, Features::Simd);
-                  case 'l': return LexKeyword(data, "i32x4.all_true", Opcode::I32X4AllTrue, Features::Simd);
-                  case 'p':
-                    switch (PeekChar(data, 0)) {
-                      case 'f': return LexKeyword(data, "f32x4.splat", Opcode::F32X4Splat, Features::Simd);
-                      case 'i': return LexKeyword(data, "i32x4.splat", Opcode::I32X4Splat, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case 'u':
-                    switch (PeekChar(data, 0)) {
-                      case 'f': return LexKeyword(data, "f32x4.mul", Opcode::F32X4Mul, Features::Simd);
-                      case 'i': return LexKeyword(data, "i32x4.mul", Opcode::I32X4Mul, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-              case 'n':
-                switch (PeekChar(data, 9)) {
-                  default: return LexKeyword(data, "f32x4.min", Opcode::F32X4Min, Features::Simd);
-                  case '_':
-                    switch (PeekChar(data, 10)) {
-                      case 's': return LexKeyword(data, "i32x4.min_s", Opcode::I32X4MinS, Features::Simd);
-                      case 'u': return LexKeyword(data, "i32x4.min_u", Opcode::I32X4MinU, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case 'v':
-                    switch (PeekChar(data, 20)) {
-                      case 's': return LexKeyword(data, "f32x4.convert_i32x4_s", Opcode::F32X4ConvertI32X4S, Features::Simd);
-                      case 'u': return LexKeyword(data, "f32x4.convert_i32x4_u", Opcode::F32X4ConvertI32X4U, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                }
-                break;
-              case 'o': return LexKeyword(data, "f32x4.floor", Opcode::F32X4Floor, Features::Simd);
-              case 'p':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f32x4.replace_lane", TokenType::SimdLaneInstr, Opcode::F32X4ReplaceLane, Features::Simd);
-                  case 'i': return LexKeyword(data, "i32x4.replace_lane", TokenType::SimdLaneInstr, Opcode::I32X4ReplaceLane, Features::Simd);
-                  default: break;
-                }
-                break;
-              case 'r':
-                switch (PeekChar(data, 10)) {
-                  default: return LexKeyword(data, "f32x4.sqrt", Opcode::F32X4Sqrt, Features::Simd);
-                  case 's': return LexKeyword(data, "i32x4.shr_s", Opcode::I32X4ShrS, Features::Simd);
-                  case 'u': return LexKeyword(data, "i32x4.shr_u", Opcode::I32X4ShrU, Features::Simd);
-                }
-                break;
-              case 's':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f32x4.abs", Opcode::F32X4Abs, Features::Simd);
-                  case 'i': return LexKeyword(data, "i32x4.abs", Opcode::I32X4Abs, Features::Simd);
-                  default: break;
-                }
-                break;
-              case 't':
-                switch (PeekChar(data, 13)) {
-                  default: return LexKeyword(data, "i32x4.bitmask", Opcode::I32X4Bitmask, Features::Simd);
-                  case '_':
-                    switch (PeekChar(data, 0)) {
-                      case 'f': return LexKeyword(data, "f32x4.extract_lane", TokenType::SimdLaneInstr, Opcode::F32X4ExtractLane, Features::Simd);
-                      case 'i': return LexKeyword(data, "i32x4.extract_lane", TokenType::SimdLaneInstr, Opcode::I32X4ExtractLane, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case 'x': return LexKeyword(data, "i32x4.dot_i16x8_s", Opcode::I32X4DotI16X8S, Features::Simd);
-                }
-                break;
-              case 'u':
-                switch (PeekChar(data, 11)) {
-                  default: return LexKeyword(data, "f32x4.trunc", Opcode::F32X4Trunc, Features::Simd);
-                  case '_':
-                    switch (PeekChar(data, 22)) {
-                      case 's': return LexKeyword(data, "i32x4.trunc_sat_f32x4_s", Opcode::I32X4TruncSatF32X4S, Features::Simd);
-                      case 'u': return LexKeyword(data, "i32x4.trunc_sat_f32x4_u", Opcode::I32X4TruncSatF32X4U, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                }
-                break;
-              case 'v': return LexKeyword(data, "f32x4.div", Opcode::F32X4Div, Features::Simd);
-              case 'x':
-                switch (PeekChar(data, 9)) {
-                  default: return LexKeyword(data, "f32x4.max", Opcode::F32X4Max, Features::Simd);
-                  case '_':
-                    switch (PeekChar(data, 10)) {
-                      case 's': return LexKeyword(data, "i32x4.max_s", Opcode::I32X4MaxS, Features::Simd);
-                      case 'u': return LexKeyword(data, "i32x4.max_u", Opcode::I32X4MaxU, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                }
-                break;
-              case 'y': return LexKeyword(data, "i32x4.any_true", Opcode::I32X4AnyTrue, Features::Simd);
-            }
-            break;
-        }
-        break;
-    }
-    break;
-  case '4':
-    switch (PeekChar(data, 3)) {
-      default:
-        switch (PeekChar(data, 0)) {
-          case 'f': return LexKeyword(data, "f64", NumericType::F64);
-          case 'i': return LexKeyword(data, "i64", NumericType::I64);
-          default: break;
-        }
-        break;
-      case '.':
-        switch (PeekChar(data, 6)) {
-          default:
-            switch (PeekChar(data, 4)) {
-              case 'e':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f64.eq", Opcode::F64Eq);
-                  case 'i': return LexKeyword(data, "i64.eq", Opcode::I64Eq);
-                  default: break;
-                }
-                break;
-              case 'g':
-                switch (PeekChar(data, 5)) {
-                  case 'e': return LexKeyword(data, "f64.ge", Opcode::F64Ge);
-                  case 't': return LexKeyword(data, "f64.gt", Opcode::F64Gt);
-                  default: break;
-                }
-                break;
-              case 'l':
-                switch (PeekChar(data, 5)) {
-                  case 'e': return LexKeyword(data, "f64.le", Opcode::F64Le);
-                  case 't': return LexKeyword(data, "f64.lt", Opcode::F64Lt);
-                  default: break;
-                }
-                break;
-              case 'n':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f64.ne", Opcode::F64Ne);
-                  case 'i': return LexKeyword(data, "i64.ne", Opcode::I64Ne);
-                  default: break;
-                }
-                break;
-              case 'o': return LexKeyword(data, "i64.or", Opcode::I64Or);
-              default: break;
-            }
-            break;
-          case '_':
-            switch (PeekChar(data, 7)) {
-              case 's':
-                switch (PeekChar(data, 5)) {
-                  case 'e':
-                    switch (PeekChar(data, 4)) {
-                      case 'g': return LexKeyword(data, "i64.ge_s", Opcode::I64GeS);
-                      case 'l': return LexKeyword(data, "i64.le_s", Opcode::I64LeS);
-                      default: break;
-                    }
-                    break;
-                  case 't':
-                    switch (PeekChar(data, 4)) {
-                      case 'g': return LexKeyword(data, "i64.gt_s", Opcode::I64GtS);
-                      case 'l': return LexKeyword(data, "i64.lt_s", Opcode::I64LtS);
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-              case 'u':
-                switch (PeekChar(data, 5)) {
-                  case 'e':
-                    switch (PeekChar(data, 4)) {
-                      case 'g': return LexKeyword(data, "i64.ge_u", Opcode::I64GeU);
-                      case 'l': return LexKeyword(data, "i64.le_u", Opcode::I64LeU);
-                      default: break;
-                    }
-                    break;
-                  case 't':
-                    switch (PeekChar(data, 4)) {
-                      case 'g': return LexKeyword(data, "i64.gt_u", Opcode::I64GtU);
-                      case 'l': return LexKeyword(data, "i64.lt_u", Opcode::I64LtU);
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-              default: break;
-            }
-            break;
-          case 'a':
-            switch (PeekChar(data, 8)) {
-              default:
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f64.load", TokenType::MemoryInstr, Opcode::F64Load);
-                  case 'i': return LexKeyword(data, "i64.load", TokenType::MemoryInstr, Opcode::I64Load);
-                  default: break;
-                }
-                break;
-              case '1':
-                switch (PeekChar(data, 11)) {
-                  case 's': return LexKeyword(data, "i64.load16_s", TokenType::MemoryInstr, Opcode::I64Load16S);
-                  case 'u': return LexKeyword(data, "i64.load16_u", TokenType::MemoryInstr, Opcode::I64Load16U);
-                  default: break;
-                }
-                break;
-              case '3':
-                switch (PeekChar(data, 11)) {
-                  case 's': return LexKeyword(data, "i64.load32_s", TokenType::MemoryInstr, Opcode::I64Load32S);
-                  case 'u': return LexKeyword(data, "i64.load32_u", TokenType::MemoryInstr, Opcode::I64Load32U);
-                  default: break;
-                }
-                break;
-              case '8':
-                switch (PeekChar(data, 10)) {
-                  case 's': return LexKeyword(data, "i64.load8_s", TokenType::MemoryInstr, Opcode::I64Load8S);
-                  case 'u': return LexKeyword(data, "i64.load8_u", TokenType::MemoryInstr, Opcode::I64Load8U);
-                  default: break;
-                }
-                break;
-              case 'e': return LexKeyword(data, "f64.nearest", Opcode::F64Nearest);
-            }
-            break;
-          case 'b':
-            switch (PeekChar(data, 0)) {
-              case 'f': return LexKeyword(data, "f64.sub", Opcode::F64Sub);
-              case 'i': return LexKeyword(data, "i64.sub", Opcode::I64Sub);
-              default: break;
-            }
-            break;
-          case 'd':
-            switch (PeekChar(data, 5)) {
-              case 'd':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f64.add", Opcode::F64Add);
-                  case 'i': return LexKeyword(data, "i64.add", Opcode::I64Add);
-                  default: break;
-                }
-                break;
-              case 'n': return LexKeyword(data, "i64.and", Opcode::I64And);
-              default: break;
-            }
-            break;
-          case 'g': return LexKeyword(data, "f64.neg", Opcode::F64Neg);
-          case 'i':
-            switch (PeekChar(data, 8)) {
-              default: return LexKeyword(data, "f64.ceil", Opcode::F64Ceil);
-              case 't':
-                switch (PeekChar(data, 16)) {
-                  case 'f':
-                    switch (PeekChar(data, 15)) {
-                      case '/': return LexKeyword(data, "i64.reinterpret/f64", Opcode::I64ReinterpretF64);
-                      case '_': return LexKeyword(data, "i64.reinterpret_f64", Opcode::I64ReinterpretF64);
-                      default: break;
-                    }
-                    break;
-                  case 'i':
-                    switch (PeekChar(data, 15)) {
-                      case '/': return LexKeyword(data, "f64.reinterpret/i64", Opcode::F64ReinterpretI64);
-                      case '_': return LexKeyword(data, "f64.reinterpret_i64", Opcode::F64ReinterpretI64);
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-            }
-            break;
-          case 'l':
-            switch (PeekChar(data, 5)) {
-              case 'h': return LexKeyword(data, "i64.shl", Opcode::I64Shl);
-              case 'u':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f64.mul", Opcode::F64Mul);
-                  case 'i': return LexKeyword(data, "i64.mul", Opcode::I64Mul);
-                  default: break;
-                }
-                break;
-              default: break;
-            }
-            break;
-          case 'm':
-            switch (PeekChar(data, 8)) {
-              case 's': return LexKeyword(data, "i64.rem_s", Opcode::I64RemS);
-              case 'u': return LexKeyword(data, "i64.rem_u", Opcode::I64RemU);
-              default: break;
-            }
-            break;
-          case 'n':
-            switch (PeekChar(data, 7)) {
-              default: return LexKeyword(data, "f64.min", Opcode::F64Min);
-              case 's':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f64.const", TokenType::F64ConstInstr, Opcode::F64Const);
-                  case 'i': return LexKeyword(data, "i64.const", TokenType::I64ConstInstr, Opcode::I64Const);
-                  default: break;
-                }
-                break;
-              case 'v':
-                switch (PeekChar(data, 16)) {
-                  case '2':
-                    switch (PeekChar(data, 12)) {
-                      case 's': return LexKeyword(data, "f64.convert_s/i32", Opcode::F64ConvertI32S);
-                      case 'u': return LexKeyword(data, "f64.convert_u/i32", Opcode::F64ConvertI32U);
-                      default: break;
-                    }
-                    break;
-                  case '4':
-                    switch (PeekChar(data, 12)) {
-                      case 's': return LexKeyword(data, "f64.convert_s/i64", Opcode::F64ConvertI64S);
-                      case 'u': return LexKeyword(data, "f64.convert_u/i64", Opcode::F64ConvertI64U);
-                      default: break;
-                    }
-                    break;
-                  case 's':
-                    switch (PeekChar(data, 14)) {
-                      case '2': return LexKeyword(data, "f64.convert_i32_s", Opcode::F64ConvertI32S);
-                      case '4': return LexKeyword(data, "f64.convert_i64_s", Opcode::F64ConvertI64S);
-                      default: break;
-                    }
-                    break;
-                  case 'u':
-                    switch (PeekChar(data, 14)) {
-                      case '2': return LexKeyword(data, "f64.convert_i32_u", Opcode::F64ConvertI32U);
-                      case '4': return LexKeyword(data, "f64.convert_i64_u", Opcode::F64ConvertI64U);
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-            }
-            break;
-          case 'o':
-            switch (PeekChar(data, 9)) {
-              default:
-                switch (PeekChar(data, 8)) {
-                  case 'e':
-                    switch (PeekChar(data, 0)) {
-                      case 'f': return LexKeyword(data, "f64.store", TokenType::MemoryInstr, Opcode::F64Store);
-                      case 'i': return LexKeyword(data, "i64.store", TokenType::MemoryInstr, Opcode::I64Store);
-                      default: break;
-                    }
-                    break;
-                  case 'r': return LexKeyword(data, "f64.floor", Opcode::F64Floor);
-                  default: break;
-                }
-                break;
-              case '1': return LexKeyword(data, "i64.store16", TokenType::MemoryInstr, Opcode::I64Store16);
-              case '3': return LexKeyword(data, "i64.store32", TokenType::MemoryInstr, Opcode::I64Store32);
-              case '8': return LexKeyword(data, "i64.store8", TokenType::MemoryInstr, Opcode::I64Store8);
-              case 'c':
-                switch (PeekChar(data, 15)) {
-                  default: return LexKeyword(data, "i64.atomic.load", TokenType::MemoryInstr, Opcode::I64AtomicLoad, Features::Threads);
-                  case '.':
-                    switch (PeekChar(data, 17)) {
-                      case 'c': return LexKeyword(data, "i64.atomic.rmw8.xchg_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw8XchgU, Features::Threads);
-                      case 'd': return LexKeyword(data, "i64.atomic.rmw8.add_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw8AddU, Features::Threads);
-                      case 'm': return LexKeyword(data, "i64.atomic.rmw8.cmpxchg_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw8CmpxchgU, Features::Threads);
-                      case 'n': return LexKeyword(data, "i64.atomic.rmw8.and_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw8AndU, Features::Threads);
-                      case 'o': return LexKeyword(data, "i64.atomic.rmw8.xor_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw8XorU, Features::Threads);
-                      case 'r': return LexKeyword(data, "i64.atomic.rmw8.or_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw8OrU, Features::Threads);
-                      case 'u': return LexKeyword(data, "i64.atomic.rmw8.sub_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw8SubU, Features::Threads);
-                      default: break;
-                    }
-                    break;
-                  case '1': return LexKeyword(data, "i64.atomic.load16_u", TokenType::MemoryInstr, Opcode::I64AtomicLoad16U, Features::Threads);
-                  case '2':
-                    switch (PeekChar(data, 18)) {
-                      case 'c': return LexKeyword(data, "i64.atomic.rmw32.xchg_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw32XchgU, Features::Threads);
-                      case 'd': return LexKeyword(data, "i64.atomic.rmw32.add_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw32AddU, Features::Threads);
-                      case 'm': return LexKeyword(data, "i64.atomic.rmw32.cmpxchg_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw32CmpxchgU, Features::Threads);
-                      case 'n': return LexKeyword(data, "i64.atomic.rmw32.and_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw32AndU, Features::Threads);
-                      case 'o': return LexKeyword(data, "i64.atomic.rmw32.xor_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw32XorU, Features::Threads);
-                      case 'r': return LexKeyword(data, "i64.atomic.rmw32.or_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw32OrU, Features::Threads);
-                      case 'u': return LexKeyword(data, "i64.atomic.rmw32.sub_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw32SubU, Features::Threads);
-                      default: break;
-                    }
-                    break;
-                  case '3': return LexKeyword(data, "i64.atomic.load32_u", TokenType::MemoryInstr, Opcode::I64AtomicLoad32U, Features::Threads);
-                  case '6':
-                    switch (PeekChar(data, 18)) {
-                      case 'c': return LexKeyword(data, "i64.atomic.rmw16.xchg_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw16XchgU, Features::Threads);
-                      case 'd': return LexKeyword(data, "i64.atomic.rmw16.add_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw16AddU, Features::Threads);
-                      case 'm': return LexKeyword(data, "i64.atomic.rmw16.cmpxchg_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw16CmpxchgU, Features::Threads);
-                      case 'n': return LexKeyword(data, "i64.atomic.rmw16.and_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw16AndU, Features::Threads);
-                      case 'o': return LexKeyword(data, "i64.atomic.rmw16.xor_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw16XorU, Features::Threads);
-                      case 'r': return LexKeyword(data, "i64.atomic.rmw16.or_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw16OrU, Features::Threads);
-                      case 'u': return LexKeyword(data, "i64.atomic.rmw16.sub_u", TokenType::MemoryInstr, Opcode::I64AtomicRmw16SubU, Features::Threads);
-                      default: break;
-                    }
-                    break;
-                  case '8': return LexKeyword(data, "i64.atomic.load8_u", TokenType::MemoryInstr, Opcode::I64AtomicLoad8U, Features::Threads);
-                  case 'a':
-                    switch (PeekChar(data, 16)) {
-                      case 'd': return LexKeyword(data, "i64.atomic.rmw.add", TokenType::MemoryInstr, Opcode::I64AtomicRmwAdd, Features::Threads);
-                      case 'n': return LexKeyword(data, "i64.atomic.rmw.and", TokenType::MemoryInstr, Opcode::I64AtomicRmwAnd, Features::Threads);
-                      default: break;
-                    }
-                    break;
-                  case 'c': return LexKeyword(data, "i64.atomic.rmw.cmpxchg", TokenType::MemoryInstr, Opcode::I64AtomicRmwCmpxchg, Features::Threads);
-                  case 'e':
-                    switch (PeekChar(data, 16)) {
-                      default: return LexKeyword(data, "i64.atomic.store", TokenType::MemoryInstr, Opcode::I64AtomicStore, Features::Threads);
-                      case '1': return LexKeyword(data, "i64.atomic.store16", TokenType::MemoryInstr, Opcode::I64AtomicStore16, Features::Threads);
-                      case '3': return LexKeyword(data, "i64.atomic.store32", TokenType::MemoryInstr, Opcode::I64AtomicStore32, Features::Threads);
-                      case '8': return LexKeyword(data, "i64.atomic.store8", TokenType::MemoryInstr, Opcode::I64AtomicStore8, Features::Threads);
-                    }
-                    break;
-                  case 'o': return LexKeyword(data, "i64.atomic.rmw.or", TokenType::MemoryInstr, Opcode::I64AtomicRmwOr, Features::Threads);
-                  case 's': return LexKeyword(data, "i64.atomic.rmw.sub", TokenType::MemoryInstr, Opcode::I64AtomicRmwSub, Features::Threads);
-                  case 'x':
-                    switch (PeekChar(data, 18)) {
-                      default: return LexKeyword(data, "i64.atomic.rmw.xor", TokenType::MemoryInstr, Opcode::I64AtomicRmwXor, Features::Threads);
-                      case 'g': return LexKeyword(data, "i64.atomic.rmw.xchg", TokenType::MemoryInstr, Opcode::I64AtomicRmwXchg, Features::Threads);
-                    }
-                    break;
-                }
-                break;
-              case 't':
-                switch (PeekChar(data, 11)) {
-                  case '/': return LexKeyword(data, "f64.promote/f32", Opcode::F64PromoteF32);
-                  case '_': return LexKeyword(data, "f64.promote_f32", Opcode::F64PromoteF32);
-                  default: break;
-                }
-                break;
-            }
-            break;
-          case 'p':
-            switch (PeekChar(data, 10)) {
-              default: return LexKeyword(data, "i64.popcnt", Opcode::I64Popcnt);
-              case 'g': return LexKeyword(data, "f64.copysign", Opcode::F64Copysign);
-            }
-            break;
-          case 'r':
-            switch (PeekChar(data, 7)) {
-              default: return LexKeyword(data, "i64.xor", Opcode::I64Xor);
-              case '_':
-                switch (PeekChar(data, 8)) {
-                  case 's': return LexKeyword(data, "i64.shr_s", Opcode::I64ShrS);
-                  case 'u': return LexKeyword(data, "i64.shr_u", Opcode::I64ShrU);
-                  default: break;
-                }
-                break;
-              case 't': return LexKeyword(data, "f64.sqrt", Opcode::F64Sqrt);
-            }
-            break;
-          case 's': return LexKeyword(data, "f64.abs", Opcode::F64Abs);
-          case 't':
-            switch (PeekChar(data, 7)) {
-              case 'e':
-                switch (PeekChar(data, 11)) {
-                  case '2': return LexKeyword(data, "i64.extend32_s", Opcode::I64Extend32S, Features::SignExtension);
-                  case '6': return LexKeyword(data, "i64.extend16_s", Opcode::I64Extend16S, Features::SignExtension);
-                  case '_': return LexKeyword(data, "i64.extend8_s", Opcode::I64Extend8S, Features::SignExtension);
-                  case 'i':
-                    switch (PeekChar(data, 15)) {
-                      case 's': return LexKeyword(data, "i64.extend_i32_s", Opcode::I64ExtendI32S);
-                      case 'u': return LexKeyword(data, "i64.extend_i32_u", Opcode::I64ExtendI32U);
-                      default: break;
-                    }
-                    break;
-                  case 's': return LexKeyword(data, "i64.extend_s/i32", Opcode::I64ExtendI32S);
-                  case 'u': return LexKeyword(data, "i64.extend_u/i32", Opcode::I64ExtendI32U);
-                  default: break;
-                }
-                break;
-              case 'l': return LexKeyword(data, "i64.rotl", Opcode::I64Rotl);
-              case 'r': return LexKeyword(data, "i64.rotr", Opcode::I64Rotr);
-              default: break;
-            }
-            break;
-          case 'u':
-            switch (PeekChar(data, 9)) {
-              default: return LexKeyword(data, "f64.trunc", Opcode::F64Trunc);
-              case '_':
-                switch (PeekChar(data, 14)) {
-                  case '2':
-                    switch (PeekChar(data, 10)) {
-                      case 's': return LexKeyword(data, "i64.trunc_s/f32", Opcode::I64TruncF32S);
-                      case 'u': return LexKeyword(data, "i64.trunc_u/f32", Opcode::I64TruncF32U);
-                      default: break;
-                    }
-                    break;
-                  case '4':
-                    switch (PeekChar(data, 10)) {
-                      case 's': return LexKeyword(data, "i64.trunc_s/f64", Opcode::I64TruncF64S);
-                      case 'u': return LexKeyword(data, "i64.trunc_u/f64", Opcode::I64TruncF64U);
-                      default: break;
-                    }
-                    break;
-                  case 'f':
-                    switch (PeekChar(data, 18)) {
-                      case 's':
-                        switch (PeekChar(data, 16)) {
-                          case '2': return LexKeyword(data, "i64.trunc_sat_f32_s", Opcode::I64TruncSatF32S, Features::SaturatingFloatToInt);
-                          case '4': return LexKeyword(data, "i64.trunc_sat_f64_s", Opcode::I64TruncSatF64S, Features::SaturatingFloatToInt);
-                          default: break;
-                        }
-                        break;
-                      case 'u':
-                        switch (PeekChar(data, 16)) {
-                          case '2': return LexKeyword(data, "i64.trunc_sat_f32_u", Opcode::I64TruncSatF32U, Features::SaturatingFloatToInt);
-                          case '4': return LexKeyword(data, "i64.trunc_sat_f64_u", Opcode::I64TruncSatF64U, Features::SaturatingFloatToInt);
-                          default: break;
-                        }
-                        break;
-                      default: break;
-                    }
-                    break;
-                  case 's':
-                    switch (PeekChar(data, 12)) {
-                      case '2': return LexKeyword(data, "i64.trunc_f32_s", Opcode::I64TruncF32S);
-                      case '4': return LexKeyword(data, "i64.trunc_f64_s", Opcode::I64TruncF64S);
-                      default: break;
-                    }
-                    break;
-                  case 't':
-                    switch (PeekChar(data, 18)) {
-                      case '2':
-                        switch (PeekChar(data, 10)) {
-                          case 's': return LexKeyword(data, "i64.trunc_s:sat/f32", Opcode::I64TruncSatF32S, Features::SaturatingFloatToInt);
-                          case 'u': return LexKeyword(data, "i64.trunc_u:sat/f32", Opcode::I64TruncSatF32U, Features::SaturatingFloatToInt);
-                          default: break;
-                        }
-                        break;
-                      case '4':
-                        switch (PeekChar(data, 10)) {
-                          case 's': return LexKeyword(data, "i64.trunc_s:sat/f64", Opcode::I64TruncSatF64S, Features::SaturatingFloatToInt);
-                          case 'u': return LexKeyword(data, "i64.trunc_u:sat/f64", Opcode::I64TruncSatF64U, Features::SaturatingFloatToInt);
-                          default: break;
-                        }
-                        break;
-                      default: break;
-                    }
-                    break;
-                  case 'u':
-                    switch (PeekChar(data, 12)) {
-                      case '2': return LexKeyword(data, "i64.trunc_f32_u", Opcode::I64TruncF32U);
-                      case '4': return LexKeyword(data, "i64.trunc_f64_u", Opcode::I64TruncF64U);
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-            }
-            break;
-          case 'v':
-            switch (PeekChar(data, 7)) {
-              default: return LexKeyword(data, "f64.div", Opcode::F64Div);
-              case '_':
-                switch (PeekChar(data, 8)) {
-                  case 's': return LexKeyword(data, "i64.div_s", Opcode::I64DivS);
-                  case 'u': return LexKeyword(data, "i64.div_u", Opcode::I64DivU);
-                  default: break;
-                }
-                break;
-            }
-            break;
-          case 'x': return LexKeyword(data, "f64.max", Opcode::F64Max);
-          case 'z':
-            switch (PeekChar(data, 5)) {
-              case 'l': return LexKeyword(data, "i64.clz", Opcode::I64Clz);
-              case 'q': return LexKeyword(data, "i64.eqz", Opcode::I64Eqz);
-              case 't': return LexKeyword(data, "i64.ctz", Opcode::I64Ctz);
-              default: break;
-            }
-            break;
-        }
-        break;
-      case 'x':
-        switch (PeekChar(data, 5)) {
-          default:
-            switch (PeekChar(data, 0)) {
-              case 'f': return LexKeyword(data, "f64x2", SimdShape::F64X2);
-              case 'i': return LexKeyword(data, "i64x2", SimdShape::I64X2);
-              default: break;
-            }
-            break;
-          case '.':
-            switch (PeekChar(data, 8)) {
-              default:
-                switch (PeekChar(data, 6)) {
-                  case 'e': return LexKeyword(data, "f64x2.eq", Opcode::F64X2Eq, Features::Simd);
-                  case 'g':
-                    switch (PeekChar(data, 7)) {
-                      case 'e': return LexKeyword(data, "f64x2.ge", Opcode::F64X2Ge, Features::Simd);
-                      case 't': return LexKeyword(data, "f64x2.gt", Opcode::F64X2Gt, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case 'l':
-                    switch (PeekChar(data, 7)) {
-                      case 'e': return LexKeyword(data, "f64x2.le", Opcode::F64X2Le, Features::Simd);
-                      case 't': return LexKeyword(data, "f64x2.lt", Opcode::F64X2Lt, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case 'n': return LexKeyword(data, "f64x2.ne", Opcode::F64X2Ne, Features::Simd);
-                  default: break;
-                }
-                break;
-              case 'a':
-                switch (PeekChar(data, 10)) {
-                  default: return LexKeyword(data, "f64x2.pmax", Opcode::F64X2Pmax, Features::Simd);
-                  case 'e': return LexKeyword(data, "f64x2.nearest", Opcode::F64X2Nearest, Features::Simd);
-                }
-                break;
-              case 'b':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f64x2.sub", Opcode::F64X2Sub, Features::Simd);
-                  case 'i': return LexKeyword(data, "i64x2.sub", Opcode::I64X2Sub, Features::Simd);
-                  default: break;
-                }
-                break;
-              case 'd':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f64x2.add", Opcode::F64X2Add, Features::Simd);
-                  case 'i': return LexKeyword(data, "i64x2.add", Opcode::I64X2Add, Features::Simd);
-                  default: break;
-                }
-                break;
-              case 'g':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f64x2.neg", Opcode::F64X2Neg, Features::Simd);
-                  case 'i': return LexKeyword(data, "i64x2.neg", Opcode::I64X2Neg, Features::Simd);
-                  default: break;
-                }
-                break;
-              case 'i':
-                switch (PeekChar(data, 9)) {
-                  case 'l': return LexKeyword(data, "f64x2.ceil", Opcode::F64X2Ceil, Features::Simd);
-                  case 'n': return LexKeyword(data, "f64x2.pmin", Opcode::F64X2Pmin, Features::Simd);
-                  default: break;
-                }
-                break;
-              case 'l':
-                switch (PeekChar(data, 7)) {
-                  case 'h': return LexKeyword(data, "i64x2.shl", Opcode::I64X2Shl, Features::Simd);
-                  case 'p':
-                    switch (PeekChar(data, 0)) {
-                      case 'f': return LexKeyword(data, "f64x2.splat", Opcode::F64X2Splat, Features::Simd);
-                      case 'i': return LexKeyword(data, "i64x2.splat", Opcode::I64X2Splat, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case 'u':
-                    switch (PeekChar(data, 0)) {
-                      case 'f': return LexKeyword(data, "f64x2.mul", Opcode::F64X2Mul, Features::Simd);
-                      case 'i': return LexKeyword(data, "i64x2.mul", Opcode::I64X2Mul, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-              case 'n': return LexKeyword(data, "f64x2.min", Opcode::F64X2Min, Features::Simd);
-              case 'o': return LexKeyword(data, "f64x2.floor", Opcode::F64X2Floor, Features::Simd);
-              case 'p':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f64x2.replace_lane", TokenType::SimdLaneInstr, Opcode::F64X2ReplaceLane, Features::Simd);
-                  case 'i': return LexKeyword(data, "i64x2.replace_lane", TokenType::SimdLaneInstr, Opcode::I64X2ReplaceLane, Features::Simd);
-                  default: break;
-                }
-                break;
-              case 'r':
-                switch (PeekChar(data, 10)) {
-                  default: return LexKeyword(data, "f64x2.sqrt", Opcode::F64X2Sqrt, Features::Simd);
-                  case 's': return LexKeyword(data, "i64x2.shr_s", Opcode::I64X2ShrS, Features::Simd);
-                  case 'u': return LexKeyword(data, "i64x2.shr_u", Opcode::I64X2ShrU, Features::Simd);
-                }
-                break;
-              case 's': return LexKeyword(data, "f64x2.abs", Opcode::F64X2Abs, Features::Simd);
-              case 't':
-                switch (PeekChar(data, 0)) {
-                  case 'f': return LexKeyword(data, "f64x2.extract_lane", TokenType::SimdLaneInstr, Opcode::F64X2ExtractLane, Features::Simd);
-                  case 'i': return LexKeyword(data, "i64x2.extract_lane", TokenType::SimdLaneInstr, Opcode::I64X2ExtractLane, Features::Simd);
-                  default: break;
-                }
-                break;
-              case 'u': return LexKeyword(data, "f64x2.trunc", Opcode::F64X2Trunc, Features::Simd);
-              case 'v': return LexKeyword(data, "f64x2.div", Opcode::F64X2Div, Features::Simd);
-              case 'x': return LexKeyword(data, "f64x2.max", Opcode::F64X2Max, Features::Simd);
-            }
-            break;
-        }
-        break;
-    }
-    break;
-  case '6':
-    switch (PeekChar(data, 3)) {
-      default: return LexKeyword(data, "i16", PackedType::I16);
-      case 'x':
-        switch (PeekChar(data, 5)) {
-          default: return LexKeyword(data, "i16x8", SimdShape::I16X8);
-          case '.':
-            switch (PeekChar(data, 7)) {
-              case 'a':
-                switch (PeekChar(data, 10)) {
-                  case 'o':
-                    switch (PeekChar(data, 19)) {
-                      case 's': return LexKeyword(data, "i16x8.narrow_i32x4_s", Opcode::I16X8NarrowI32X4S, Features::Simd);
-                      case 'u': return LexKeyword(data, "i16x8.narrow_i32x4_u", Opcode::I16X8NarrowI32X4U, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case 's': return LexKeyword(data, "i16x8.max_s", Opcode::I16X8MaxS, Features::Simd);
-                  case 'u': return LexKeyword(data, "i16x8.max_u", Opcode::I16X8MaxU, Features::Simd);
-                  default: break;
-                }
-                break;
-              case 'b': return LexKeyword(data, "i16x8.abs", Opcode::I16X8Abs, Features::Simd);
-              case 'd':
-                switch (PeekChar(data, 9)) {
-                  default: return LexKeyword(data, "i16x8.add", Opcode::I16X8Add, Features::Simd);
-                  case '_':
-                    switch (PeekChar(data, 14)) {
-                      case 's': return LexKeyword(data, "i16x8.add_sat_s", Opcode::I16X8AddSatS, Features::Simd);
-                      case 'u': return LexKeyword(data, "i16x8.add_sat_u", Opcode::I16X8AddSatU, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                }
-                break;
-              case 'e':
-                switch (PeekChar(data, 8)) {
-                  default: return LexKeyword(data, "i16x8.ne", Opcode::I16X8Ne, Features::Simd);
-                  case '_':
-                    switch (PeekChar(data, 9)) {
-                      case 's':
-                        switch (PeekChar(data, 6)) {
-                          case 'g': return LexKeyword(data, "i16x8.ge_s", Opcode::I16X8GeS, Features::Simd);
-                          case 'l': return LexKeyword(data, "i16x8.le_s", Opcode::I16X8LeS, Features::Simd);
-                          default: break;
-                        }
-                        break;
-                      case 'u':
-                        switch (PeekChar(data, 6)) {
-                          case 'g': return LexKeyword(data, "i16x8.ge_u", Opcode::I16X8GeU, Features::Simd);
-                          case 'l': return LexKeyword(data, "i16x8.le_u", Opcode::I16X8LeU, Features::Simd);
-                          default: break;
-                        }
-                        break;
-                      default: break;
-                    }
-                    break;
-                  case 'g': return LexKeyword(data, "i16x8.neg", Opcode::I16X8Neg, Features::Simd);
-                  case 'p': return LexKeyword(data, "i16x8.replace_lane", TokenType::SimdLaneInstr, Opcode::I16X8ReplaceLane, Features::Simd);
-                }
-                break;
-              case 'h':
-                switch (PeekChar(data, 9)) {
-                  default: return LexKeyword(data, "i16x8.shl", Opcode::I16X8Shl, Features::Simd);
-                  case '_':
-                    switch (PeekChar(data, 10)) {
-                      case 's': return LexKeyword(data, "i16x8.shr_s", Opcode::I16X8ShrS, Features::Simd);
-                      case 'u': return LexKeyword(data, "i16x8.shr_u", Opcode::I16X8ShrU, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                }
-                break;
-              case 'i':
-                switch (PeekChar(data, 10)) {
-                  case 'a': return LexKeyword(data, "i16x8.bitmask", Opcode::I16X8Bitmask, Features::Simd);
-                  case 'n':
-                    switch (PeekChar(data, 23)) {
-                      default:
-                        switch (PeekChar(data, 22)) {
-                          case 's': return LexKeyword(data, "i16x8.widen_low_i8x16_s", Opcode::I16X8WidenLowI8X16S, Features::Simd);
-                          case 'u': return LexKeyword(data, "i16x8.widen_low_i8x16_u", Opcode::I16X8WidenLowI8X16U, Features::Simd);
-                          default: break;
-                        }
-                        break;
-                      case 's': return LexKeyword(data, "i16x8.widen_high_i8x16_s", Opcode::I16X8WidenHighI8X16S, Features::Simd);
-                      case 'u': return LexKeyword(data, "i16x8.widen_high_i8x16_u", Opcode::I16X8WidenHighI8X16U, Features::Simd);
-                    }
-                    break;
-                  case 's': return LexKeyword(data, "i16x8.min_s", Opcode::I16X8MinS, Features::Simd);
-                  case 'u': return LexKeyword(data, "i16x8.min_u", Opcode::I16X8MinU, Features::Simd);
-                  default: break;
-                }
-                break;
-              case 'l': return LexKeyword(data, "i16x8.all_true", Opcode::I16X8AllTrue, Features::Simd);
-              case 'n': return LexKeyword(data, "i16x8.any_true", Opcode::I16X8AnyTrue, Features::Simd);
-              case 'p': return LexKeyword(data, "i16x8.splat", Opcode::I16X8Splat, Features::Simd);
-              case 'q': return LexKeyword(data, "i16x8.eq", Opcode::I16X8Eq, Features::Simd);
-              case 't':
-                switch (PeekChar(data, 9)) {
-                  case 's':
-                    switch (PeekChar(data, 6)) {
-                      case 'g': return LexKeyword(data, "i16x8.gt_s", Opcode::I16X8GtS, Features::Simd);
-                      case 'l': return LexKeyword(data, "i16x8.lt_s", Opcode::I16X8LtS, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case 'u':
-                    switch (PeekChar(data, 6)) {
-                      case 'g': return LexKeyword(data, "i16x8.gt_u", Opcode::I16X8GtU, Features::Simd);
-                      case 'l': return LexKeyword(data, "i16x8.lt_u", Opcode::I16X8LtU, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-              case 'u':
-                switch (PeekChar(data, 9)) {
-                  default:
-                    switch (PeekChar(data, 8)) {
-                      case 'b': return LexKeyword(data, "i16x8.sub", Opcode::I16X8Sub, Features::Simd);
-                      case 'l': return LexKeyword(data, "i16x8.mul", Opcode::I16X8Mul, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case '_':
-                    switch (PeekChar(data, 14)) {
-                      case 's': return LexKeyword(data, "i16x8.sub_sat_s", Opcode::I16X8SubSatS, Features::Simd);
-                      case 'u': return LexKeyword(data, "i16x8.sub_sat_u", Opcode::I16X8SubSatU, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                }
-                break;
-              case 'v': return LexKeyword(data, "i16x8.avgr_u", Opcode::I16X8AvgrU, Features::Simd);
-              case 'x':
-                switch (PeekChar(data, 19)) {
-                  case 's': return LexKeyword(data, "i16x8.extract_lane_s", TokenType::SimdLaneInstr, Opcode::I16X8ExtractLaneS, Features::Simd);
-                  case 'u': return LexKeyword(data, "i16x8.extract_lane_u", TokenType::SimdLaneInstr, Opcode::I16X8ExtractLaneU, Features::Simd);
-                  default: break;
-                }
-                break;
-              default: break;
-            }
-            break;
-        }
-        break;
-    }
-    break;
-  case '_':
-    switch (PeekChar(data, 5)) {
-      default: return LexKeyword(data, "br_if", TokenType::VarInstr, Opcode::BrIf);
-      case '_':
-        switch (PeekChar(data, 9)) {
-          default: return LexKeyword(data, "br_on_exn", TokenType::BrOnExnInstr, Opcode::BrOnExn, Features::Exceptions);
-          case 'l': return LexKeyword(data, "br_on_null", TokenType::VarInstr, Opcode::BrOnNull, Features::FunctionReferences);
-          case 't': return LexKeyword(data, "br_on_cast", TokenType::BrOnCastInstr, Opcode::BrOnCast, Features::GC);
-        }
-        break;
-      case 'b': return LexKeyword(data, "br_table", TokenType::BrTableInstr, Opcode::BrTable);
-    }
-    break;
-  case 'a':
-    switch (PeekChar(data, 5)) {
-      default: return LexKeyword(data, "start", TokenType::Start);
-      case 'd': return LexKeyword(data, "shared", TokenType::Shared);
-    }
-    break;
-  case 'b':
-    switch (PeekChar(data, 5)) {
-      default: return LexKeyword(data, "table", TokenType::Table);
-      case '.':
-        switch (PeekChar(data, 9)) {
-          default:
-            switch (PeekChar(data, 6)) {
-              case 'g': return LexKeyword(data, "table.get", TokenType::VarInstr, Opcode::TableGet, Features::ReferenceTypes);
-              case 's': return LexKeyword(data, "table.set", TokenType::VarInstr, Opcode::TableSet, Features::ReferenceTypes);
-              default: break;
-            }
-            break;
-          case 'e': return LexKeyword(data, "table.size", TokenType::VarInstr, Opcode::TableSize, Features::ReferenceTypes);
-          case 'l': return LexKeyword(data, "table.fill", TokenType::VarInstr, Opcode::TableFill, Features::ReferenceTypes);
-          case 't': return LexKeyword(data, "table.init", TokenType::TableInitInstr, Opcode::TableInit, Features::BulkMemory);
-          case 'w': return LexKeyword(data, "table.grow", TokenType::VarInstr, Opcode::TableGrow, Features::ReferenceTypes);
-          case 'y': return LexKeyword(data, "table.copy", TokenType::TableCopyInstr, Opcode::TableCopy, Features::BulkMemory);
-        }
-        break;
-    }
-    break;
-  case 'c':
-    switch (PeekChar(data, 5)) {
-      default: return LexKeyword(data, "local", TokenType::Local);
-      case '.':
-        switch (PeekChar(data, 6)) {
-          case 'g': return LexKeyword(data, "local.get", TokenType::VarInstr, Opcode::LocalGet);
-          case 's': return LexKeyword(data, "local.set", TokenType::VarInstr, Opcode::LocalSet);
-          case 't': return LexKeyword(data, "local.tee", TokenType::VarInstr, Opcode::LocalTee);
-          default: break;
-        }
-        break;
-      case 'r': return LexKeyword(data, "declare", TokenType::Declare);
-    }
-    break;
-  case 'd':
-    switch (PeekChar(data, 3)) {
-      default: return LexKeyword(data, "end", TokenType::End, Opcode::End);
-      case 'u': return LexKeyword(data, "module", TokenType::Module);
-    }
-    break;
-  case 'e':
-    switch (PeekChar(data, 1)) {
-      case 'e': return LexKeyword(data, "tee_local", TokenType::VarInstr, Opcode::LocalTee);
-      case 'h': return LexKeyword(data, "then", TokenType::Then);
-      case 'i': return LexKeyword(data, "field", TokenType::Field);
-      case 'l':
-        switch (PeekChar(data, 4)) {
-          default: return LexKeyword(data, "elem", TokenType::Elem);
-          case '.': return LexKeyword(data, "elem.drop", TokenType::VarInstr, Opcode::ElemDrop, Features::BulkMemory);
-        }
-        break;
-      case 't': return LexKeyword(data, "item", TokenType::Item);
-      case 'v': return LexKeyword(data, "event", TokenType::Event);
-      default: break;
-    }
-    break;
-  case 'f':
-    switch (PeekChar(data, 3)) {
-      default:
-        switch (PeekChar(data, 1)) {
-          case 'e': return LexKeyword(data, "ref", TokenType::Ref);
-          case 'n': return LexKeyword(data, "inf", TokenType::Float, LiteralKind::Infinity);
-          default: break;
-        }
-        break;
-      case '.':
-        switch (PeekChar(data, 4)) {
-          case 'a': return LexKeyword(data, "ref.as_non_null", Opcode::RefAsNonNull, Features::FunctionReferences);
-          case 'c': return LexKeyword(data, "ref.cast", TokenType::HeapType2Instr, Opcode::RefCast, Features::GC);
-          case 'e':
-            switch (PeekChar(data, 6)) {
-              default: return LexKeyword(data, "ref.eq", Opcode::RefEq, Features::GC);
-              case 't': return LexKeyword(data, "ref.extern", TokenType::RefExtern);
-            }
-            break;
-          case 'f': return LexKeyword(data, "ref.func", TokenType::RefFuncInstr, Opcode::RefFunc, Features::ReferenceTypes);
-          case 'i': return LexKeyword(data, "ref.is_null", Opcode::RefIsNull, Features::ReferenceTypes);
-          case 'n': return LexKeyword(data, "ref.null", TokenType::RefNullInstr, Opcode::RefNull, Features::ReferenceTypes);
-          case 't': return LexKeyword(data, "ref.test", TokenType::HeapType2Instr, Opcode::RefTest, Features::GC);
-          default: break;
-        }
-        break;
-      case 's':
-        switch (PeekChar(data, 6)) {
-          default: return LexKeyword(data, "offset", TokenType::Offset);
-          case '=': return LexNameEqNum(data, "offset=", TokenType::OffsetEqNat);
-        }
-        break;
-    }
-    break;
-  case 'g': return LexKeyword(data, "register", TokenType::Register);
-  case 'i': return LexNameEqNum(data, "align=", TokenType::AlignEqNat);
-  case 'l':
-    switch (PeekChar(data, 4)) {
-      default:
-        switch (PeekChar(data, 1)) {
-          case 'a': return LexKeyword(data, "call", TokenType::VarInstr, Opcode::Call);
-          case 'u': return LexKeyword(data, "null", TokenType::Null);
-          default: break;
-        }
-        break;
-      case '_':
-        switch (PeekChar(data, 8)) {
-          default: return LexKeyword(data, "call_ref", Opcode::CallRef, Features::FunctionReferences);
-          case 'i': return LexKeyword(data, "call_indirect", TokenType::CallIndirectInstr, Opcode::CallIndirect);
-        }
-        break;
-      case 'c': return LexKeyword(data, "select", TokenType::SelectInstr, Opcode::Select);
-    }
-    break;
-  case 'm':
-    switch (PeekChar(data, 6)) {
-      default: return LexKeyword(data, "memory", TokenType::Memory);
-      case '.':
-        switch (PeekChar(data, 10)) {
-          case 'e': return LexKeyword(data, "memory.size", Opcode::MemorySize);
-          case 'l': return LexKeyword(data, "memory.fill", Opcode::MemoryFill, Features::BulkMemory);
-          case 'm':
-            switch (PeekChar(data, 19)) {
-              case '2': return LexKeyword(data, "memory.atomic.wait32", TokenType::MemoryInstr, Opcode::MemoryAtomicWait32, Features::Threads);
-              case '4': return LexKeyword(data, "memory.atomic.wait64", TokenType::MemoryInstr, Opcode::MemoryAtomicWait64, Features::Threads);
-              case 'y': return LexKeyword(data, "memory.atomic.notify", TokenType::MemoryInstr, Opcode::MemoryAtomicNotify, Features::Threads);
-              default: break;
-            }
-            break;
-          case 't': return LexKeyword(data, "memory.init", TokenType::MemoryInitInstr, Opcode::MemoryInit, Features::BulkMemory);
-          case 'w': return LexKeyword(data, "memory.grow", Opcode::MemoryGrow);
-          case 'y': return LexKeyword(data, "memory.copy", TokenType::MemoryCopyInstr, Opcode::MemoryCopy, Features::BulkMemory);
-          default: break;
-        }
-        break;
-    }
-    break;
-  case 'n':
-    switch (PeekChar(data, 3)) {
-      default:
-        switch (PeekChar(data, 1)) {
-          case 'a': return LexKeyword(data, "nan", TokenType::Float, LiteralKind::Nan);
-          case 'x': return LexKeyword(data, "exn", TokenType::HeapKind, HeapKind::Exn);
-          default: break;
-        }
-        break;
-      case ':':
-        switch (PeekChar(data, 6)) {
-          default: return LexNan(data);
-          case 'i': return LexKeyword(data, "nan:arithmetic", TokenType::NanArithmetic);
-          case 'n': return LexKeyword(data, "nan:canonical", TokenType::NanCanonical);
-        }
-        break;
-      case 'a': return LexKeyword(data, "binary", TokenType::Binary);
-      case 'c':
-        switch (PeekChar(data, 4)) {
-          default: return LexKeyword(data, "func", TokenType::Func, HeapKind::Func);
-          case '.': return LexKeyword(data, "func.bind", TokenType::FuncBindInstr, Opcode::FuncBind, Features::FunctionReferences);
-          case 'r': return LexKeyword(data, "funcref", ReferenceKind::Funcref);
-        }
-        break;
-      case 'r': return LexKeyword(data, "exnref", ReferenceKind::Exnref);
-    }
-    break;
-  case 'o':
-    switch (PeekChar(data, 4)) {
-      default:
-        switch (PeekChar(data, 1)) {
-          case 'o': return LexKeyword(data, "loop", TokenType::BlockInstr, Opcode::Loop);
-          case 'r': return LexKeyword(data, "drop", Opcode::Drop);
-          default: break;
-        }
-        break;
-      case '_': return LexKeyword(data, "grow_memory", Opcode::MemoryGrow);
-      case 'a':
-        switch (PeekChar(data, 6)) {
-          default: return LexKeyword(data, "global", TokenType::Global);
-          case '.':
-            switch (PeekChar(data, 7)) {
-              case 'g': return LexKeyword(data, "global.get", TokenType::VarInstr, Opcode::GlobalGet);
-              case 's': return LexKeyword(data, "global.set", TokenType::VarInstr, Opcode::GlobalSet);
-              default: break;
-            }
-            break;
-        }
-        break;
-      case 'e': return LexKeyword(data, "quote", TokenType::Quote);
-      case 'k': return LexKeyword(data, "block", TokenType::BlockInstr, Opcode::Block);
-    }
-    break;
-  case 'p':
-    switch (PeekChar(data, 1)) {
-      case 'm': return LexKeyword(data, "import", TokenType::Import);
-      case 'o': return LexKeyword(data, "nop", Opcode::Nop);
-      case 'x': return LexKeyword(data, "export", TokenType::Export);
-      case 'y': return LexKeyword(data, "type", TokenType::Type);
-      default: break;
-    }
-    break;
-  case 'r':
-    switch (PeekChar(data, 4)) {
-      case 'a': return LexKeyword(data, "unreachable", Opcode::Unreachable);
-      case 'c':
-        switch (PeekChar(data, 6)) {
-          default: return LexKeyword(data, "struct", TokenType::Struct);
-          case '.':
-            switch (PeekChar(data, 7)) {
-              case 'g':
-                switch (PeekChar(data, 10)) {
-                  default: return LexKeyword(data, "struct.get", TokenType::StructFieldInstr, Opcode::StructGet, Features::GC);
-                  case '_':
-                    switch (PeekChar(data, 11)) {
-                      case 's': return LexKeyword(data, "struct.get_s", TokenType::StructFieldInstr, Opcode::StructGetS, Features::GC);
-                      case 'u': return LexKeyword(data, "struct.get_u", TokenType::StructFieldInstr, Opcode::StructGetU, Features::GC);
-                      default: break;
-                    }
-                    break;
-                }
-                break;
-              case 'n':
-                switch (PeekChar(data, 19)) {
-                  default: return LexKeyword(data, "struct.new_with_rtt", TokenType::VarInstr, Opcode::StructNewWithRtt, Features::GC);
-                  case 'w': return LexKeyword(data, "struct.new_default_with_rtt", TokenType::VarInstr, Opcode::StructNewDefaultWithRtt, Features::GC);
-                }
-                break;
-              case 's': return LexKeyword(data, "struct.set", TokenType::StructFieldInstr, Opcode::StructSet, Features::GC);
-              default: break;
-            }
-            break;
-        }
-        break;
-      case 'e': return LexKeyword(data, "current_memory", Opcode::MemorySize);
-      case 'f': return LexKeyword(data, "eqref", ReferenceKind::Eqref);
-      case 'm': return LexKeyword(data, "param", TokenType::Param);
-      case 'w': return LexKeyword(data, "throw", TokenType::VarInstr, Opcode::Throw, Features::Exceptions);
-      case 'y':
-        switch (PeekChar(data, 5)) {
-          default: return LexKeyword(data, "array", TokenType::Array);
-          case '.':
-            switch (PeekChar(data, 6)) {
-              case 'g':
-                switch (PeekChar(data, 9)) {
-                  default: return LexKeyword(data, "array.get", TokenType::VarInstr, Opcode::ArrayGet, Features::GC);
-                  case '_':
-                    switch (PeekChar(data, 10)) {
-                      case 's': return LexKeyword(data, "array.get_s", TokenType::VarInstr, Opcode::ArrayGetS, Features::GC);
-                      case 'u': return LexKeyword(data, "array.get_u", TokenType::VarInstr, Opcode::ArrayGetU, Features::GC);
-                      default: break;
-                    }
-                    break;
-                }
-                break;
-              case 'l': return LexKeyword(data, "array.len", TokenType::VarInstr, Opcode::ArrayLen, Features::GC);
-              case 'n':
-                switch (PeekChar(data, 18)) {
-                  default: return LexKeyword(data, "array.new_with_rtt", TokenType::VarInstr, Opcode::ArrayNewWithRtt, Features::GC);
-                  case 'w': return LexKeyword(data, "array.new_default_with_rtt", TokenType::VarInstr, Opcode::ArrayNewDefaultWithRtt, Features::GC);
-                }
-                break;
-              case 's': return LexKeyword(data, "array.set", TokenType::VarInstr, Opcode::ArraySet, Features::GC);
-              default: break;
-            }
-            break;
-        }
-        break;
-      default: break;
-    }
-    break;
-  case 's':
-    switch (PeekChar(data, 4)) {
-      default: return LexKeyword(data, "else", TokenType::Else, Opcode::Else);
-      case 'l': return LexKeyword(data, "result", TokenType::Result);
-      case 'r':
-        switch (PeekChar(data, 11)) {
-          default: return LexKeyword(data, "assert_trap", TokenType::AssertTrap);
-          case 'l': return LexKeyword(data, "assert_invalid", TokenType::AssertInvalid);
-          case 'n': return LexKeyword(data, "assert_unlinkable", TokenType::AssertUnlinkable);
-          case 'o': return LexKeyword(data, "assert_malformed", TokenType::AssertMalformed);
-          case 'r': return LexKeyword(data, "assert_return", TokenType::AssertReturn);
-          case 'u': return LexKeyword(data, "assert_exhaustion", TokenType::AssertExhaustion);
-        }
-        break;
-    }
-    break;
-  case 't':
-    switch (PeekChar(data, 3)) {
-      default:
-        switch (PeekChar(data, 0)) {
-          case 'g': return LexKeyword(data, "get", TokenType::Get);
-          case 'l': return LexKeyword(data, "let", TokenType::LetInstr, Opcode::Let, Features::FunctionReferences);
-          case 'm': return LexKeyword(data, "mut", TokenType::Mut);
-          case 'r': return LexKeyword(data, "rtt", TokenType::Rtt);
-          default: break;
-        }
-        break;
-      case '.':
-        switch (PeekChar(data, 7)) {
-          default: return LexKeyword(data, "rtt.sub", TokenType::RttSubInstr, Opcode::RttSub, Features::GC);
-          case 'o': return LexKeyword(data, "rtt.canon", TokenType::HeapTypeInstr, Opcode::RttCanon, Features::GC);
-        }
-        break;
-      case '_':
-        switch (PeekChar(data, 9)) {
-          default:
-            switch (PeekChar(data, 0)) {
-              case 'g': return LexKeyword(data, "get_local", TokenType::VarInstr, Opcode::LocalGet);
-              case 's': return LexKeyword(data, "set_local", TokenType::VarInstr, Opcode::LocalSet);
-              default: break;
-            }
-            break;
-          case 'l':
-            switch (PeekChar(data, 0)) {
-              case 'g': return LexKeyword(data, "get_global", TokenType::VarInstr, Opcode::GlobalGet);
-              case 's': return LexKeyword(data, "set_global", TokenType::VarInstr, Opcode::GlobalSet);
-              default: break;
-            }
-            break;
-        }
-        break;
-      case 'a':
-        switch (PeekChar(data, 4)) {
-          default: return LexKeyword(data, "data", TokenType::Data);
-          case '.': return LexKeyword(data, "data.drop", TokenType::VarInstr, Opcode::DataDrop, Features::BulkMemory);
-        }
-        break;
-      case 'c': return LexKeyword(data, "catch", TokenType::Catch, Opcode::Catch);
-      case 'e':
-        switch (PeekChar(data, 6)) {
-          default: return LexKeyword(data, "extern", TokenType::HeapKind, HeapKind::Extern);
-          case 'r': return LexKeyword(data, "externref", ReferenceKind::Externref);
-        }
-        break;
-      case 'h': return LexKeyword(data, "rethrow", Opcode::Rethrow, Features::Exceptions);
-      case 'u':
-        switch (PeekChar(data, 6)) {
-          default: return LexKeyword(data, "return", Opcode::Return);
-          case '_':
-            switch (PeekChar(data, 11)) {
-              default: return LexKeyword(data, "return_call", TokenType::VarInstr, Opcode::ReturnCall, Features::TailCall);
-              case '_':
-                switch (PeekChar(data, 15)) {
-                  default: return LexKeyword(data, "return_call_ref", Opcode::ReturnCallRef, Features::FunctionReferences);
-                  case 'i': return LexKeyword(data, "return_call_indirect", TokenType::CallIndirectInstr, Opcode::ReturnCallIndirect, Features::TailCall);
-                }
-                break;
-            }
-            break;
-        }
-        break;
-    }
-    break;
-  case 'v': return LexKeyword(data, "invoke", TokenType::Invoke);
-  case 'x':
-    switch (PeekChar(data, 5)) {
-      default: return LexKeyword(data, "i8x16", SimdShape::I8X16);
-      case '.':
-        switch (PeekChar(data, 8)) {
-          default:
-            switch (PeekChar(data, 7)) {
-              case 'e': return LexKeyword(data, "i8x16.ne", Opcode::I8X16Ne, Features::Simd);
-              case 'q': return LexKeyword(data, "i8x16.eq", Opcode::I8X16Eq, Features::Simd);
-              default: break;
-            }
-            break;
-          case '_':
-            switch (PeekChar(data, 9)) {
-              case 's':
-                switch (PeekChar(data, 7)) {
-                  case 'e':
-                    switch (PeekChar(data, 6)) {
-                      case 'g': return LexKeyword(data, "i8x16.ge_s", Opcode::I8X16GeS, Features::Simd);
-                      case 'l': return LexKeyword(data, "i8x16.le_s", Opcode::I8X16LeS, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case 't':
-                    switch (PeekChar(data, 6)) {
-                      case 'g': return LexKeyword(data, "i8x16.gt_s", Opcode::I8X16GtS, Features::Simd);
-                      case 'l': return LexKeyword(data, "i8x16.lt_s", Opcode::I8X16LtS, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-              case 'u':
-                switch (PeekChar(data, 7)) {
-                  case 'e':
-                    switch (PeekChar(data, 6)) {
-                      case 'g': return LexKeyword(data, "i8x16.ge_u", Opcode::I8X16GeU, Features::Simd);
-                      case 'l': return LexKeyword(data, "i8x16.le_u", Opcode::I8X16LeU, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  case 't':
-                    switch (PeekChar(data, 6)) {
-                      case 'g': return LexKeyword(data, "i8x16.gt_u", Opcode::I8X16GtU, Features::Simd);
-                      case 'l': return LexKeyword(data, "i8x16.lt_u", Opcode::I8X16LtU, Features::Simd);
-                      default: break;
-                    }
-                    break;
-                  default: break;
-                }
-                break;
-              default: break;
-            }
-            break;
-          case 'b':
-            switch (PeekChar(data, 9)) {
-              default: return LexKeyword(data, "i8x16.sub", Opcode::I8X16Sub, Features::Simd);
-              case '_':
-                switch (PeekChar(data, 14)) {
-                  case 's': return LexKeyword(data, "i8x16.sub_sat_s", Opcode::I8X16SubSatS, Features::Simd);
-                  case 'u': return LexKeyword(data, "i8x16.sub_sat_u", Opcode::I8X16SubSatU, Features::Simd);
-                  default: break;
-                }
-                break;
-            }
-            break;
-          case 'd':
-            switch (PeekChar(data, 9)) {
-              default: return LexKeyword(data, "i8x16.add", Opcode::I8X16Add, Features::Simd);
-              case '_':
-                switch (PeekChar(data, 14)) {
-                  case 's': return LexKeyword(data, "i8x16.add_sat_s", Opcode::I8X16AddSatS, Features::Simd);
-                  case 'u': return LexKeyword(data, "i8x16.add_sat_u", Opcode::I8X16AddSatU, Features::Simd);
-                  default: break;
-                }
-                break;
-            }
-            break;
-          case 'g':
-            switch (PeekChar(data, 9)) {
-              default: return LexKeyword(data, "i8x16.neg", Opcode::I8X16Neg, Features::Simd);
-              case 'r': return LexKeyword(data, "i8x16.avgr_u", Opcode::I8X16AvgrU, Features::Simd);
-            }
-            break;
-          case 'i': return LexKeyword(data, "i8x16.swizzle", Opcode::I8X16Swizzle, Features::Simd);
-          case 'l':
-            switch (PeekChar(data, 9)) {
-              default: return LexKeyword(data, "i8x16.shl", Opcode::I8X16Shl, Features::Simd);
-              case '_': return LexKeyword(data, "i8x16.all_true", Opcode::I8X16AllTrue, Features::Simd);
-              case 'a': return LexKeyword(data, "i8x16.splat", Opcode::I8X16Splat, Features::Simd);
-            }
-            break;
-          case 'n':
-            switch (PeekChar(data, 10)) {
-              case 's': return LexKeyword(data, "i8x16.min_s", Opcode::I8X16MinS, Features::Simd);
-              case 'u': return LexKeyword(data, "i8x16.min_u", Opcode::I8X16MinU, Features::Simd);
-              default: break;
-            }
-            break;
-          case 'p': return LexKeyword(data, "i8x16.replace_lane", TokenType::SimdLaneInstr, Opcode::I8X16ReplaceLane, Features::Simd);
-          case 'r':
-            switch (PeekChar(data, 10)) {
-              case 'o':
-                switch (PeekChar(data, 19)) {
-                  case 's': return LexKeyword(data, "i8x16.narrow_i16x8_s", Opcode::I8X16NarrowI16X8S, Features::Simd);
-                  case 'u': return LexKeyword(data, "i8x16.narrow_i16x8_u", Opcode::I8X16NarrowI16X8U, Features::Simd);
-                  default: break;
-                }
-                break;
-              case 's': return LexKeyword(data, "i8x16.shr_s", Opcode::I8X16ShrS, Features::Simd);
-              case 'u': return LexKeyword(data, "i8x16.shr_u", Opcode::I8X16ShrU, Features::Simd);
-              default: break;
-            }
-            break;
-          case 's': return LexKeyword(data, "i8x16.abs", Opcode::I8X16Abs, Features::Simd);
-          case 't':
-            switch (PeekChar(data, 13)) {
-              default: return LexKeyword(data, "i8x16.bitmask", Opcode::I8X16Bitmask, Features::Simd);
-              case '_':
-                switch (PeekChar(data, 19)) {
-                  case 's': return LexKeyword(data, "i8x16.extract_lane_s", TokenType::SimdLaneInstr, Opcode::I8X16ExtractLaneS, Features::Simd);
-                  case 'u': return LexKeyword(data, "i8x16.extract_lane_u", TokenType::SimdLaneInstr, Opcode::I8X16ExtractLaneU, Features::Simd);
-                  default: break;
-                }
-                break;
-            }
-            break;
-          case 'u': return LexKeyword(data, "i8x16.shuffle", TokenType::SimdShuffleInstr, Opcode::I8X16Shuffle, Features::Simd);
-          case 'x':
-            switch (PeekChar(data, 10)) {
-              case 's': return LexKeyword(data, "i8x16.max_s", Opcode::I8X16MaxS, Features::Simd);
-              case 'u': return LexKeyword(data, "i8x16.max_u", Opcode::I8X16MaxU, Features::Simd);
-              default: break;
-            }
-            break;
-          case 'y': return LexKeyword(data, "i8x16.any_true", Opcode::I8X16AnyTrue, Features::Simd);
-        }
-        break;
-    }
-    break;
-  case 'y':
-    switch (PeekChar(data, 3)) {
-      default:
-        switch (PeekChar(data, 1)) {
-          case 'n': return LexKeyword(data, "any", TokenType::HeapKind, HeapKind::Any);
-          case 'r': return LexKeyword(data, "try", TokenType::BlockInstr, Opcode::Try, Features::Exceptions);
-          default: break;
-        }
-        break;
-      case 'f': return LexKeyword(data, "anyfunc", ReferenceKind::Funcref);
-      case 'r': return LexKeyword(data, "anyref", ReferenceKind::Anyref);
-    }
-    break;
-}
-break;
+// Generated by gen-keywords.py from keywords.txt. Do not edit.
+
+constexpr u32 kKeywordCount = 602;
+constexpr u32 kKeywordBucketCount = 301;
+
+constexpr u16 kKeywordDisplacements[] = {
+    0, 5, 14, 14, 44, 0, 17, 20, 8, 3,
+    9, 28, 13, 24, 0, 13, 0, 0, 6, 0,
+    1, 0, 0, 1, 0, 0, 0, 7, 29, 10,
+    72, 0, 9, 1, 0, 18, 4, 2, 0, 48,
+    15, 12, 1, 55, 8, 1, 3, 1, 18, 6,
+    2, 9, 10, 5, 1, 3, 22, 3, 8, 1,
+    6, 1, 6, 4, 11, 8, 0, 0, 1, 6,
+    0, 0, 216, 0, 1, 17, 91, 29, 0, 3,
+    3, 14, 6, 50, 10, 14, 0, 0, 3, 9,
+    0, 25, 0, 16, 19, 19, 22, 9, 1, 4,
+    15, 14, 0, 70, 353, 0, 65, 28, 10, 5,
+    21, 1, 20, 12, 1, 6, 17, 4, 5, 2,
+    6, 24, 11, 156, 17, 61, 1, 41, 0, 0,
+    1, 7, 16, 2, 2, 0, 0, 0, 0, 5,
+    1, 0, 86, 0, 0, 30, 5, 6, 14, 0,
+    9, 19, 15, 0, 11, 8, 0, 30, 15, 1,
+    31, 0, 1, 10, 2, 0, 0, 14, 0, 1,
+    0, 4, 0, 22, 8, 65, 3, 16, 9, 5,
+    5, 14, 2, 0, 1, 27, 1, 13, 7, 11,
+    2, 22, 2, 4, 13, 0, 0, 6, 4, 0,
+    13, 30, 43, 1, 3, 0, 85, 0, 6, 0,
+    0, 1, 47, 2, 5, 49, 175, 1, 6, 6,
+    80, 0, 2, 10, 31, 0, 1, 0, 30, 34,
+    59, 11, 0, 0, 3, 82, 7, 3, 0, 4,
+    12, 0, 9, 13, 0, 20, 0, 0, 16, 9,
+    10, 0, 0, 2, 14, 0, 4, 0, 3, 0,
+    0, 2, 2, 9, 0, 5, 3, 0, 0, 0,
+    1, 3, 0, 0, 106, 37, 0, 0, 0, 0,
+    36, 0, 13, 10, 41, 0, 6, 26, 13, 0,
+    0, 6, 4, 5, 8, 3, 1, 27, 0, 11,
+    0,
+};
+
+constexpr Keyword kKeywords[] = {
+    {"f32.eq", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Eq), 0},
+    {"i64.atomic.rmw32.or_u", 21, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw32OrU), Features::Threads},
+    {"v128.load32x2_s", 15, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::V128Load32X2S), Features::Simd},
+    {"i16x8.ge_u", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8GeU), Features::Simd},
+    {"v128.load8_splat", 16, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::V128Load8Splat), Features::Simd},
+    {"eqref", 5, TokenType::ReferenceKind, KeywordImmediate::ReferenceKind, u32(ReferenceKind::Eqref), 0},
+    {"i8x16.bitmask", 13, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16Bitmask), Features::Simd},
+    {"array", 5, TokenType::Array, KeywordImmediate::None, 0, 0},
+    {"i8x16.neg", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16Neg), Features::Simd},
+    {"f64.promote_f32", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64PromoteF32), 0},
+    {"i32x4.gt_s", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4GtS), Features::Simd},
+    {"local.set", 9, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::LocalSet), 0},
+    {"i32.wrap_i64", 12, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32WrapI64), 0},
+    {"f32x4.min", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Min), Features::Simd},
+    {"table.set", 9, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::TableSet), Features::ReferenceTypes},
+    {"func", 4, TokenType::Func, KeywordImmediate::HeapKind, u32(HeapKind::Func), 0},
+    {"f32.trunc", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Trunc), 0},
+    {"f32.ge", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Ge), 0},
+    {"i32.atomic.rmw16.xor_u", 22, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmw16XorU), Features::Threads},
+    {"f64x2.abs", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Abs), Features::Simd},
+    {"i8x16.gt_s", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16GtS), Features::Simd},
+    {"exn", 3, TokenType::HeapKind, KeywordImmediate::HeapKind, u32(HeapKind::Exn), 0},
+    {"f64.reinterpret/i64", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64ReinterpretI64), 0},
+    {"i16x8.avgr_u", 12, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8AvgrU), Features::Simd},
+    {"i32.atomic.store16", 18, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicStore16), Features::Threads},
+    {"f32.ceil", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Ceil), 0},
+    {"i64.load", 8, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64Load), 0},
+    {"i8x16.shuffle", 13, TokenType::SimdShuffleInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16Shuffle), Features::Simd},
+    {"i8x16.swizzle", 13, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16Swizzle), Features::Simd},
+    {"f32x4.sub", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Sub), Features::Simd},
+    {"i32.and", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32And), 0},
+    {"i32.ge_u", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32GeU), 0},
+    {"i32x4.bitmask", 13, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4Bitmask), Features::Simd},
+    {"ref.extern", 10, TokenType::RefExtern, KeywordImmediate::None, 0, 0},
+    {"i32x4.add", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4Add), Features::Simd},
+    {"assert_exhaustion", 17, TokenType::AssertExhaustion, KeywordImmediate::None, 0, 0},
+    {"i8x16.sub_sat_u", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16SubSatU), Features::Simd},
+    {"f64x2.mul", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Mul), Features::Simd},
+    {"f64.min", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Min), 0},
+    {"i32.reinterpret/f32", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32ReinterpretF32), 0},
+    {"br_on_exn", 9, TokenType::BrOnExnInstr, KeywordImmediate::Opcode, u32(Opcode::BrOnExn), Features::Exceptions},
+    {"elem", 4, TokenType::Elem, KeywordImmediate::None, 0, 0},
+    {"i64.atomic.store8", 17, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicStore8), Features::Threads},
+    {"array.set", 9, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::ArraySet), Features::GC},
+    {"i32.trunc_u:sat/f64", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32TruncSatF64U), Features::SaturatingFloatToInt},
+    {"i64.rem_u", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64RemU), 0},
+    {"f32.convert_u/i64", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32ConvertI64U), 0},
+    {"f32.convert_u/i32", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32ConvertI32U), 0},
+    {"i64.trunc_sat_f32_s", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64TruncSatF32S), Features::SaturatingFloatToInt},
+    {"i32x4.max_u", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4MaxU), Features::Simd},
+    {"i32.atomic.rmw.xchg", 19, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmwXchg), Features::Threads},
+    {"i64.rem_s", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64RemS), 0},
+    {"i8x16.max_u", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16MaxU), Features::Simd},
+    {"f64.div", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Div), 0},
+    {"data.drop", 9, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::DataDrop), Features::BulkMemory},
+    {"i64.atomic.rmw16.xor_u", 22, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw16XorU), Features::Threads},
+    {"i32.eq", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32Eq), 0},
+    {"i32.atomic.rmw8.and_u", 21, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmw8AndU), Features::Threads},
+    {"data", 4, TokenType::Data, KeywordImmediate::None, 0, 0},
+    {"f64.trunc", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Trunc), 0},
+    {"i8x16.abs", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16Abs), Features::Simd},
+    {"i32.atomic.rmw.and", 18, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmwAnd), Features::Threads},
+    {"i32.rotl", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32Rotl), 0},
+    {"i64.atomic.load16_u", 19, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicLoad16U), Features::Threads},
+    {"i32.rotr", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32Rotr), 0},
+    {"i32.store16", 11, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32Store16), 0},
+    {"i64.trunc_f64_u", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64TruncF64U), 0},
+    {"i64.atomic.rmw32.xchg_u", 23, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw32XchgU), Features::Threads},
+    {"i64.load32_u", 12, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64Load32U), 0},
+    {"v128", 4, TokenType::NumericType, KeywordImmediate::NumericType, u32(NumericType::V128), 0},
+    {"f64x2.ge", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Ge), Features::Simd},
+    {"i64.atomic.rmw32.xor_u", 22, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw32XorU), Features::Threads},
+    {"i64.atomic.rmw32.and_u", 22, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw32AndU), Features::Threads},
+    {"i32.mul", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32Mul), 0},
+    {"f64.neg", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Neg), 0},
+    {"i32.store8", 10, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32Store8), 0},
+    {"quote", 5, TokenType::Quote, KeywordImmediate::None, 0, 0},
+    {"br_on_cast", 10, TokenType::BrOnCastInstr, KeywordImmediate::Opcode, u32(Opcode::BrOnCast), Features::GC},
+    {"f32.abs", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Abs), 0},
+    {"f32x4.eq", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Eq), Features::Simd},
+    {"f32.mul", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Mul), 0},
+    {"f32x4.div", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Div), Features::Simd},
+    {"i32.shr_s", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32ShrS), 0},
+    {"f64.abs", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Abs), 0},
+    {"ref.cast", 8, TokenType::HeapType2Instr, KeywordImmediate::Opcode, u32(Opcode::RefCast), Features::GC},
+    {"funcref", 7, TokenType::ReferenceKind, KeywordImmediate::ReferenceKind, u32(ReferenceKind::Funcref), 0},
+    {"i32.load8_u", 11, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32Load8U), 0},
+    {"tee_local", 9, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::LocalTee), 0},
+    {"f64x2.neg", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Neg), Features::Simd},
+    {"i8x16.le_s", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16LeS), Features::Simd},
+    {"shared", 6, TokenType::Shared, KeywordImmediate::None, 0, 0},
+    {"array.len", 9, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::ArrayLen), Features::GC},
+    {"i64x2.splat", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64X2Splat), Features::Simd},
+    {"i64.trunc_u:sat/f32", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64TruncSatF32U), Features::SaturatingFloatToInt},
+    {"f32.min", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Min), 0},
+    {"i64.trunc_sat_f64_s", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64TruncSatF64S), Features::SaturatingFloatToInt},
+    {"struct.get_s", 12, TokenType::StructFieldInstr, KeywordImmediate::Opcode, u32(Opcode::StructGetS), Features::GC},
+    {"i32.xor", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32Xor), 0},
+    {"ref.func", 8, TokenType::RefFuncInstr, KeywordImmediate::Opcode, u32(Opcode::RefFunc), Features::ReferenceTypes},
+    {"i16x8.replace_lane", 18, TokenType::SimdLaneInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8ReplaceLane), Features::Simd},
+    {"i32.trunc_f64_u", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32TruncF64U), 0},
+    {"f64.convert_i64_s", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64ConvertI64S), 0},
+    {"v128.andnot", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::V128Andnot), Features::Simd},
+    {"memory.atomic.wait32", 20, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::MemoryAtomicWait32), Features::Threads},
+    {"i64.rotl", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Rotl), 0},
+    {"i32.ge_s", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32GeS), 0},
+    {"i64.trunc_f32_u", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64TruncF32U), 0},
+    {"i64.mul", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Mul), 0},
+    {"i64.atomic.rmw.sub", 18, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmwSub), Features::Threads},
+    {"v128.load8x8_s", 14, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::V128Load8X8S), Features::Simd},
+    {"v128.or", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::V128Or), Features::Simd},
+    {"i8x16.sub_sat_s", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16SubSatS), Features::Simd},
+    {"i32.reinterpret_f32", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32ReinterpretF32), 0},
+    {"i32.atomic.rmw16.and_u", 22, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmw16AndU), Features::Threads},
+    {"f64.sub", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Sub), 0},
+    {"i64.div_s", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64DivS), 0},
+    {"i32.atomic.rmw8.or_u", 20, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmw8OrU), Features::Threads},
+    {"i16x8.min_s", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8MinS), Features::Simd},
+    {"current_memory", 14, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::MemorySize), 0},
+    {"i64.reinterpret/f64", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64ReinterpretF64), 0},
+    {"i32.rem_s", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32RemS), 0},
+    {"i16x8.ge_s", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8GeS), Features::Simd},
+    {"i64.shr_u", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64ShrU), 0},
+    {"i64.atomic.store32", 18, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicStore32), Features::Threads},
+    {"i32x4.widen_high_i16x8_u", 24, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4WidenHighI16X8U), Features::Simd},
+    {"i64.rotr", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Rotr), 0},
+    {"i64.and", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64And), 0},
+    {"v128.load32_zero", 16, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::V128Load32Zero), Features::Simd},
+    {"externref", 9, TokenType::ReferenceKind, KeywordImmediate::ReferenceKind, u32(ReferenceKind::Externref), 0},
+    {"inf", 3, TokenType::Float, KeywordImmediate::LiteralKind, u32(LiteralKind::Infinity), 0},
+    {"i32x4.replace_lane", 18, TokenType::SimdLaneInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4ReplaceLane), Features::Simd},
+    {"i32x4.gt_u", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4GtU), Features::Simd},
+    {"f64x2.le", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Le), Features::Simd},
+    {"i31.get_s", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I31GetS), Features::GC},
+    {"f64x2.div", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Div), Features::Simd},
+    {"let", 3, TokenType::LetInstr, KeywordImmediate::Opcode, u32(Opcode::Let), Features::FunctionReferences},
+    {"br_table", 8, TokenType::BrTableInstr, KeywordImmediate::Opcode, u32(Opcode::BrTable), 0},
+    {"f64.convert_s/i64", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64ConvertI64S), 0},
+    {"v128.const", 10, TokenType::SimdConstInstr, KeywordImmediate::Opcode, u32(Opcode::V128Const), Features::Simd},
+    {"i64.extend_u/i32", 16, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64ExtendI32U), 0},
+    {"f64x2.replace_lane", 18, TokenType::SimdLaneInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2ReplaceLane), Features::Simd},
+    {"i32.atomic.rmw16.sub_u", 22, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmw16SubU), Features::Threads},
+    {"i64.div_u", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64DivU), 0},
+    {"i64.load8_s", 11, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64Load8S), 0},
+    {"f32.convert_i32_s", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32ConvertI32S), 0},
+    {"i16x8.lt_s", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8LtS), Features::Simd},
+    {"global.get", 10, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::GlobalGet), 0},
+    {"try", 3, TokenType::BlockInstr, KeywordImmediate::Opcode, u32(Opcode::Try), Features::Exceptions},
+    {"f64.floor", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Floor), 0},
+    {"f64.convert_u/i32", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64ConvertI32U), 0},
+    {"v128.load16x4_s", 15, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::V128Load16X4S), Features::Simd},
+    {"f64x2.min", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Min), Features::Simd},
+    {"f64x2.trunc", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Trunc), Features::Simd},
+    {"struct.new_default_with_rtt", 27, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::StructNewDefaultWithRtt), Features::GC},
+    {"i16x8.extract_lane_u", 20, TokenType::SimdLaneInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8ExtractLaneU), Features::Simd},
+    {"i64.ne", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Ne), 0},
+    {"i64.load16_s", 12, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64Load16S), 0},
+    {"i64x2.replace_lane", 18, TokenType::SimdLaneInstr, KeywordImmediate::Opcode, u32(Opcode::I64X2ReplaceLane), Features::Simd},
+    {"i64x2.mul", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64X2Mul), Features::Simd},
+    {"i32.store", 9, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32Store), 0},
+    {"f64x2.gt", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Gt), Features::Simd},
+    {"f64.mul", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Mul), 0},
+    {"f32x4.gt", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Gt), Features::Simd},
+    {"i32.or", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32Or), 0},
+    {"i16x8.le_s", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8LeS), Features::Simd},
+    {"i64x2.neg", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64X2Neg), Features::Simd},
+    {"i32x4.any_true", 14, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4AnyTrue), Features::Simd},
+    {"i64.or", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Or), 0},
+    {"f64.load", 8, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::F64Load), 0},
+    {"ref.is_null", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::RefIsNull), Features::ReferenceTypes},
+    {"f32.reinterpret_i32", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32ReinterpretI32), 0},
+    {"catch", 5, TokenType::Catch, KeywordImmediate::Opcode, u32(Opcode::Catch), 0},
+    {"i8x16.ne", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16Ne), Features::Simd},
+    {"i64.load16_u", 12, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64Load16U), 0},
+    {"i32.load16_u", 12, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32Load16U), 0},
+    {"i16x8.gt_u", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8GtU), Features::Simd},
+    {"any", 3, TokenType::HeapKind, KeywordImmediate::HeapKind, u32(HeapKind::Any), 0},
+    {"f32x4.convert_i32x4_u", 21, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4ConvertI32X4U), Features::Simd},
+    {"i16x8.le_u", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8LeU), Features::Simd},
+    {"i16x8.bitmask", 13, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8Bitmask), Features::Simd},
+    {"f64.convert_u/i64", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64ConvertI64U), 0},
+    {"assert_malformed", 16, TokenType::AssertMalformed, KeywordImmediate::None, 0, 0},
+    {"return_call", 11, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::ReturnCall), Features::TailCall},
+    {"i64x2.sub", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64X2Sub), Features::Simd},
+    {"f32.ne", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Ne), 0},
+    {"i32x4.widen_high_i16x8_s", 24, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4WidenHighI16X8S), Features::Simd},
+    {"f32x4.mul", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Mul), Features::Simd},
+    {"f32x4.add", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Add), Features::Simd},
+    {"i32.trunc_sat_f64_s", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32TruncSatF64S), Features::SaturatingFloatToInt},
+    {"f32.sqrt", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Sqrt), 0},
+    {"i64.ctz", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Ctz), 0},
+    {"f64.convert_i32_s", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64ConvertI32S), 0},
+    {"v128.load16_splat", 17, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::V128Load16Splat), Features::Simd},
+    {"f32.convert_i32_u", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32ConvertI32U), 0},
+    {"f32.neg", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Neg), 0},
+    {"i32.trunc_u:sat/f32", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32TruncSatF32U), Features::SaturatingFloatToInt},
+    {"i8", 2, TokenType::PackedType, KeywordImmediate::PackedType, u32(PackedType::I8), 0},
+    {"i64.atomic.rmw16.sub_u", 22, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw16SubU), Features::Threads},
+    {"struct.get_u", 12, TokenType::StructFieldInstr, KeywordImmediate::Opcode, u32(Opcode::StructGetU), Features::GC},
+    {"i64.atomic.load8_u", 18, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicLoad8U), Features::Threads},
+    {"f32.floor", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Floor), 0},
+    {"null", 4, TokenType::Null, KeywordImmediate::None, 0, 0},
+    {"nop", 3, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::Nop), 0},
+    {"i8x16.avgr_u", 12, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16AvgrU), Features::Simd},
+    {"f32x4.nearest", 13, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Nearest), Features::Simd},
+    {"v128.load16x4_u", 15, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::V128Load16X4U), Features::Simd},
+    {"f32x4.ge", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Ge), Features::Simd},
+    {"i8x16.add", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16Add), Features::Simd},
+    {"f64.ne", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Ne), 0},
+    {"i16x8", 5, TokenType::SimdShape, KeywordImmediate::SimdShape, u32(SimdShape::I16X8), 0},
+    {"i64x2.shl", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64X2Shl), Features::Simd},
+    {"i64.popcnt", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Popcnt), 0},
+    {"f64.ceil", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Ceil), 0},
+    {"f32x4.lt", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Lt), Features::Simd},
+    {"table.size", 10, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::TableSize), Features::ReferenceTypes},
+    {"eq", 2, TokenType::HeapKind, KeywordImmediate::HeapKind, u32(HeapKind::Eq), 0},
+    {"f32.max", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Max), 0},
+    {"array.get_u", 11, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::ArrayGetU), Features::GC},
+    {"i16x8.ne", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8Ne), Features::Simd},
+    {"i64.extend_s/i32", 16, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64ExtendI32S), 0},
+    {"i32x4.dot_i16x8_s", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4DotI16X8S), Features::Simd},
+    {"i32.clz", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32Clz), 0},
+    {"i8x16.narrow_i16x8_s", 20, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16NarrowI16X8S), Features::Simd},
+    {"mut", 3, TokenType::Mut, KeywordImmediate::None, 0, 0},
+    {"f32.sub", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Sub), 0},
+    {"f32.add", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Add), 0},
+    {"v128.load64_zero", 16, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::V128Load64Zero), Features::Simd},
+    {"register", 8, TokenType::Register, KeywordImmediate::None, 0, 0},
+    {"i32.load", 8, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32Load), 0},
+    {"result", 6, TokenType::Result, KeywordImmediate::None, 0, 0},
+    {"f64.store", 9, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::F64Store), 0},
+    {"i32.atomic.rmw.or", 17, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmwOr), Features::Threads},
+    {"f64x2.sub", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Sub), Features::Simd},
+    {"i32.le_s", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32LeS), 0},
+    {"i16", 3, TokenType::PackedType, KeywordImmediate::PackedType, u32(PackedType::I16), 0},
+    {"v128.load8x8_u", 14, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::V128Load8X8U), Features::Simd},
+    {"i32x4.shr_u", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4ShrU), Features::Simd},
+    {"f32x4.neg", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Neg), Features::Simd},
+    {"i64.clz", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Clz), 0},
+    {"rtt.sub", 7, TokenType::RttSubInstr, KeywordImmediate::Opcode, u32(Opcode::RttSub), Features::GC},
+    {"i64.atomic.store", 16, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicStore), Features::Threads},
+    {"f32.load", 8, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::F32Load), 0},
+    {"i32.trunc_s:sat/f64", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32TruncSatF64S), Features::SaturatingFloatToInt},
+    {"i32.sub", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32Sub), 0},
+    {"i16x8.lt_u", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8LtU), Features::Simd},
+    {"i32.lt_u", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32LtU), 0},
+    {"f32.div", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Div), 0},
+    {"local", 5, TokenType::Local, KeywordImmediate::None, 0, 0},
+    {"i64.le_u", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64LeU), 0},
+    {"i64.atomic.rmw32.sub_u", 22, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw32SubU), Features::Threads},
+    {"i16x8.narrow_i32x4_u", 20, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8NarrowI32X4U), Features::Simd},
+    {"i64.atomic.rmw.xor", 18, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmwXor), Features::Threads},
+    {"memory.fill", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::MemoryFill), Features::BulkMemory},
+    {"i16x8.max_u", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8MaxU), Features::Simd},
+    {"i16x8.sub_sat_u", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8SubSatU), Features::Simd},
+    {"i64.atomic.rmw32.cmpxchg_u", 26, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw32CmpxchgU), Features::Threads},
+    {"f64.le", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Le), 0},
+    {"i16x8.shr_u", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8ShrU), Features::Simd},
+    {"memory.atomic.wait64", 20, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::MemoryAtomicWait64), Features::Threads},
+    {"i64.gt_s", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64GtS), 0},
+    {"i32.div_u", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32DivU), 0},
+    {"f64x2.pmin", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Pmin), Features::Simd},
+    {"i16x8.widen_high_i8x16_s", 24, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8WidenHighI8X16S), Features::Simd},
+    {"f32.gt", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Gt), 0},
+    {"array.new_default_with_rtt", 26, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::ArrayNewDefaultWithRtt), Features::GC},
+    {"set_local", 9, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::LocalSet), 0},
+    {"i8x16.add_sat_u", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16AddSatU), Features::Simd},
+    {"i64.atomic.rmw.add", 18, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmwAdd), Features::Threads},
+    {"get_local", 9, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::LocalGet), 0},
+    {"f32x4.replace_lane", 18, TokenType::SimdLaneInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4ReplaceLane), Features::Simd},
+    {"i32.trunc_s/f64", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32TruncF64S), 0},
+    {"i16x8.widen_low_i8x16_u", 23, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8WidenLowI8X16U), Features::Simd},
+    {"f64.eq", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Eq), 0},
+    {"i64.trunc_u/f32", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64TruncF32U), 0},
+    {"i64x2.add", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64X2Add), Features::Simd},
+    {"i64.atomic.rmw8.xchg_u", 22, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw8XchgU), Features::Threads},
+    {"i32.extend8_s", 13, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32Extend8S), Features::SignExtension},
+    {"i64.store8", 10, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64Store8), 0},
+    {"i32.atomic.load", 15, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicLoad), Features::Threads},
+    {"i32.atomic.store", 16, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicStore), Features::Threads},
+    {"br_if", 5, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::BrIf), 0},
+    {"ref.test", 8, TokenType::HeapType2Instr, KeywordImmediate::Opcode, u32(Opcode::RefTest), Features::GC},
+    {"i8x16.splat", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16Splat), Features::Simd},
+    {"f32.convert_s/i64", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32ConvertI64S), 0},
+    {"v128.store", 10, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::V128Store), Features::Simd},
+    {"i32x4.shr_s", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4ShrS), Features::Simd},
+    {"unreachable", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::Unreachable), 0},
+    {"f32.demote/f64", 14, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32DemoteF64), 0},
+    {"assert_return", 13, TokenType::AssertReturn, KeywordImmediate::None, 0, 0},
+    {"i32x4.ge_s", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4GeS), Features::Simd},
+    {"i32.le_u", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32LeU), 0},
+    {"memory", 6, TokenType::Memory, KeywordImmediate::None, 0, 0},
+    {"i64.extend8_s", 13, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Extend8S), Features::SignExtension},
+    {"i32.atomic.rmw.xor", 18, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmwXor), Features::Threads},
+    {"f64x2.pmax", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Pmax), Features::Simd},
+    {"i16x8.neg", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8Neg), Features::Simd},
+    {"elem.drop", 9, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::ElemDrop), Features::BulkMemory},
+    {"end", 3, TokenType::End, KeywordImmediate::Opcode, u32(Opcode::End), 0},
+    {"start", 5, TokenType::Start, KeywordImmediate::None, 0, 0},
+    {"f64.convert_i32_u", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64ConvertI32U), 0},
+    {"i16x8.abs", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8Abs), Features::Simd},
+    {"i32.atomic.rmw.add", 18, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmwAdd), Features::Threads},
+    {"f64x2.ne", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Ne), Features::Simd},
+    {"i32.ctz", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32Ctz), 0},
+    {"i8x16.any_true", 14, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16AnyTrue), Features::Simd},
+    {"i8x16.sub", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16Sub), Features::Simd},
+    {"i16x8.splat", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8Splat), Features::Simd},
+    {"global", 6, TokenType::Global, KeywordImmediate::None, 0, 0},
+    {"i64.store16", 11, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64Store16), 0},
+    {"br_on_null", 10, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::BrOnNull), Features::FunctionReferences},
+    {"i64.atomic.rmw16.cmpxchg_u", 26, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw16CmpxchgU), Features::Threads},
+    {"v128.and", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::V128And), Features::Simd},
+    {"i32.ne", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32Ne), 0},
+    {"f64.lt", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Lt), 0},
+    {"f32.store", 9, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::F32Store), 0},
+    {"i64.eq", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Eq), 0},
+    {"i32x4.all_true", 14, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4AllTrue), Features::Simd},
+    {"i32.trunc_f32_s", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32TruncF32S), 0},
+    {"f64x2.splat", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Splat), Features::Simd},
+    {"i32.trunc_s/f32", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32TruncF32S), 0},
+    {"binary", 6, TokenType::Binary, KeywordImmediate::None, 0, 0},
+    {"i8x16.min_s", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16MinS), Features::Simd},
+    {"assert_unlinkable", 17, TokenType::AssertUnlinkable, KeywordImmediate::None, 0, 0},
+    {"i16x8.min_u", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8MinU), Features::Simd},
+    {"memory.copy", 11, TokenType::MemoryCopyInstr, KeywordImmediate::Opcode, u32(Opcode::MemoryCopy), Features::BulkMemory},
+    {"i64", 3, TokenType::NumericType, KeywordImmediate::NumericType, u32(NumericType::I64), 0},
+    {"array.get", 9, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::ArrayGet), Features::GC},
+    {"f32x4.max", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Max), Features::Simd},
+    {"i64.atomic.rmw8.xor_u", 21, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw8XorU), Features::Threads},
+    {"br", 2, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::Br), 0},
+    {"i32.atomic.load16_u", 19, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicLoad16U), Features::Threads},
+    {"i64.trunc_s:sat/f64", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64TruncSatF64S), Features::SaturatingFloatToInt},
+    {"struct.new_with_rtt", 19, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::StructNewWithRtt), Features::GC},
+    {"exnref", 6, TokenType::ReferenceKind, KeywordImmediate::ReferenceKind, u32(ReferenceKind::Exnref), 0},
+    {"i16x8.widen_high_i8x16_u", 24, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8WidenHighI8X16U), Features::Simd},
+    {"f32x4.floor", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Floor), Features::Simd},
+    {"import", 6, TokenType::Import, KeywordImmediate::None, 0, 0},
+    {"i64.store", 9, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64Store), 0},
+    {"i64.atomic.rmw16.and_u", 22, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw16AndU), Features::Threads},
+    {"i32x4.min_u", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4MinU), Features::Simd},
+    {"drop", 4, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::Drop), 0},
+    {"i64.trunc_s/f32", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64TruncF32S), 0},
+    {"i32.const", 9, TokenType::I32ConstInstr, KeywordImmediate::Opcode, u32(Opcode::I32Const), 0},
+    {"else", 4, TokenType::Else, KeywordImmediate::Opcode, u32(Opcode::Else), 0},
+    {"i64.trunc_u/f64", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64TruncF64U), 0},
+    {"i32.atomic.rmw8.add_u", 21, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmw8AddU), Features::Threads},
+    {"i8x16.lt_u", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16LtU), Features::Simd},
+    {"f32x4.trunc", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Trunc), Features::Simd},
+    {"i32.atomic.rmw16.add_u", 22, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmw16AddU), Features::Threads},
+    {"i32.extend16_s", 14, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32Extend16S), Features::SignExtension},
+    {"i32x4.lt_u", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4LtU), Features::Simd},
+    {"nan:arithmetic", 14, TokenType::NanArithmetic, KeywordImmediate::None, 0, 0},
+    {"i32.popcnt", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32Popcnt), 0},
+    {"i64.atomic.rmw32.add_u", 22, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw32AddU), Features::Threads},
+    {"i64.lt_u", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64LtU), 0},
+    {"extern", 6, TokenType::HeapKind, KeywordImmediate::HeapKind, u32(HeapKind::Extern), 0},
+    {"f32.convert_s/i32", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32ConvertI32S), 0},
+    {"i64.trunc_sat_f64_u", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64TruncSatF64U), Features::SaturatingFloatToInt},
+    {"i64.atomic.rmw8.sub_u", 21, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw8SubU), Features::Threads},
+    {"i32.eqz", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32Eqz), 0},
+    {"i64.atomic.rmw8.or_u", 20, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw8OrU), Features::Threads},
+    {"func.bind", 9, TokenType::FuncBindInstr, KeywordImmediate::Opcode, u32(Opcode::FuncBind), Features::FunctionReferences},
+    {"i64.le_s", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64LeS), 0},
+    {"i8x16.max_s", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16MaxS), Features::Simd},
+    {"return", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::Return), 0},
+    {"global.set", 10, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::GlobalSet), 0},
+    {"i64.trunc_u:sat/f64", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64TruncSatF64U), Features::SaturatingFloatToInt},
+    {"i32x4.le_u", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4LeU), Features::Simd},
+    {"call_indirect", 13, TokenType::CallIndirectInstr, KeywordImmediate::Opcode, u32(Opcode::CallIndirect), 0},
+    {"i64.const", 9, TokenType::I64ConstInstr, KeywordImmediate::Opcode, u32(Opcode::I64Const), 0},
+    {"offset", 6, TokenType::Offset, KeywordImmediate::None, 0, 0},
+    {"f32.convert_i64_u", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32ConvertI64U), 0},
+    {"i32.div_s", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32DivS), 0},
+    {"f64.nearest", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Nearest), 0},
+    {"f64.convert_s/i32", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64ConvertI32S), 0},
+    {"i64.trunc_s/f64", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64TruncF64S), 0},
+    {"i8x16.ge_u", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16GeU), Features::Simd},
+    {"v128.load64_splat", 17, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::V128Load64Splat), Features::Simd},
+    {"i64.shr_s", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64ShrS), 0},
+    {"throw", 5, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::Throw), Features::Exceptions},
+    {"struct.get", 10, TokenType::StructFieldInstr, KeywordImmediate::Opcode, u32(Opcode::StructGet), Features::GC},
+    {"rethrow", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::Rethrow), Features::Exceptions},
+    {"i64.atomic.rmw16.add_u", 22, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw16AddU), Features::Threads},
+    {"i8x16.replace_lane", 18, TokenType::SimdLaneInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16ReplaceLane), Features::Simd},
+    {"f64x2.ceil", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Ceil), Features::Simd},
+    {"i32.wrap/i64", 12, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32WrapI64), 0},
+    {"i16x8.widen_low_i8x16_s", 23, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8WidenLowI8X16S), Features::Simd},
+    {"v128.load32x2_u", 15, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::V128Load32X2U), Features::Simd},
+    {"i32x4.max_s", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4MaxS), Features::Simd},
+    {"i64.gt_u", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64GtU), 0},
+    {"i64.atomic.rmw.and", 18, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmwAnd), Features::Threads},
+    {"i64.extend_i32_u", 16, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64ExtendI32U), 0},
+    {"i16x8.add_sat_s", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8AddSatS), Features::Simd},
+    {"anyfunc", 7, TokenType::ReferenceKind, KeywordImmediate::ReferenceKind, u32(ReferenceKind::Funcref), 0},
+    {"f32.lt", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Lt), 0},
+    {"i8x16.all_true", 14, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16AllTrue), Features::Simd},
+    {"f64x2.add", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Add), Features::Simd},
+    {"i64.atomic.rmw.xchg", 19, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmwXchg), Features::Threads},
+    {"i8x16.ge_s", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16GeS), Features::Simd},
+    {"f32x4.sqrt", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Sqrt), Features::Simd},
+    {"memory.grow", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::MemoryGrow), 0},
+    {"i32x4.widen_low_i16x8_s", 23, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4WidenLowI16X8S), Features::Simd},
+    {"f32.reinterpret/i32", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32ReinterpretI32), 0},
+    {"f64.sqrt", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Sqrt), 0},
+    {"i32.atomic.rmw8.xchg_u", 22, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmw8XchgU), Features::Threads},
+    {"i8x16.le_u", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16LeU), Features::Simd},
+    {"i31.new", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I31New), Features::GC},
+    {"i32.shl", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32Shl), 0},
+    {"f32x4.ceil", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Ceil), Features::Simd},
+    {"i16x8.all_true", 14, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8AllTrue), Features::Simd},
+    {"type", 4, TokenType::Type, KeywordImmediate::None, 0, 0},
+    {"i8x16.extract_lane_u", 20, TokenType::SimdLaneInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16ExtractLaneU), Features::Simd},
+    {"declare", 7, TokenType::Declare, KeywordImmediate::None, 0, 0},
+    {"f32x4.pmin", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Pmin), Features::Simd},
+    {"f32", 3, TokenType::NumericType, KeywordImmediate::NumericType, u32(NumericType::F32), 0},
+    {"i8x16.extract_lane_s", 20, TokenType::SimdLaneInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16ExtractLaneS), Features::Simd},
+    {"i32.shr_u", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32ShrU), 0},
+    {"f32x4", 5, TokenType::SimdShape, KeywordImmediate::SimdShape, u32(SimdShape::F32X4), 0},
+    {"i31.get_u", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I31GetU), Features::GC},
+    {"v128.load", 9, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::V128Load), Features::Simd},
+    {"ref.null", 8, TokenType::RefNullInstr, KeywordImmediate::Opcode, u32(Opcode::RefNull), Features::ReferenceTypes},
+    {"i32.trunc_u/f64", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32TruncF64U), 0},
+    {"call", 4, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::Call), 0},
+    {"i64x2", 5, TokenType::SimdShape, KeywordImmediate::SimdShape, u32(SimdShape::I64X2), 0},
+    {"i32", 3, TokenType::NumericType, KeywordImmediate::NumericType, u32(NumericType::I32), 0},
+    {"item", 4, TokenType::Item, KeywordImmediate::None, 0, 0},
+    {"i32.trunc_sat_f32_u", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32TruncSatF32U), Features::SaturatingFloatToInt},
+    {"i32.atomic.rmw16.xchg_u", 23, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmw16XchgU), Features::Threads},
+    {"i8x16.shr_s", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16ShrS), Features::Simd},
+    {"f64.copysign", 12, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Copysign), 0},
+    {"f32x4.le", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Le), Features::Simd},
+    {"f64x2.lt", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Lt), Features::Simd},
+    {"v128.bitselect", 14, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::V128BitSelect), Features::Simd},
+    {"f32.nearest", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Nearest), 0},
+    {"f64x2.extract_lane", 18, TokenType::SimdLaneInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2ExtractLane), Features::Simd},
+    {"set_global", 10, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::GlobalSet), 0},
+    {"i16x8.shl", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8Shl), Features::Simd},
+    {"i32.trunc_sat_f32_s", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32TruncSatF32S), Features::SaturatingFloatToInt},
+    {"loop", 4, TokenType::BlockInstr, KeywordImmediate::Opcode, u32(Opcode::Loop), 0},
+    {"anyref", 6, TokenType::ReferenceKind, KeywordImmediate::ReferenceKind, u32(ReferenceKind::Anyref), 0},
+    {"i64.extend_i32_s", 16, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64ExtendI32S), 0},
+    {"i32.trunc_f64_s", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32TruncF64S), 0},
+    {"i32.atomic.store8", 17, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicStore8), Features::Threads},
+    {"i64.shl", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Shl), 0},
+    {"param", 5, TokenType::Param, KeywordImmediate::None, 0, 0},
+    {"i64.sub", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Sub), 0},
+    {"v128.not", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::V128Not), Features::Simd},
+    {"i32x4.extract_lane", 18, TokenType::SimdLaneInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4ExtractLane), Features::Simd},
+    {"get_global", 10, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::GlobalGet), 0},
+    {"i64.atomic.rmw16.or_u", 21, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw16OrU), Features::Threads},
+    {"f32.demote_f64", 14, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32DemoteF64), 0},
+    {"i32x4.le_s", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4LeS), Features::Simd},
+    {"table.fill", 10, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::TableFill), Features::ReferenceTypes},
+    {"i32x4.min_s", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4MinS), Features::Simd},
+    {"block", 5, TokenType::BlockInstr, KeywordImmediate::Opcode, u32(Opcode::Block), 0},
+    {"f64.reinterpret_i64", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64ReinterpretI64), 0},
+    {"i64.ge_u", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64GeU), 0},
+    {"i32x4", 5, TokenType::SimdShape, KeywordImmediate::SimdShape, u32(SimdShape::I32X4), 0},
+    {"f64x2.floor", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Floor), Features::Simd},
+    {"f32.copysign", 12, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Copysign), 0},
+    {"memory.size", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::MemorySize), 0},
+    {"i64.trunc_s:sat/f32", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64TruncSatF32S), Features::SaturatingFloatToInt},
+    {"i64.xor", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Xor), 0},
+    {"f64x2.eq", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Eq), Features::Simd},
+    {"i8x16.shr_u", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16ShrU), Features::Simd},
+    {"i32x4.lt_s", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4LtS), Features::Simd},
+    {"i64x2.shr_s", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64X2ShrS), Features::Simd},
+    {"return_call_ref", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::ReturnCallRef), Features::FunctionReferences},
+    {"i16x8.extract_lane_s", 20, TokenType::SimdLaneInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8ExtractLaneS), Features::Simd},
+    {"i16x8.mul", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8Mul), Features::Simd},
+    {"i64.load32_s", 12, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64Load32S), 0},
+    {"f32.const", 9, TokenType::F32ConstInstr, KeywordImmediate::Opcode, u32(Opcode::F32Const), 0},
+    {"i8x16", 5, TokenType::SimdShape, KeywordImmediate::SimdShape, u32(SimdShape::I8X16), 0},
+    {"event", 5, TokenType::Event, KeywordImmediate::None, 0, 0},
+    {"rtt.canon", 9, TokenType::HeapTypeInstr, KeywordImmediate::Opcode, u32(Opcode::RttCanon), Features::GC},
+    {"i8x16.eq", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16Eq), Features::Simd},
+    {"i64.ge_s", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64GeS), 0},
+    {"i64.atomic.rmw16.xchg_u", 23, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw16XchgU), Features::Threads},
+    {"i64.extend32_s", 14, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Extend32S), Features::SignExtension},
+    {"i64.atomic.load", 15, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicLoad), Features::Threads},
+    {"f64", 3, TokenType::NumericType, KeywordImmediate::NumericType, u32(NumericType::F64), 0},
+    {"i32.gt_u", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32GtU), 0},
+    {"i16x8.any_true", 14, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8AnyTrue), Features::Simd},
+    {"i16x8.sub_sat_s", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8SubSatS), Features::Simd},
+    {"i16x8.narrow_i32x4_s", 20, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8NarrowI32X4S), Features::Simd},
+    {"i32.atomic.load8_u", 18, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicLoad8U), Features::Threads},
+    {"i32x4.trunc_sat_f32x4_s", 23, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4TruncSatF32X4S), Features::Simd},
+    {"i64.atomic.rmw8.cmpxchg_u", 25, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw8CmpxchgU), Features::Threads},
+    {"i64.extend16_s", 14, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Extend16S), Features::SignExtension},
+    {"table.grow", 10, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::TableGrow), Features::ReferenceTypes},
+    {"f32x4.convert_i32x4_s", 21, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4ConvertI32X4S), Features::Simd},
+    {"f32x4.pmax", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Pmax), Features::Simd},
+    {"i16x8.gt_s", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8GtS), Features::Simd},
+    {"f32.le", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32Le), 0},
+    {"i32.atomic.rmw16.cmpxchg_u", 26, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmw16CmpxchgU), Features::Threads},
+    {"f64.convert_i64_u", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64ConvertI64U), 0},
+    {"array.get_s", 11, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::ArrayGetS), Features::GC},
+    {"i32.gt_s", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32GtS), 0},
+    {"i32x4.eq", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4Eq), Features::Simd},
+    {"export", 6, TokenType::Export, KeywordImmediate::None, 0, 0},
+    {"i32.atomic.rmw8.xor_u", 21, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmw8XorU), Features::Threads},
+    {"field", 5, TokenType::Field, KeywordImmediate::None, 0, 0},
+    {"select", 6, TokenType::SelectInstr, KeywordImmediate::Opcode, u32(Opcode::Select), 0},
+    {"local.tee", 9, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::LocalTee), 0},
+    {"i32x4.splat", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4Splat), Features::Simd},
+    {"i32.trunc_u/f32", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32TruncF32U), 0},
+    {"f32x4.extract_lane", 18, TokenType::SimdLaneInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4ExtractLane), Features::Simd},
+    {"i64.trunc_f64_s", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64TruncF64S), 0},
+    {"i64.store32", 11, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64Store32), 0},
+    {"i64x2.shr_u", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64X2ShrU), Features::Simd},
+    {"f64x2", 5, TokenType::SimdShape, KeywordImmediate::SimdShape, u32(SimdShape::F64X2), 0},
+    {"i64.trunc_sat_f32_u", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64TruncSatF32U), Features::SaturatingFloatToInt},
+    {"f64.promote/f32", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64PromoteF32), 0},
+    {"i32x4.widen_low_i16x8_u", 23, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4WidenLowI16X8U), Features::Simd},
+    {"i32x4.shl", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4Shl), Features::Simd},
+    {"i31ref", 6, TokenType::ReferenceKind, KeywordImmediate::ReferenceKind, u32(ReferenceKind::I31ref), 0},
+    {"i8x16.narrow_i16x8_u", 20, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16NarrowI16X8U), Features::Simd},
+    {"i31", 3, TokenType::HeapKind, KeywordImmediate::HeapKind, u32(HeapKind::I31), 0},
+    {"assert_invalid", 14, TokenType::AssertInvalid, KeywordImmediate::None, 0, 0},
+    {"invoke", 6, TokenType::Invoke, KeywordImmediate::None, 0, 0},
+    {"i8x16.shl", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16Shl), Features::Simd},
+    {"i16x8.add_sat_u", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8AddSatU), Features::Simd},
+    {"nan", 3, TokenType::Float, KeywordImmediate::LiteralKind, u32(LiteralKind::Nan), 0},
+    {"ref.as_non_null", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::RefAsNonNull), Features::FunctionReferences},
+    {"i64.atomic.store16", 18, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicStore16), Features::Threads},
+    {"struct", 6, TokenType::Struct, KeywordImmediate::None, 0, 0},
+    {"i16x8.sub", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8Sub), Features::Simd},
+    {"array.new_with_rtt", 18, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::ArrayNewWithRtt), Features::GC},
+    {"i8x16.min_u", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16MinU), Features::Simd},
+    {"table.copy", 10, TokenType::TableCopyInstr, KeywordImmediate::Opcode, u32(Opcode::TableCopy), Features::BulkMemory},
+    {"table", 5, TokenType::Table, KeywordImmediate::None, 0, 0},
+    {"assert_trap", 11, TokenType::AssertTrap, KeywordImmediate::None, 0, 0},
+    {"local.get", 9, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::LocalGet), 0},
+    {"i16x8.eq", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8Eq), Features::Simd},
+    {"i32.load8_s", 11, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32Load8S), 0},
+    {"v128.load32_splat", 17, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::V128Load32Splat), Features::Simd},
+    {"struct.set", 10, TokenType::StructFieldInstr, KeywordImmediate::Opcode, u32(Opcode::StructSet), Features::GC},
+    {"i32x4.ne", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4Ne), Features::Simd},
+    {"i32x4.neg", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4Neg), Features::Simd},
+    {"f32x4.splat", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Splat), Features::Simd},
+    {"f64.gt", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Gt), 0},
+    {"f64.ge", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Ge), 0},
+    {"i64.reinterpret_f64", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64ReinterpretF64), 0},
+    {"i64.atomic.rmw.cmpxchg", 22, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmwCmpxchg), Features::Threads},
+    {"i64.atomic.rmw8.and_u", 21, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw8AndU), Features::Threads},
+    {"get", 3, TokenType::Get, KeywordImmediate::None, 0, 0},
+    {"i32.rem_u", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32RemU), 0},
+    {"return_call_indirect", 20, TokenType::CallIndirectInstr, KeywordImmediate::Opcode, u32(Opcode::ReturnCallIndirect), Features::TailCall},
+    {"i32x4.trunc_sat_f32x4_u", 23, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4TruncSatF32X4U), Features::Simd},
+    {"i32.load16_s", 12, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32Load16S), 0},
+    {"memory.init", 11, TokenType::MemoryInitInstr, KeywordImmediate::Opcode, u32(Opcode::MemoryInit), Features::BulkMemory},
+    {"table.get", 9, TokenType::VarInstr, KeywordImmediate::Opcode, u32(Opcode::TableGet), Features::ReferenceTypes},
+    {"rtt", 3, TokenType::Rtt, KeywordImmediate::None, 0, 0},
+    {"i64.lt_s", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64LtS), 0},
+    {"i32x4.sub", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4Sub), Features::Simd},
+    {"ref.eq", 6, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::RefEq), Features::GC},
+    {"f64x2.nearest", 13, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Nearest), Features::Simd},
+    {"i64.atomic.rmw.or", 17, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmwOr), Features::Threads},
+    {"i32.atomic.rmw8.cmpxchg_u", 25, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmw8CmpxchgU), Features::Threads},
+    {"i16x8.shr_s", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8ShrS), Features::Simd},
+    {"v128.xor", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::V128Xor), Features::Simd},
+    {"i64.add", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Add), 0},
+    {"i32.lt_s", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32LtS), 0},
+    {"i32x4.abs", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4Abs), Features::Simd},
+    {"f64.max", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Max), 0},
+    {"f64.add", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64Add), 0},
+    {"i16x8.add", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8Add), Features::Simd},
+    {"memory.atomic.notify", 20, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::MemoryAtomicNotify), Features::Threads},
+    {"i64.atomic.rmw8.add_u", 21, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicRmw8AddU), Features::Threads},
+    {"i64.trunc_f32_s", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64TruncF32S), 0},
+    {"i32.atomic.rmw16.or_u", 21, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmw16OrU), Features::Threads},
+    {"call_ref", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::CallRef), Features::FunctionReferences},
+    {"f64x2.sqrt", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Sqrt), Features::Simd},
+    {"ref", 3, TokenType::Ref, KeywordImmediate::None, 0, 0},
+    {"f32x4.abs", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Abs), Features::Simd},
+    {"module", 6, TokenType::Module, KeywordImmediate::None, 0, 0},
+    {"i32.trunc_f32_u", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32TruncF32U), 0},
+    {"i64.eqz", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I64Eqz), 0},
+    {"i32x4.ge_u", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4GeU), Features::Simd},
+    {"i32.atomic.rmw.sub", 18, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmwSub), Features::Threads},
+    {"i8x16.gt_u", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16GtU), Features::Simd},
+    {"i64.atomic.load32_u", 19, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64AtomicLoad32U), Features::Threads},
+    {"i32.trunc_sat_f64_u", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32TruncSatF64U), Features::SaturatingFloatToInt},
+    {"i32.add", 7, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32Add), 0},
+    {"nan:canonical", 13, TokenType::NanCanonical, KeywordImmediate::None, 0, 0},
+    {"i32.atomic.rmw8.sub_u", 21, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmw8SubU), Features::Threads},
+    {"i8x16.lt_s", 10, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16LtS), Features::Simd},
+    {"if", 2, TokenType::BlockInstr, KeywordImmediate::Opcode, u32(Opcode::If), 0},
+    {"i32.trunc_s:sat/f32", 19, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32TruncSatF32S), Features::SaturatingFloatToInt},
+    {"i64x2.extract_lane", 18, TokenType::SimdLaneInstr, KeywordImmediate::Opcode, u32(Opcode::I64X2ExtractLane), Features::Simd},
+    {"then", 4, TokenType::Then, KeywordImmediate::None, 0, 0},
+    {"i64.load8_u", 11, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I64Load8U), 0},
+    {"f64.const", 9, TokenType::F64ConstInstr, KeywordImmediate::Opcode, u32(Opcode::F64Const), 0},
+    {"i16x8.max_s", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I16X8MaxS), Features::Simd},
+    {"table.init", 10, TokenType::TableInitInstr, KeywordImmediate::Opcode, u32(Opcode::TableInit), Features::BulkMemory},
+    {"i32x4.mul", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I32X4Mul), Features::Simd},
+    {"f64x2.max", 9, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F64X2Max), Features::Simd},
+    {"f32.convert_i64_s", 17, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32ConvertI64S), 0},
+    {"f32x4.ne", 8, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::F32X4Ne), Features::Simd},
+    {"i32.atomic.rmw.cmpxchg", 22, TokenType::MemoryInstr, KeywordImmediate::Opcode, u32(Opcode::I32AtomicRmwCmpxchg), Features::Threads},
+    {"i8x16.add_sat_s", 15, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::I8X16AddSatS), Features::Simd},
+    {"grow_memory", 11, TokenType::BareInstr, KeywordImmediate::Opcode, u32(Opcode::MemoryGrow), 0},
+};
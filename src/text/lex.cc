@@ -16,7 +16,28 @@
 
 #include "wasp/text/read/lex.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+
+#include "wasp/base/macros.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+#if defined(__AVX2__)
+#define WASP_LEX_AVX2 1
+#define WASP_LEX_SSE2 1
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#define WASP_LEX_AVX2 0
+#define WASP_LEX_SSE2 1
+#include <emmintrin.h>
+#endif
+#endif
+
+#ifndef WASP_LEX_SSE2
+#define WASP_LEX_AVX2 0
+#define WASP_LEX_SSE2 0
+#endif
 
 namespace wasp::text {
 
@@ -95,6 +116,105 @@ bool NoTrailingReservedChars(SpanU8* data) {
   return ReadReservedChars(data) == 0;
 }
 
+// The scanning functions below skip the long runs of uninteresting bytes in
+// comments, strings and whitespace 16 (SSE2) or 32 (AVX2) bytes at a time,
+// then finish with a scalar loop. Runs are often short (e.g. a single space,
+// or back-to-back escapes in a string), so the first few bytes are checked
+// one at a time before starting.
+constexpr span_extent_t kScalarPrefix = 4;
+
+// Returns the offset of the first byte in `data` that is one of `bytes`, or
+// data.size() if there isn't one.
+template <typename... Bytes>
+auto FindFirstOf(SpanU8 data, Bytes... bytes) -> span_extent_t {
+  const u8* begin = data.data();
+  const u8* end = begin + data.size();
+  const u8* p = begin;
+  for (const u8* q = begin + std::min(kScalarPrefix, data.size()); p < q; ++p) {
+    if (((*p == static_cast<u8>(bytes)) || ...)) {
+      return p - begin;
+    }
+  }
+#if WASP_LEX_AVX2
+  for (; end - p >= 32; p += 32) {
+    __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    __m256i eq = _mm256_setzero_si256();
+    ((eq = _mm256_or_si256(eq,
+                           _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(bytes)))),
+     ...);
+    if (u32 mask = _mm256_movemask_epi8(eq)) {
+      return p - begin + __builtin_ctz(mask);
+    }
+  }
+#endif
+#if WASP_LEX_SSE2
+  for (; end - p >= 16; p += 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i eq = _mm_setzero_si128();
+    ((eq = _mm_or_si128(eq, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(bytes)))),
+     ...);
+    if (u32 mask = _mm_movemask_epi8(eq)) {
+      return p - begin + __builtin_ctz(mask);
+    }
+  }
+#endif
+  while (p < end && !((*p == static_cast<u8>(bytes)) || ...)) {
+    ++p;
+  }
+  return p - begin;
+}
+
+// Returns the offset of the first byte in `data` that isn't a space, tab,
+// carriage return or newline, or data.size() if there isn't one.
+auto FindFirstNonWhitespace(SpanU8 data) -> span_extent_t {
+  const u8* begin = data.data();
+  const u8* end = begin + data.size();
+  const u8* p = begin;
+  for (const u8* q = begin + std::min(kScalarPrefix, data.size()); p < q; ++p) {
+    if (!(*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) {
+      return p - begin;
+    }
+  }
+#if WASP_LEX_AVX2
+  const __m256i space32 = _mm256_set1_epi8(' ');
+  const __m256i tab32 = _mm256_set1_epi8('\t');
+  const __m256i cr32 = _mm256_set1_epi8('\r');
+  const __m256i nl32 = _mm256_set1_epi8('\n');
+  for (; end - p >= 32; p += 32) {
+    __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    __m256i eq = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(chunk, space32),
+                        _mm256_cmpeq_epi8(chunk, tab32)),
+        _mm256_or_si256(_mm256_cmpeq_epi8(chunk, cr32),
+                        _mm256_cmpeq_epi8(chunk, nl32)));
+    if (u32 mask = ~static_cast<u32>(_mm256_movemask_epi8(eq))) {
+      return p - begin + __builtin_ctz(mask);
+    }
+  }
+#endif
+#if WASP_LEX_SSE2
+  const __m128i space16 = _mm_set1_epi8(' ');
+  const __m128i tab16 = _mm_set1_epi8('\t');
+  const __m128i cr16 = _mm_set1_epi8('\r');
+  const __m128i nl16 = _mm_set1_epi8('\n');
+  for (; end - p >= 16; p += 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space16),
+                                           _mm_cmpeq_epi8(chunk, tab16)),
+                              _mm_or_si128(_mm_cmpeq_epi8(chunk, cr16),
+                                           _mm_cmpeq_epi8(chunk, nl16)));
+    if (u32 mask = ~_mm_movemask_epi8(eq) & 0xffff) {
+      return p - begin + __builtin_ctz(mask);
+    }
+  }
+#endif
+  while (p < end &&
+         (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) {
+    ++p;
+  }
+  return p - begin;
+}
+
 auto ReadChar(SpanU8* data) -> int {
   auto result = PeekChar(data);
   if (result != -1) {
@@ -182,6 +302,8 @@ auto LexBlockComment(SpanU8* data) -> Token {
   MatchGuard guard{data};
   int nesting = 0;
   while (true) {
+    // Only `(;` and `;)` are significant in a block comment.
+    data->remove_prefix(FindFirstOf(*data, '(', ';'));
     switch (ReadChar(data)) {
       case -1:
         return Token(guard.loc(), TokenType::InvalidBlockComment);
@@ -215,6 +337,7 @@ auto LexId(SpanU8* data) -> Token {
 auto LexLineComment(SpanU8* data) -> Token {
   MatchGuard guard{data};
   while (true) {
+    data->remove_prefix(FindFirstOf(*data, '\n'));
     switch (ReadChar(data)) {
       case -1:
         return Token(guard.loc(), TokenType::InvalidLineComment);
@@ -267,7 +390,7 @@ auto LexNan(SpanU8* data) -> Token {
       return Token(guard.loc(), TokenType::Float, LiteralInfo::Nan(sign));
     }
   }
-  return LexReserved(data);
+  return LexReserved(guard.Reset());
 }
 
 auto LexNumber(SpanU8* data, TokenType tt) -> Token {
@@ -389,9 +512,13 @@ auto LexText(SpanU8* data) -> Token {
         }
         break;
 
-      default:
-        byte_size++;
+      default: {
+        // Skip the rest of this run of unescaped bytes.
+        auto plain_size = FindFirstOf(*data, '"', '\\', '\n');
+        data->remove_prefix(plain_size);
+        byte_size += 1 + static_cast<u32>(plain_size);
         break;
+      }
     }
   }
 
@@ -405,102 +532,192 @@ auto LexText(SpanU8* data) -> Token {
 
 auto LexWhitespace(SpanU8* data) -> Token {
   MatchGuard guard{data};
-  while (true) {
-    switch (PeekChar(data)) {
-      case ' ':
-      case '\t':
-      case '\r':
-        SkipChar(data);
-        break;
+  data->remove_prefix(FindFirstNonWhitespace(*data));
+  return Token(guard.loc(), TokenType::Whitespace);
+}
+
+// How Keyword::value is interpreted.
+enum class KeywordImmediate : u8 {
+  None,
+  Opcode,
+  NumericType,
+  ReferenceKind,
+  HeapKind,
+  PackedType,
+  LiteralKind,
+  SimdShape,
+};
 
-      case '\n':
-        SkipChar(data);
-        break;
+struct Keyword {
+  const char* name;
+  u8 size;
+  TokenType type;
+  KeywordImmediate immediate;
+  u32 value;
+  Features::Bits features;
+};
 
-      default:
-        return Token(guard.loc(), TokenType::Whitespace);
-    }
+#include "src/text/keywords-inl.cc"
+
+// The keyword table is a minimal perfect hash, generated by gen-keywords.py:
+// a keyword's hash picks a bucket, and the bucket's displacement picks its
+// slot. These must match the functions of the same name in gen-keywords.py.
+u64 LoadLittleEndian(const u8* p, size_t size) {
+  u64 result = 0;
+  for (size_t i = 0; i < size; ++i) {
+    result |= u64{p[i]} << (8 * i);
   }
+  return result;
 }
 
-auto LexKeyword(SpanU8* data, string_view sv, TokenType tt) -> Token {
-  MatchGuard guard{data};
-  if (MatchString(data, sv) && NoTrailingReservedChars(data)) {
-    return Token(guard.loc(), tt);
+u32 HashKeyword(SpanU8 data) {
+  // Hashes the first, middle and last 8 bytes, which may overlap, and the
+  // length.
+  const u8* p = data.data();
+  const size_t size = data.size();
+  u64 lo, mid, hi;
+  if (size > 8) {
+    lo = LoadLittleEndian(p, 8);
+    hi = LoadLittleEndian(p + size - 8, 8);
+    mid = size > 16 ? LoadLittleEndian(p + size / 2 - 4, 8) : lo;
+  } else {
+    lo = mid = hi = LoadLittleEndian(p, size);
   }
-  return LexReserved(guard.Reset());
+  u64 x = (lo * 0x9e3779b97f4a7c15ull) ^ (hi * 0xc2b2ae3d27d4eb4full) ^
+          (mid * 0x165667b19e3779f9ull) ^ size;
+  return static_cast<u32>(x ^ (x >> 32));
 }
 
-auto LexKeyword(SpanU8* data, string_view sv, Opcode o, Features::Bits f = 0)
-    -> Token {
-  MatchGuard guard{data};
-  if (MatchString(data, sv) && NoTrailingReservedChars(data)) {
-    return Token(guard.loc(), TokenType::BareInstr, OpcodeInfo{o, Features{f}});
-  }
-  return LexReserved(guard.Reset());
+u32 MixKeywordHash(u32 x) {
+  x ^= x >> 16;
+  x *= 0x7feb352du;
+  x ^= x >> 15;
+  x *= 0x846ca68bu;
+  x ^= x >> 16;
+  return x;
 }
 
-auto LexKeyword(SpanU8* data,
-                string_view sv,
-                TokenType tt,
-                Opcode o,
-                Features::Bits f = 0) -> Token {
-  MatchGuard guard{data};
-  if (MatchString(data, sv) && NoTrailingReservedChars(data)) {
-    return Token(guard.loc(), tt, OpcodeInfo{o, Features{f}});
-  }
-  return LexReserved(guard.Reset());
+u32 ReduceKeywordHash(u32 x, u32 n) {
+  return static_cast<u32>((u64{x} * n) >> 32);
 }
 
-auto LexKeyword(SpanU8* data, string_view sv, NumericType nt) -> Token {
-  MatchGuard guard{data};
-  if (MatchString(data, sv) && NoTrailingReservedChars(data)) {
-    return Token(guard.loc(), TokenType::NumericType, nt);
+auto LookupKeyword(SpanU8 data) -> const Keyword* {
+  u32 hash = HashKeyword(data);
+  u32 displacement =
+      kKeywordDisplacements[ReduceKeywordHash(hash, kKeywordBucketCount)];
+  const Keyword& keyword =
+      kKeywords[ReduceKeywordHash(MixKeywordHash(hash ^ displacement),
+                                  kKeywordCount)];
+  if (keyword.size == data.size() &&
+      memcmp(keyword.name, data.data(), data.size()) == 0) {
+    return &keyword;
   }
-  return LexReserved(guard.Reset());
+  return nullptr;
 }
 
-auto LexKeyword(SpanU8* data, string_view sv, ReferenceKind rk) -> Token {
-  MatchGuard guard{data};
-  if (MatchString(data, sv) && NoTrailingReservedChars(data)) {
-    return Token(guard.loc(), TokenType::ReferenceKind, rk);
+auto MakeKeywordToken(Location loc, const Keyword& keyword) -> Token {
+  switch (keyword.immediate) {
+    case KeywordImmediate::None:
+      return Token(loc, keyword.type);
+
+    case KeywordImmediate::Opcode:
+      return Token(loc, keyword.type,
+                   OpcodeInfo{static_cast<Opcode>(keyword.value),
+                              Features{keyword.features}});
+
+    case KeywordImmediate::NumericType:
+      return Token(loc, keyword.type,
+                   static_cast<NumericType>(keyword.value));
+
+    case KeywordImmediate::ReferenceKind:
+      return Token(loc, keyword.type,
+                   static_cast<ReferenceKind>(keyword.value));
+
+    case KeywordImmediate::HeapKind:
+      return Token(loc, keyword.type, static_cast<HeapKind>(keyword.value));
+
+    case KeywordImmediate::PackedType:
+      return Token(loc, keyword.type, static_cast<PackedType>(keyword.value));
+
+    case KeywordImmediate::LiteralKind:
+      return Token(loc, keyword.type,
+                   LiteralInfo{static_cast<LiteralKind>(keyword.value)});
+
+    case KeywordImmediate::SimdShape:
+      return Token(loc, keyword.type, static_cast<SimdShape>(keyword.value));
   }
-  return LexReserved(guard.Reset());
+  WASP_UNREACHABLE();
 }
 
-auto LexKeyword(SpanU8* data, string_view sv, TokenType tt, HeapKind hk)
-    -> Token {
-  MatchGuard guard{data};
-  if (MatchString(data, sv) && NoTrailingReservedChars(data)) {
-    return Token(guard.loc(), tt, hk);
-  }
-  return LexReserved(guard.Reset());
+bool StartsWith(string_view sv, string_view prefix) {
+  return sv.substr(0, prefix.size()) == prefix;
 }
 
-auto LexKeyword(SpanU8* data, string_view sv, PackedType pt) -> Token {
+// Reads a run of reserved characters, then looks it up in the keyword table.
+auto LexReservedOrKeyword(SpanU8* data) -> Token {
   MatchGuard guard{data};
-  if (MatchString(data, sv) && NoTrailingReservedChars(data)) {
-    return Token(guard.loc(), TokenType::PackedType, pt);
+  ReadReservedChars(data);
+
+  Location loc = guard.loc();
+  if (auto* keyword = LookupKeyword(loc)) {
+    return MakeKeywordToken(loc, *keyword);
   }
-  return LexReserved(guard.Reset());
-}
 
-auto LexKeyword(SpanU8* data, string_view sv, TokenType tt, LiteralKind lk)
-    -> Token {
-  MatchGuard guard{data};
-  if (MatchString(data, sv) && NoTrailingReservedChars(data)) {
-    return Token(guard.loc(), tt, LiteralInfo{lk});
+  string_view sv = ToStringView(loc);
+
+  // These keywords are followed by a number, so they aren't in the table.
+  if (StartsWith(sv, "align=")) {
+    return LexNameEqNum(guard.Reset(), "align=", TokenType::AlignEqNat);
+  } else if (StartsWith(sv, "offset=")) {
+    return LexNameEqNum(guard.Reset(), "offset=", TokenType::OffsetEqNat);
+  } else if (StartsWith(sv, "nan:0x")) {
+    return LexNan(guard.Reset());
   }
-  return LexReserved(guard.Reset());
+  return Token(loc, TokenType::Reserved);
 }
 
-auto LexKeyword(SpanU8* data, string_view sv, SimdShape ss)
-    -> Token {
-  MatchGuard guard{data};
-  if (MatchString(data, sv) && NoTrailingReservedChars(data)) {
-    return Token(guard.loc(), TokenType::SimdShape, ss);
+// Skips the parenthesized group at the start of `data`, including any groups,
+// strings and comments nested in it. Only the bytes that can start one of
+// those are examined, but they are lexed the same way as in Lex, so the group
+// ends where the parser would find its matching `)`. Returns false if the
+// group isn't closed.
+bool SkipParenGroup(SpanU8* data) {
+  int nesting = 0;
+  while (true) {
+    data->remove_prefix(FindFirstOf(*data, '(', ')', '"', ';'));
+    switch (PeekChar(data)) {
+      case -1:
+        return false;
+
+      case '(':
+        if (PeekChar(data, 1) == ';') {
+          LexBlockComment(data);
+        } else {
+          SkipChar(data);
+          nesting++;
+        }
+        break;
+
+      case ')':
+        SkipChar(data);
+        if (--nesting == 0) {
+          return true;
+        }
+        break;
+
+      case '"':
+        LexText(data);
+        break;
+
+      case ';':
+        if (PeekChar(data, 1) == ';') {
+          LexLineComment(data);
+        } else {
+          SkipChar(data);
+        }
+        break;
+    }
   }
-  return LexReserved(guard.Reset());
 }
 
 }  // namespace
@@ -594,10 +811,10 @@ auto Lex(SpanU8* data) -> Token {
       return LexId(data);
 
     default:
-#include "src/text/keywords-inl.cc"
+      break;
   }
   if (IsReserved(PeekChar(data))) {
-    return LexReserved(data);
+    return LexReservedOrKeyword(data);
   }
   SkipChar(data);
   return Token(guard.loc(), TokenType::InvalidChar);
@@ -617,4 +834,19 @@ auto LexNoWhitespace(SpanU8* data) -> Token {
   }
 }
 
+auto SplitParenGroups(SpanU8 data) -> std::vector<SpanU8> {
+  std::vector<SpanU8> groups;
+  while (true) {
+    auto token = LexNoWhitespace(&data);
+    if (token.type != TokenType::Lpar) {
+      return groups;
+    }
+    data = MakeSpan(token.loc.begin(), data.end());
+    if (!SkipParenGroup(&data)) {
+      return groups;
+    }
+    groups.push_back(MakeSpan(token.loc.begin(), data.begin()));
+  }
+}
+
 }  // namespace wasp::text
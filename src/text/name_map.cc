@@ -16,7 +16,9 @@
 
 #include "wasp/text/read/name_map.h"
 
+#include <algorithm>
 #include <cassert>
+
 #include "wasp/base/macros.h"
 
 namespace wasp::text {
@@ -26,17 +28,24 @@ NameMap::NameMap() : stack_{0} {}
 void NameMap::Reset() {
   names_.clear();
   stack_ = {0};
+  index_.clear();
 }
 
 void NameMap::NewUnbound() {
-  names_.push_back(nullopt);
+  names_.push_back({nullopt, kNone});
 }
 
 bool NameMap::NewBound(BindVar var) {
-  if (HasSinceLastPush(var)) {
-    return false;
+  auto [iter, inserted] = index_.try_emplace(var, names_.size());
+  size_t shadowed = kNone;
+  if (!inserted) {
+    if (iter->second >= stack_.back()) {
+      return false;
+    }
+    shadowed = iter->second;
+    iter->second = names_.size();
   }
-  names_.push_back(var);
+  names_.push_back({var, shadowed});
   return true;
 }
 
@@ -46,43 +55,49 @@ void NameMap::Push() {
 
 void NameMap::Pop() {
   assert(stack_.size() > 1);
+  // Restore the bindings that the popped names shadowed.
+  for (size_t i = names_.size(); i > stack_.back(); --i) {
+    const auto& entry = names_[i - 1];
+    if (entry.name) {
+      if (entry.shadowed == kNone) {
+        index_.erase(*entry.name);
+      } else {
+        index_[*entry.name] = entry.shadowed;
+      }
+    }
+  }
   names_.resize(stack_.back());
   stack_.pop_back();
 }
 
 bool NameMap::Has(BindVar var) const {
-  return FindInRange(0, names_.size(), var).has_value();
+  return Find(var).has_value();
 }
 
 bool NameMap::HasSinceLastPush(BindVar var) const {
-  return FindInRange(stack_.back(), names_.size(), var).has_value();
+  auto found = Find(var);
+  return found && *found >= stack_.back();
 }
 
-optional<size_t> NameMap::FindInRange(size_t begin,
-                                      size_t end,
-                                      BindVar var) const {
-  for (size_t i = begin; i < end; ++i) {
-    auto&& opt_name = names_[i];
-    if (opt_name && opt_name == var) {
-      return i;
-    }
+optional<size_t> NameMap::Find(BindVar var) const {
+  auto iter = index_.find(var);
+  if (iter == index_.end()) {
+    return nullopt;
   }
-  return nullopt;
+  return iter->second;
 }
 
 optional<Index> NameMap::Get(BindVar var) const {
-  Index offset = 0;
-  size_t end = names_.size();
-  for (auto iter = stack_.rbegin(); iter != stack_.rend(); ++iter) {
-    size_t begin = *iter;
-    auto found = FindInRange(begin, end, var);
-    if (found) {
-      return offset + static_cast<Index>(*found - begin);
-    }
-    offset += static_cast<Index>(end - begin);
-    end = begin;
+  auto found = Find(var);
+  if (!found) {
+    return nullopt;
   }
-  return nullopt;
+  // Names are numbered from the innermost scope outward, so the index is the
+  // size of the scopes inside this one plus the offset within it.
+  auto scope = std::upper_bound(stack_.begin(), stack_.end(), *found) - 1;
+  size_t begin = *scope;
+  size_t end = scope + 1 != stack_.end() ? *(scope + 1) : names_.size();
+  return static_cast<Index>(names_.size() - end + *found - begin);
 }
 
 auto NameMap::Size() const -> Index {
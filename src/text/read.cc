@@ -17,16 +17,22 @@
 #include "wasp/text/read.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <iterator>
+#include <memory>
 #include <numeric>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
+#include "wasp/base/buffered_errors.h"
 #include "wasp/base/concat.h"
 #include "wasp/base/errors.h"
 #include "wasp/base/utf8.h"
 #include "wasp/text/formatters.h"
 #include "wasp/text/numeric.h"
+#include "wasp/text/read/lex.h"
 #include "wasp/text/read/location_guard.h"
 #include "wasp/text/read/macros.h"
 #include "wasp/text/read/read_ctx.h"
@@ -2253,9 +2259,126 @@ auto ReadModuleItem(Tokenizer& tokenizer, ReadCtx& ctx) -> OptAt<ModuleItem> {
   }
 }
 
+namespace {
+
+// Whether reading `item` checked ReadCtx::seen_non_import.
+bool IsImportItem(const ModuleItem& item) {
+  switch (item.kind()) {
+    case ModuleItemKind::Import:
+      return true;
+    case ModuleItemKind::Function:
+      return item.function()->import.has_value();
+    case ModuleItemKind::Table:
+      return item.table()->import.has_value();
+    case ModuleItemKind::Memory:
+      return item.memory()->import.has_value();
+    case ModuleItemKind::Global:
+      return item.global()->import.has_value();
+    case ModuleItemKind::Event:
+      return item.event()->import.has_value();
+    default:
+      return false;
+  }
+}
+
+struct ParallelModuleItem {
+  optional<ModuleItem> item;
+  std::unique_ptr<BufferedErrors> errors;  // Only if there were errors.
+  Token last_token;
+  bool is_import = false;
+  bool seen_non_import = false;
+  bool seen_start = false;
+};
+
+// Reads the module items at the start of `tokenizer` on ctx.thread_count
+// threads, appending them to `module`. Each item is read with a fresh ReadCtx,
+// then the results are checked in order against the real one. Stops at the
+// first item that has an error, or whose result depends on the items before it
+// (e.g. an import after a function), and leaves `tokenizer` there. The caller
+// then reads the rest in order, so that item's errors are reported as usual.
+void ReadModuleItemsInParallel(Tokenizer& tokenizer,
+                               ReadCtx& ctx,
+                               Module& module) {
+  auto fields = SplitParenGroups(tokenizer.Remaining());
+  const Index count = static_cast<Index>(fields.size());
+  std::vector<ParallelModuleItem> items(count);
+  // Items after the first one that wasn't read are never used, so there is no
+  // need to read them.
+  std::atomic<Index> first_unread{count};
+  std::atomic<Index> next{0};
+
+  auto worker = [&]() {
+    auto errors = std::make_unique<BufferedErrors>();
+    for (Index i; (i = next++) < count;) {
+      if (i > first_unread) {
+        break;
+      }
+      auto& item = items[i];
+      Tokenizer field_tokenizer{fields[i]};
+      ReadCtx field_ctx{ctx.features, *errors};
+      OptAt<ModuleItem> module_item;
+      if (IsModuleItem(field_tokenizer)) {
+        module_item = ReadModuleItem(field_tokenizer, field_ctx);
+      }
+      if (errors->HasError()) {
+        item.errors = std::move(errors);
+        errors = std::make_unique<BufferedErrors>();
+      }
+      // The item must also end where the field does.
+      if (!module_item || field_tokenizer.Peek().type != TokenType::Eof) {
+        Index expected = first_unread;
+        while (i < expected &&
+               !first_unread.compare_exchange_weak(expected, i)) {
+        }
+        continue;
+      }
+      item.item = std::move(module_item->value());
+      item.last_token = field_tokenizer.Previous();
+      item.is_import = IsImportItem(*item.item);
+      item.seen_non_import = field_ctx.seen_non_import;
+      item.seen_start = field_ctx.seen_start;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  Index worker_count = std::min(ctx.thread_count, count);
+  for (Index i = 1; i < worker_count; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (Index i = 0; i < count; ++i) {
+    auto& item = items[i];
+    if (!item.item || (ctx.seen_non_import && item.is_import) ||
+        (ctx.seen_start && item.seen_start)) {
+      if (i > 0) {
+        tokenizer.Seek(fields[i].begin(), items[i - 1].last_token);
+      }
+      return;
+    }
+    if (item.errors) {
+      item.errors->ReplayTo(ctx.errors);
+    }
+    ctx.seen_non_import |= item.seen_non_import;
+    ctx.seen_start |= item.seen_start;
+    module.push_back(std::move(*item.item));
+  }
+  if (count > 0) {
+    tokenizer.Seek(fields.back().end(), items.back().last_token);
+  }
+}
+
+}  // namespace
+
 auto ReadModule(Tokenizer& tokenizer, ReadCtx& ctx) -> optional<Module> {
   ctx.BeginModule();
   Module module;
+  if (ctx.thread_count > 1) {
+    ReadModuleItemsInParallel(tokenizer, ctx, module);
+  }
   while (IsModuleItem(tokenizer)) {
     WASP_TRY_READ(item, ReadModuleItem(tokenizer, ctx));
     module.push_back(item);
@@ -85,10 +85,14 @@ auto ResolveCtx::GetFieldNameMap(Index index) -> NameMap* {
 void FunctionTypeMap::BeginModule() {
   list_.clear();
   deferred_list_.clear();
+  list_index_.clear();
+  deferred_list_index_.clear();
 }
 
 void FunctionTypeMap::Define(BoundFunctionType bound_type) {
-  list_.push_back(ToFunctionType(bound_type));
+  auto type = ToFunctionType(bound_type);
+  list_index_.try_emplace(type, static_cast<Index>(list_.size()));
+  list_.push_back(std::move(type));
 }
 
 void FunctionTypeMap::SkipIndex() {
@@ -96,18 +100,19 @@ void FunctionTypeMap::SkipIndex() {
 }
 
 Index FunctionTypeMap::Use(FunctionType type) {
-  auto iter = FindIter(list_, type);
-  if (iter != list_.end()) {
-    return static_cast<Index>(iter - list_.begin());
+  auto iter = list_index_.find(type);
+  if (iter != list_index_.end()) {
+    return iter->second;
   }
 
-  iter = FindIter(deferred_list_, type);
-  if (iter != deferred_list_.end()) {
-    return static_cast<Index>(list_.size() + (iter - deferred_list_.begin()));
+  // Deferred types are numbered after all the defined ones, which may still
+  // be growing.
+  auto [deferred_iter, inserted] = deferred_list_index_.try_emplace(
+      type, static_cast<Index>(deferred_list_.size()));
+  if (inserted) {
+    deferred_list_.push_back(std::move(type));
   }
-
-  deferred_list_.push_back(type);
-  return static_cast<Index>(list_.size() + deferred_list_.size() - 1);
+  return static_cast<Index>(list_.size()) + deferred_iter->second;
 }
 
 Index FunctionTypeMap::Use(BoundFunctionType type) {
@@ -118,10 +123,12 @@ auto FunctionTypeMap::EndModule() -> DefinedTypeList {
   DefinedTypeList defined_types;
   for (auto&& deferred : deferred_list_) {
     assert(deferred.has_value());
+    list_index_.try_emplace(*deferred, static_cast<Index>(list_.size()));
     list_.push_back(*deferred);
     defined_types.push_back(ToDefinedType(*deferred));
   }
   deferred_list_.clear();
+  deferred_list_index_.clear();
   return defined_types;
 }
 
@@ -151,14 +158,40 @@ DefinedType FunctionTypeMap::ToDefinedType(const FunctionType& unbound_type) {
                      BoundFunctionType{bound_params, unbound_type.results}};
 }
 
-// static
-FunctionTypeMap::List::const_iterator FunctionTypeMap::FindIter(
-    const List& list,
-    const FunctionType& type) {
-  return std::find_if(list.begin(), list.end(),
-                      [&](const optional<FunctionType>& ft) {
-                        return ft && IsSame(type, *ft);
-                      });
+namespace {
+
+// Only numeric types and reference kinds are hashed by value; other reference
+// types and rtts are hashed by their variant index alone, and are told apart
+// by Eq.
+size_t HashValueType(const ValueType& value_type) {
+  size_t hash = value_type.type.index();
+  if (value_type.is_numeric_type()) {
+    hash = hash * 31 + static_cast<size_t>(value_type.numeric_type().value());
+  } else if (value_type.is_reference_type() &&
+             value_type.reference_type()->is_reference_kind()) {
+    hash = hash * 31 + static_cast<size_t>(
+                           value_type.reference_type()->reference_kind().value());
+  }
+  return hash;
+}
+
+}  // namespace
+
+size_t FunctionTypeMap::Hash::operator()(const FunctionType& type) const {
+  size_t hash = type.params.size();
+  for (const auto& param : type.params) {
+    hash = hash * 31 + HashValueType(param.value());
+  }
+  hash = hash * 31 + type.results.size();
+  for (const auto& result : type.results) {
+    hash = hash * 31 + HashValueType(result.value());
+  }
+  return hash;
+}
+
+bool FunctionTypeMap::Eq::operator()(const FunctionType& lhs,
+                                     const FunctionType& rhs) const {
+  return IsSame(lhs, rhs);
 }
 
 // static
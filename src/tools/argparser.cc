@@ -104,7 +104,17 @@ void ArgParser::Parse(span<const string_view> args) {
     };
 
     if (starts_with(arg, "--")) {
-      if (auto option = FindLongOption(arg)) {
+      auto equals = arg.find('=');
+      if (equals != string_view::npos) {
+        // --param=value
+        auto option = FindLongOption(arg.substr(0, equals));
+        if (option && option->is_param()) {
+          get<ParamCallback>(option->callback)(arg.substr(equals + 1));
+        } else {
+          Format(&std::cerr, "Unknown long argument with parameter `%s`.\n",
+                 arg);
+        }
+      } else if (auto option = FindLongOption(arg)) {
         call(*option);
       } else {
         Format(&std::cerr, "Unknown long argument `%s`.\n", arg);
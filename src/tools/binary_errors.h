@@ -35,6 +35,7 @@ class BinaryErrors : public Errors {
   explicit BinaryErrors(string_view filename, SpanU8 data);
 
   bool HasError() const override { return !errors.empty(); }
+  auto GetErrors() const -> const std::vector<Error>& { return errors; }
   void PrintTo(std::ostream&);
 
  protected:
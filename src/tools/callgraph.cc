@@ -37,6 +37,7 @@
 #include "wasp/binary/lazy_expression.h"
 #include "wasp/binary/lazy_module.h"
 #include "wasp/binary/lazy_module_utils.h"
+#include "wasp/binary/module_index.h"
 #include "wasp/binary/name_section/sections.h"
 #include "wasp/binary/sections.h"
 
@@ -74,6 +75,7 @@ struct Tool {
   BinaryErrors errors;
   Options options;
   LazyModule module;
+  ModuleIndex module_index;
   std::map<Index, string_view> function_names;
   std::map<string_view, Index> name_to_function;
   Index imported_function_count = 0;
@@ -115,13 +117,13 @@ int Main(span<const string_view> args) {
     parser.PrintHelpAndExit(1);
   }
 
-  auto optbuf = ReadFile(filename);
-  if (!optbuf) {
+  auto optfile = MapFile(filename);
+  if (!optfile) {
     Format(&std::cerr, "Error reading file %s.\n", filename);
     return 1;
   }
 
-  SpanU8 data{*optbuf};
+  SpanU8 data = optfile->data();
   Tool tool{data, options};
   int result = tool.Run();
   tool.errors.PrintTo(std::cerr);
@@ -131,7 +133,8 @@ int Main(span<const string_view> args) {
 Tool::Tool(SpanU8 data, Options options)
     : errors{data},
       options{options},
-      module{ReadLazyModule(data, options.features, errors)} {}
+      module{ReadLazyModule(data, options.features, errors)},
+      module_index{module} {}
 
 int Tool::Run() {
   DoPrepass();
@@ -146,13 +149,15 @@ int Tool::Run() {
 }
 
 void Tool::DoPrepass() {
-  ForEachFunctionName(module, [this](const IndexNamePair& pair) {
-    name_to_function.insert(std::make_pair(pair.second, pair.first));
-  });
+  ForEachFunctionName(module_index, options.features,
+                      [this](const IndexNamePair& pair) {
+                        name_to_function.insert(
+                            std::make_pair(pair.second, pair.first));
+                      });
 
-  CopyFunctionNames(module,
+  CopyFunctionNames(module_index, options.features,
                     std::inserter(function_names, function_names.end()));
-  imported_function_count = GetImportCount(module, ExternalKind::Function);
+  imported_function_count = module_index.imported_function_count();
 }
 
 void Tool::GetFunctionIndex() {
@@ -38,6 +38,7 @@
 #include "wasp/binary/lazy_expression.h"
 #include "wasp/binary/lazy_module.h"
 #include "wasp/binary/lazy_module_utils.h"
+#include "wasp/binary/module_index.h"
 #include "wasp/binary/name_section/sections.h"
 #include "wasp/binary/sections.h"
 
@@ -101,8 +102,8 @@ struct Tool {
   BinaryErrors errors;
   Options options;
   LazyModule module;
+  ModuleIndex module_index;
   std::map<string_view, Index> name_to_function;
-  Index imported_function_count = 0;
   std::vector<Label> labels;
   std::vector<BasicBlock> cfg;
   BBID start_bbid = InvalidBBID;
@@ -141,13 +142,13 @@ int Main(span<const string_view> args) {
     parser.PrintHelpAndExit(1);
   }
 
-  auto optbuf = ReadFile(filename);
-  if (!optbuf) {
+  auto optfile = MapFile(filename);
+  if (!optfile) {
     Format(&std::cerr, "Error reading file %s.\n", filename);
     return 1;
   }
 
-  SpanU8 data{*optbuf};
+  SpanU8 data = optfile->data();
   Tool tool{data, options};
   int result = tool.Run();
   tool.errors.PrintTo(std::cerr);
@@ -157,7 +158,8 @@ int Main(span<const string_view> args) {
 Tool::Tool(SpanU8 data, Options options)
     : errors{data},
       options{options},
-      module{ReadLazyModule(data, options.features, errors)} {}
+      module{ReadLazyModule(data, options.features, errors)},
+      module_index{module} {}
 
 int Tool::Run() {
   DoPrepass();
@@ -178,10 +180,11 @@ int Tool::Run() {
 }
 
 void Tool::DoPrepass() {
-  ForEachFunctionName(module, [this](const IndexNamePair& pair) {
-    name_to_function.insert(std::make_pair(pair.second, pair.first));
-  });
-  imported_function_count = GetImportCount(module, ExternalKind::Function);
+  ForEachFunctionName(module_index, options.features,
+                      [this](const IndexNamePair& pair) {
+                        name_to_function.insert(
+                            std::make_pair(pair.second, pair.first));
+                      });
 }
 
 optional<Index> Tool::GetFunctionIndex() {
@@ -196,20 +199,11 @@ optional<Index> Tool::GetFunctionIndex() {
 }
 
 optional<Code> Tool::GetCode(Index find_index) {
-  for (auto section : module.sections) {
-    if (section->is_known()) {
-      auto known = section->known();
-      if (known->id == SectionId::Code) {
-        auto section = ReadCodeSection(known, module.ctx);
-        for (auto code : enumerate(section.sequence, imported_function_count)) {
-          if (code.index == find_index) {
-            return code.value;
-          }
-        }
-      }
-    }
+  auto code = module_index.GetCode(find_index, module.ctx);
+  if (!code) {
+    return nullopt;
   }
-  return nullopt;
+  return code->value();
 }
 
 void Tool::CalculateCFG(Code code) {
@@ -26,7 +26,6 @@
 #include "src/tools/argparser.h"
 #include "src/tools/binary_errors.h"
 #include "wasp/base/concat.h"
-#include "wasp/base/enumerate.h"
 #include "wasp/base/errors_nop.h"
 #include "wasp/base/features.h"
 #include "wasp/base/file.h"
@@ -38,6 +37,7 @@
 #include "wasp/binary/lazy_expression.h"
 #include "wasp/binary/lazy_module.h"
 #include "wasp/binary/lazy_module_utils.h"
+#include "wasp/binary/module_index.h"
 #include "wasp/binary/name_section/sections.h"
 #include "wasp/binary/sections.h"
 
@@ -143,10 +143,10 @@ struct Tool {
   BinaryErrors errors;
   Options options;
   LazyModule module;
+  ModuleIndex module_index;
   std::vector<DefinedType> defined_types;
   std::vector<Function> functions;
   std::map<string_view, Index> name_to_function;
-  Index imported_function_count = 0;
   std::vector<Label> labels;
   std::vector<Block> bbs;
   std::vector<Value> values;
@@ -189,13 +189,13 @@ int Main(span<const string_view> args) {
     parser.PrintHelpAndExit(1);
   }
 
-  auto optbuf = ReadFile(filename);
-  if (!optbuf) {
+  auto optfile = MapFile(filename);
+  if (!optfile) {
     Format(&std::cerr, "Error reading file %s.\n", filename);
     return 1;
   }
 
-  SpanU8 data{*optbuf};
+  SpanU8 data = optfile->data();
   Tool tool{data, options};
   int result = tool.Run();
   tool.errors.PrintTo(std::cerr);
@@ -205,7 +205,8 @@ int Main(span<const string_view> args) {
 Tool::Tool(SpanU8 data, Options options)
     : errors{data},
       options{options},
-      module{ReadLazyModule(data, options.features, errors)} {}
+      module{ReadLazyModule(data, options.features, errors)},
+      module_index{module} {}
 
 int Tool::Run() {
   DoPrepass();
@@ -227,9 +228,11 @@ int Tool::Run() {
 }
 
 void Tool::DoPrepass() {
-  ForEachFunctionName(module, [this](const IndexNamePair& pair) {
-    name_to_function.insert(std::make_pair(pair.second, pair.first));
-  });
+  ForEachFunctionName(module_index, options.features,
+                      [this](const IndexNamePair& pair) {
+                        name_to_function.insert(
+                            std::make_pair(pair.second, pair.first));
+                      });
 
   for (auto section : module.sections) {
     if (section->is_known()) {
@@ -248,7 +251,6 @@ void Tool::DoPrepass() {
               functions.push_back(Function{import->index()});
             }
           }
-          imported_function_count = static_cast<Index>(functions.size());
           break;
 
         case SectionId::Function: {
@@ -291,20 +293,11 @@ optional<FunctionType> Tool::GetFunctionType(Index func_index) {
 }
 
 optional<Code> Tool::GetCode(Index find_index) {
-  for (auto section : module.sections) {
-    if (section->is_known()) {
-      auto known = section->known();
-      if (known->id == SectionId::Code) {
-        auto section = ReadCodeSection(known, module.ctx);
-        for (auto code : enumerate(section.sequence, imported_function_count)) {
-          if (code.index == find_index) {
-            return code.value;
-          }
-        }
-      }
-    }
+  auto code = module_index.GetCode(find_index, module.ctx);
+  if (!code) {
+    return nullopt;
   }
-  return nullopt;
+  return code->value();
 }
 
 void Tool::CalculateDFG(const FunctionType& type, Code code) {
@@ -244,13 +244,13 @@ int Main(span<const string_view> args) {
   }
 
   for (auto filename : filenames) {
-    auto optbuf = ReadFile(filename);
-    if (!optbuf) {
+    auto optfile = MapFile(filename);
+    if (!optfile) {
       Format(&std::cerr, "Error reading file %s.\n", filename);
       continue;
     }
 
-    SpanU8 data{*optbuf};
+    SpanU8 data = optfile->data();
     Tool tool{filename, data, options};
     tool.Run();
     tool.errors.PrintTo(std::cerr);
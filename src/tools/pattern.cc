@@ -113,13 +113,13 @@ int Main(span<const string_view> args) {
     parser.PrintHelpAndExit(1);
   }
 
-  auto optbuf = ReadFile(filename);
-  if (!optbuf) {
+  auto optfile = MapFile(filename);
+  if (!optfile) {
     Format(&std::cerr, "Error reading file %s.\n", filename);
     return 1;
   }
 
-  SpanU8 data{*optbuf};
+  SpanU8 data = optfile->data();
   Tool tool{data, options};
 
   int result = tool.Run();
@@ -18,21 +18,32 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <random>
+#include <sstream>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <vector>
 
 #include "absl/strings/str_format.h"
 
 #include "src/tools/argparser.h"
 #include "src/tools/binary_errors.h"
+#include "wasp/base/content_hash.h"
 #include "wasp/base/enumerate.h"
 #include "wasp/base/features.h"
 #include "wasp/base/file.h"
 #include "wasp/base/formatters.h"
 #include "wasp/base/optional.h"
+#include "wasp/base/str_to_u32.h"
 #include "wasp/base/string_view.h"
 #include "wasp/binary/formatters.h"
 #include "wasp/valid/valid_ctx.h"
@@ -44,27 +55,56 @@ namespace validate {
 
 using absl::Format;
 using absl::PrintF;
+using absl::StrFormat;
 
 using namespace ::wasp::binary;
 
+namespace fs = std::filesystem;
+
 struct Options {
   Features features;
   bool verbose = false;
+  Index thread_count = 1;
+  Index job_count = 1;
+  bool fused = false;
+  std::string cache_dir;
+};
+
+// The result of validating one file. The output is buffered so that files
+// validated in parallel can be printed in input order.
+struct FileResult {
+  bool valid = false;
+  size_t size = 0;
+  std::string out;
+  std::string err;
 };
 
+auto ValidateFile(string_view filename, const Options&) -> FileResult;
+void PrintResult(const FileResult&);
+bool ValidateFilesInParallel(span<const string_view> filenames,
+                             const Options&,
+                             size_t* total_size);
+
 struct Tool {
   explicit Tool(string_view filename, SpanU8 data, Options);
 
   bool Run();
+  bool Validate();
+
+  auto CachePath() const -> fs::path;
+  auto ReadCache(const fs::path&) -> optional<bool>;
+  void WriteCache(const fs::path&, bool valid);
 
   std::string filename;
   Options options;
   SpanU8 data;
   BinaryErrors errors;
-  LazyModule module;
-  valid::ValidateVisitor visitor;
 };
 
+// Bump this when the format of the cache files, or the validation result for
+// the same module and features, changes.
+constexpr char kCacheHeader[] = "wasp-validate-cache-1";
+
 int Main(span<const string_view> args) {
   std::vector<string_view> filenames;
   Options options;
@@ -75,6 +115,18 @@ int Main(span<const string_view> args) {
            [&]() { parser.PrintHelpAndExit(0); })
       .Add('v', "--verbose", "print filename and whether it was valid",
            [&]() { options.verbose = true; })
+      .Add('t', "--threads", "<n>", "validate function bodies on <n> threads",
+           [&](string_view arg) {
+             options.thread_count = std::max(StrToU32(arg).value_or(1), 1u);
+           })
+      .Add('j', "--jobs", "<n>", "validate <n> files in parallel",
+           [&](string_view arg) {
+             options.job_count = std::max(StrToU32(arg).value_or(1), 1u);
+           })
+      .Add("--fused", "read and validate function bodies in a single pass",
+           [&]() { options.fused = true; })
+      .Add("--cache-dir", "<dir>", "cache validation results in <dir>",
+           [&](string_view arg) { options.cache_dir = std::string{arg}; })
       .AddFeatureFlags(options.features)
       .Add("<filenames...>", "input wasm files",
            [&](string_view arg) { filenames.push_back(arg); });
@@ -85,43 +137,238 @@ int Main(span<const string_view> args) {
     parser.PrintHelpAndExit(1);
   }
 
+  if (!options.cache_dir.empty()) {
+    std::error_code ec;
+    fs::create_directories(options.cache_dir, ec);
+    if (ec) {
+      Format(&std::cerr, "Unable to create cache directory %s: %s\n",
+             options.cache_dir, ec.message());
+      options.cache_dir.clear();
+    }
+  }
+
+  if (options.job_count > 1) {
+    auto start = std::chrono::steady_clock::now();
+    size_t total_size = 0;
+    bool ok = ValidateFilesInParallel(filenames, options, &total_size);
+    std::chrono::duration<double> duration =
+        std::chrono::steady_clock::now() - start;
+    double seconds = std::max(duration.count(), 1e-9);
+    PrintF("Validated %d files (%.1f MB) in %.2fs: %.1f files/s, %.1f MB/s\n",
+           filenames.size(), total_size / 1e6, seconds,
+           filenames.size() / seconds, total_size / 1e6 / seconds);
+    return ok ? 0 : 1;
+  }
+
   bool ok = true;
   for (auto filename : filenames) {
-    auto optbuf = ReadFile(filename);
-    if (!optbuf) {
-      Format(&std::cerr, "Error reading file %s.\n", filename);
-      ok = false;
-      continue;
+    auto result = ValidateFile(filename, options);
+    PrintResult(result);
+    ok &= result.valid;
+  }
+
+  return ok ? 0 : 1;
+}
+
+auto ValidateFile(string_view filename, const Options& options)
+    -> FileResult {
+  FileResult result;
+  auto optfile = MapFile(filename);
+  if (!optfile) {
+    result.err = StrFormat("Error reading file %s.\n", filename);
+    return result;
+  }
+
+  SpanU8 data = optfile->data();
+  Tool tool{filename, data, options};
+  result.valid = tool.Run();
+  result.size = data.size();
+  if (!result.valid || options.verbose) {
+    result.out =
+        StrFormat("[%4s] %s\n", result.valid ? " OK " : "FAIL", filename);
+    std::ostringstream err;
+    tool.errors.PrintTo(err);
+    result.err = err.str();
+  }
+  return result;
+}
+
+void PrintResult(const FileResult& result) {
+  PrintF("%s", result.out);
+  Format(&std::cerr, "%s", result.err);
+}
+
+// Files are claimed in input order from a shared counter, so an idle worker
+// always takes the next unclaimed file. A worker won't claim a file more than
+// `window` files ahead of the last one printed, which bounds the number of
+// modules and buffered results held in memory at once.
+bool ValidateFilesInParallel(span<const string_view> filenames,
+                             const Options& options,
+                             size_t* total_size) {
+  const size_t count = filenames.size();
+  const size_t window = size_t{options.job_count} * 4;
+  std::vector<FileResult> results(count);
+  std::vector<char> done(count, false);
+  std::mutex mutex;
+  std::condition_variable cv;
+  size_t next = 0;
+  size_t printed = 0;
+
+  auto worker = [&]() {
+    std::unique_lock<std::mutex> lock{mutex};
+    while (true) {
+      cv.wait(lock, [&]() { return next >= count || next < printed + window; });
+      if (next >= count) {
+        break;
+      }
+      size_t i = next++;
+      lock.unlock();
+      auto result = ValidateFile(filenames[i], options);
+      lock.lock();
+      results[i] = std::move(result);
+      done[i] = true;
+      cv.notify_all();
     }
+  };
+
+  std::vector<std::thread> threads;
+  for (Index i = 0; i < options.job_count; ++i) {
+    threads.emplace_back(worker);
+  }
 
-    SpanU8 data{*optbuf};
-    Tool tool{filename, data, options};
-    bool valid = tool.Run();
-    if (!valid || options.verbose) {
-      PrintF("[%4s] %s\n", valid ? " OK " : "FAIL", filename);
-      tool.errors.PrintTo(std::cerr);
+  bool ok = true;
+  for (size_t i = 0; i < count; ++i) {
+    FileResult result;
+    {
+      std::unique_lock<std::mutex> lock{mutex};
+      cv.wait(lock, [&]() { return done[i]; });
+      result = std::move(results[i]);
+      printed = i + 1;
     }
-    ok &= valid;
+    cv.notify_all();
+    PrintResult(result);
+    ok &= result.valid;
+    *total_size += result.size;
   }
 
-  return ok ? 0 : 1;
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return ok;
 }
 
 Tool::Tool(string_view filename, SpanU8 data, Options options)
-    : filename(filename),
-      options{options},
-      data{data},
-      errors{data},
-      module{ReadLazyModule(data, options.features, errors)},
-      visitor{options.features, errors} {}
+    : filename(filename), options{options}, data{data}, errors{data} {}
 
 bool Tool::Run() {
+  if (options.cache_dir.empty()) {
+    return Validate();
+  }
+
+  auto path = CachePath();
+  if (auto cached = ReadCache(path)) {
+    return *cached;
+  }
+  bool valid = Validate();
+  WriteCache(path, valid);
+  return valid;
+}
+
+bool Tool::Validate() {
+  auto module = ReadLazyModule(data, options.features, errors);
   if (module.magic && module.version) {
+    valid::ValidateVisitor visitor{options.features, errors,
+                                   options.thread_count};
+    visitor.fused = options.fused;
     visit::Visit(module, visitor);
   }
   return !errors.HasError();
 }
 
+auto Tool::CachePath() const -> fs::path {
+  // The features are part of the key, since they change the result.
+  ContentHash hash{options.features.bits()};
+  hash.Update(data);
+  return fs::path{options.cache_dir} / StrFormat("%016x.valid", hash.Digest());
+}
+
+// A cache file is the header line, then:
+//
+//   <module size> <valid> <error count>
+//
+// followed by a line for each error, then its message:
+//
+//   <has location> <offset> <size> <message size>
+//   <message>
+//
+// The module size is checked too, as a cheap guard against hash collisions.
+auto Tool::ReadCache(const fs::path& path) -> optional<bool> {
+  std::ifstream stream{path, std::ios::in | std::ios::binary};
+  std::string header;
+  if (!stream || !std::getline(stream, header) || header != kCacheHeader) {
+    return nullopt;
+  }
+
+  size_t size, count;
+  bool valid;
+  if (!(stream >> size >> valid >> count) || size != data.size()) {
+    return nullopt;
+  }
+
+  std::vector<Error> cached_errors;
+  for (size_t i = 0; i < count; ++i) {
+    bool has_loc;
+    size_t offset, loc_size, message_size;
+    if (!(stream >> has_loc >> offset >> loc_size >> message_size) ||
+        stream.get() != '\n' || offset > data.size() ||
+        loc_size > data.size() - offset) {
+      return nullopt;
+    }
+    std::string message(message_size, '\0');
+    if (!stream.read(&message[0], message_size)) {
+      return nullopt;
+    }
+    Location loc = has_loc ? data.subspan(offset, loc_size) : Location{};
+    cached_errors.push_back(Error{loc, std::move(message)});
+  }
+
+  for (const auto& error : cached_errors) {
+    errors.OnError(error.loc, error.message);
+  }
+  return valid;
+}
+
+void Tool::WriteCache(const fs::path& path, bool valid) {
+  // Write to a temporary file and rename it, so concurrent runs never see a
+  // partially written cache file.
+  auto temp_path = path;
+  temp_path += StrFormat(".%08x.tmp", std::random_device{}());
+  {
+    std::ofstream stream{temp_path, std::ios::out | std::ios::binary};
+    const auto& error_list = errors.GetErrors();
+    stream << kCacheHeader << "\n"
+           << data.size() << " " << valid << " " << error_list.size() << "\n";
+    for (const auto& error : error_list) {
+      bool has_loc = error.loc.data() != nullptr;
+      size_t offset = has_loc ? error.loc.data() - data.data() : 0;
+      stream << has_loc << " " << offset << " " << error.loc.size() << " "
+             << error.message.size() << "\n"
+             << error.message << "\n";
+    }
+    if (!stream) {
+      std::error_code ec;
+      fs::remove(temp_path, ec);
+      return;
+    }
+  }
+
+  std::error_code ec;
+  fs::rename(temp_path, path, ec);
+  if (ec) {
+    fs::remove(temp_path, ec);
+  }
+}
+
 }  // namespace validate
 }  // namespace tools
 }  // namespace wasp
@@ -95,8 +95,8 @@ int Main(span<const string_view> args) {
     parser.PrintHelpAndExit(1);
   }
 
-  auto optbuf = ReadFile(filename);
-  if (!optbuf) {
+  auto optfile = MapFile(filename);
+  if (!optfile) {
     Format(&std::cerr, "Error reading file %s.\n", filename);
     return 1;
   }
@@ -107,7 +107,7 @@ int Main(span<const string_view> args) {
         fs::path(filename).replace_extension(".wat").string();
   }
 
-  SpanU8 data{*optbuf};
+  SpanU8 data = optfile->data();
   Tool tool{filename, data, options};
   return tool.Run();
 }
@@ -14,6 +14,7 @@
 // limitations under the License.
 //
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -28,6 +29,7 @@
 #include "wasp/base/file.h"
 #include "wasp/base/formatters.h"
 #include "wasp/base/span.h"
+#include "wasp/base/str_to_u32.h"
 #include "wasp/base/string_view.h"
 #include "wasp/binary/encoding.h"
 #include "wasp/binary/formatters.h"
@@ -59,6 +61,7 @@ using absl::Format;
 struct Options {
   Features features;
   bool validate = true;
+  Index thread_count = 1;
   std::string output_filename;
 };
 
@@ -86,6 +89,10 @@ int Main(span<const string_view> args) {
            [&](string_view arg) { options.output_filename = arg; })
       .Add("--no-validate", "Don't validate before writing",
            [&]() { options.validate = false; })
+      .Add('t', "--threads", "<n>", "read module fields on <n> threads",
+           [&](string_view arg) {
+             options.thread_count = std::max(StrToU32(arg).value_or(1), 1u);
+           })
       .AddFeatureFlags(options.features)
       .Add("<filename>", "input wasm file", [&](string_view arg) {
         if (filename.empty()) {
@@ -101,8 +108,8 @@ int Main(span<const string_view> args) {
     parser.PrintHelpAndExit(1);
   }
 
-  auto optbuf = ReadFile(filename);
-  if (!optbuf) {
+  auto optfile = MapFile(filename);
+  if (!optfile) {
     Format(&std::cerr, "Error reading file %s.\n", filename);
     return 1;
   }
@@ -113,7 +120,7 @@ int Main(span<const string_view> args) {
         fs::path(filename).replace_extension(".wasm").string();
   }
 
-  SpanU8 data{*optbuf};
+  SpanU8 data = optfile->data();
   Tool tool{filename, data, options};
   return tool.Run();
 }
@@ -125,6 +132,7 @@ int Tool::Run() {
   text::Tokenizer tokenizer{data};
   tools::TextErrors errors{filename, data};
   text::ReadCtx read_context{options.features, errors};
+  read_context.thread_count = options.thread_count;
   auto text_module =
       ReadSingleModule(tokenizer, read_context).value_or(text::Module{});
   Expect(tokenizer, read_context, text::TokenType::Eof);
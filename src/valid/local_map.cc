@@ -22,7 +22,7 @@
 
 namespace wasp::valid {
 
-LocalMap::LocalMap() {
+LocalMap::LocalMap(Index dense_limit) : dense_limit_{dense_limit} {
   Reset();
 }
 
@@ -30,6 +30,8 @@ void LocalMap::Reset() {
   pairs_.clear();
   let_stack_.clear();
   let_stack_.push_back(0);
+  dense_.clear();
+  use_dense_ = true;
 }
 
 auto LocalMap::GetCount() const -> Index {
@@ -50,6 +52,20 @@ auto LocalMap::GetType(Index index) const -> optional<binary::ValueType>{
   return iter->first;
 }
 
+auto LocalMap::GetStackType(Index index) const -> optional<StackType> {
+  if (use_dense_) {
+    if (index >= dense_.size()) {
+      return nullopt;
+    }
+    return dense_[index];
+  }
+  auto value_type = GetType(index);
+  if (!value_type) {
+    return nullopt;
+  }
+  return StackType{*value_type};
+}
+
 bool LocalMap::Append(Index count, binary::ValueType value_type) {
   if (count == 0) {
     return true;
@@ -77,6 +93,8 @@ bool LocalMap::Append(Index count, binary::ValueType value_type) {
 
   assert(!let_stack_.empty());
   Index insert_at = let_stack_.back();
+  InsertDense(insert_at > 0 ? pairs_[insert_at - 1].second : 0, count,
+              value_type);
 
   if (insert_at > 0) {
     // There's a previous value, see if we can combine this value type.
@@ -117,6 +135,20 @@ bool LocalMap::CanAppend(Index count) const {
   return GetCount() <= std::numeric_limits<Index>::max() - count;
 }
 
+void LocalMap::InsertDense(Index at,
+                           Index count,
+                           binary::ValueType value_type) {
+  if (!use_dense_) {
+    return;
+  }
+  if (count > dense_limit_ - std::min(dense_limit_, GetCount())) {
+    use_dense_ = false;
+    dense_.clear();
+    return;
+  }
+  dense_.insert(dense_.begin() + at, count, StackType{value_type});
+}
+
 void LocalMap::AdjustPartialSums(Pairs::iterator first, Index count) {
   for (auto iter = first; iter != pairs_.end(); ++iter) {
     // Wrap-around is OK here, since the adjustment may be positive or negative.
@@ -139,6 +171,9 @@ void LocalMap::Pop() {
 
     // Erase all pairs corresponding to this let block.
     pairs_.erase(pairs_.begin(), pairs_.begin() + pair_count);
+    if (use_dense_) {
+      dense_.erase(dense_.begin(), dense_.begin() + var_count);
+    }
 
     // Adjust the partial sums to remove the number of variables from this let
     // block.
@@ -17,7 +17,9 @@
 #include "wasp/valid/match.h"
 
 #include <cassert>
+#include <vector>
 
+#include "wasp/base/hashmap.h"
 #include "wasp/valid/valid_ctx.h"
 
 namespace wasp::valid {
@@ -121,8 +123,12 @@ bool IsSame(ValidCtx& ctx,
 bool IsSame(ValidCtx& ctx, const StackType& expected, const StackType& actual) {
   // One of the types is "any" (i.e. universal supertype or subtype), or the
   // value types are the same.
-  return expected.is_any() || actual.is_any() ||
-         IsSame(ctx, expected.value_type(), actual.value_type());
+  if (expected.is_any() || actual.is_any() || expected == actual) {
+    return true;
+  } else if (expected.is_numeric_type() || actual.is_numeric_type()) {
+    return false;
+  }
+  return IsSame(ctx, expected.value_type(), actual.value_type());
 }
 
 bool IsSame(ValidCtx& ctx, StackTypeSpan expected, StackTypeSpan actual) {
@@ -236,6 +242,10 @@ bool IsMatch(ValidCtx& ctx,
     // Check whether heap types match, but make sure to handle recursive
     // structures. This is the same logic used in IsSame(HeapType, HeapType).
 
+    if (ctx.same_types.IsSameClass(expected_index, actual_index)) {
+      return true;
+    }
+
     auto is_match_opt = ctx.match_types.Get(expected_index, actual_index);
     if (is_match_opt) {
       return *is_match_opt;
@@ -316,8 +326,12 @@ bool IsMatch(ValidCtx& ctx,
              const StackType& actual) {
   // One of the types is "any" (i.e. universal supertype or subtype), or the
   // value types match.
-  return expected.is_any() || actual.is_any() ||
-         IsMatch(ctx, expected.value_type(), actual.value_type());
+  if (expected.is_any() || actual.is_any() || expected == actual) {
+    return true;
+  } else if (expected.is_numeric_type() || actual.is_numeric_type()) {
+    return false;
+  }
+  return IsMatch(ctx, expected.value_type(), actual.value_type());
 }
 
 bool IsMatch(ValidCtx& ctx, StackTypeSpan expected, StackTypeSpan actual) {
@@ -407,4 +421,126 @@ bool IsMatch(ValidCtx& ctx,
   return false;
 }
 
+/// ComputeTypeClasses ///
+
+namespace {
+
+// The structure of a defined type, with each type index replaced by a marker
+// and appended to `refs`. Two types can only be the same if their shapes are
+// equal and their refs are pairwise the same.
+struct TypeShape {
+  std::vector<u64> shape;
+  std::vector<Index> refs;
+};
+
+enum : u64 {
+  kFunctionTag,
+  kStructTag,
+  kArrayTag,
+  // Not a StackType::Kind, so packed types differ from all value types.
+  kPackedTypeTag = 0xff,
+  // Out-of-range type indexes are only the same as themselves.
+  kInvalidIndexTag = u64{1} << 32,
+};
+
+void AppendShape(TypeShape& out, binary::ValueType type) {
+  if (type.is_reference_type()) {
+    // Canonicalize, since IsSame treats "funcref" and "ref null func" alike.
+    type = binary::ValueType{Canonicalize(type.reference_type())};
+  }
+  StackType stack_type{type};
+  if (stack_type.has_index) {
+    out.refs.push_back(stack_type.index);
+  }
+  out.shape.push_back(u64(stack_type.kind) | (u64(stack_type.code) << 8) |
+                      (u64(stack_type.nullable) << 16) |
+                      (u64(stack_type.has_index) << 17) |
+                      (u64(stack_type.depth) << 32));
+}
+
+void AppendShape(TypeShape& out, const binary::ValueTypeList& types) {
+  out.shape.push_back(types.size());
+  for (const auto& type : types) {
+    AppendShape(out, type.value());
+  }
+}
+
+void AppendShape(TypeShape& out, const binary::FieldType& field_type) {
+  const auto& storage_type = field_type.type.value();
+  if (storage_type.is_packed_type()) {
+    out.shape.push_back(kPackedTypeTag |
+                        (u64(storage_type.packed_type().value()) << 8));
+  } else {
+    AppendShape(out, storage_type.value_type().value());
+  }
+  out.shape.push_back(u64(field_type.mut.value()));
+}
+
+auto GetTypeShape(const binary::DefinedType& type) -> TypeShape {
+  TypeShape result;
+  if (type.is_function_type()) {
+    result.shape.push_back(kFunctionTag);
+    AppendShape(result, type.function_type()->param_types);
+    AppendShape(result, type.function_type()->result_types);
+  } else if (type.is_struct_type()) {
+    const auto& fields = type.struct_type()->fields;
+    result.shape.push_back(kStructTag);
+    result.shape.push_back(fields.size());
+    for (const auto& field : fields) {
+      AppendShape(result, field.value());
+    }
+  } else {
+    assert(type.is_array_type());
+    result.shape.push_back(kArrayTag);
+    AppendShape(result, type.array_type()->field.value());
+  }
+  return result;
+}
+
+}  // namespace
+
+auto ComputeTypeClasses(const std::vector<binary::DefinedType>& types)
+    -> std::vector<Index> {
+  const Index count = static_cast<Index>(types.size());
+  std::vector<TypeShape> shapes;
+  shapes.reserve(count);
+  for (const auto& type : types) {
+    shapes.push_back(GetTypeShape(type));
+  }
+
+  // Bucket the types by shape.
+  std::vector<Index> classes(count);
+  size_t class_count;
+  {
+    flat_hash_map<std::vector<u64>, Index> ids;
+    for (Index i = 0; i < count; ++i) {
+      classes[i] = ids.emplace(shapes[i].shape, ids.size()).first->second;
+    }
+    class_count = ids.size();
+  }
+
+  // Split each class by the classes of the types it refers to, until no
+  // class is split. Since a type's key includes its current class, classes
+  // are only ever split, so this finishes in at most `count` rounds.
+  std::vector<Index> new_classes(count);
+  std::vector<u64> key;
+  while (true) {
+    flat_hash_map<std::vector<u64>, Index> ids;
+    for (Index i = 0; i < count; ++i) {
+      key.clear();
+      key.push_back(classes[i]);
+      for (Index ref : shapes[i].refs) {
+        key.push_back(ref < count ? classes[ref] : kInvalidIndexTag | ref);
+      }
+      new_classes[i] = ids.emplace(key, ids.size()).first->second;
+    }
+    if (ids.size() == class_count) {
+      break;
+    }
+    class_count = ids.size();
+    classes.swap(new_classes);
+  }
+  return classes;
+}
+
 }  // namespace wasp::valid
@@ -24,35 +24,89 @@
 
 namespace wasp::valid {
 
-StackType::StackType() : type{Any{}} {}
+namespace {
 
-StackType::StackType(binary::ValueType type) : type{type} {}
+void SetHeapType(StackType& stack_type, const binary::HeapType& heap_type) {
+  if (heap_type.is_heap_kind()) {
+    stack_type.code = static_cast<u8>(heap_type.heap_kind().value());
+  } else {
+    stack_type.has_index = true;
+    stack_type.index = heap_type.index().value();
+  }
+}
 
-StackType::StackType(Any type) : type{type} {}
+auto GetHeapType(const StackType& stack_type) -> binary::HeapType {
+  if (stack_type.has_index) {
+    return binary::HeapType{stack_type.index};
+  } else {
+    return binary::HeapType{static_cast<HeapKind>(stack_type.code)};
+  }
+}
+
+}  // namespace
+
+StackType::StackType() : StackType{Any{}} {}
+
+StackType::StackType(binary::ValueType type) : StackType{Any{}} {
+  if (type.is_numeric_type()) {
+    kind = Kind::NumericType;
+    code = static_cast<u8>(type.numeric_type().value());
+  } else if (type.is_reference_type()) {
+    const auto& reference_type = type.reference_type();
+    if (reference_type->is_reference_kind()) {
+      kind = Kind::ReferenceKind;
+      code = static_cast<u8>(reference_type->reference_kind().value());
+    } else {
+      const auto& ref = reference_type->ref();
+      kind = Kind::Ref;
+      nullable = ref->null == Null::Yes;
+      SetHeapType(*this, ref->heap_type);
+    }
+  } else {
+    assert(type.is_rtt());
+    const auto& rtt = type.rtt();
+    kind = Kind::Rtt;
+    depth = rtt->depth;
+    SetHeapType(*this, rtt->type);
+  }
+}
+
+StackType::StackType(Any)
+    : kind{Kind::Any},
+      code{0},
+      nullable{false},
+      has_index{false},
+      index{0},
+      depth{0} {}
+
+StackType::StackType(NumericType type) : StackType{Any{}} {
+  kind = Kind::NumericType;
+  code = static_cast<u8>(type);
+}
 
 // static
 StackType StackType::I32() {
-  return StackType{binary::ValueType::I32_NoLocation()};
+  return StackType{NumericType::I32};
 }
 
 // static
 StackType StackType::I64() {
-  return StackType{binary::ValueType::I64_NoLocation()};
+  return StackType{NumericType::I64};
 }
 
 // static
 StackType StackType::F32() {
-  return StackType{binary::ValueType::F32_NoLocation()};
+  return StackType{NumericType::F32};
 }
 
 // static
 StackType StackType::F64() {
-  return StackType{binary::ValueType::F64_NoLocation()};
+  return StackType{NumericType::F64};
 }
 
 // static
 StackType StackType::V128() {
-  return StackType{binary::ValueType::V128_NoLocation()};
+  return StackType{NumericType::V128};
 }
 
 // static
@@ -85,20 +139,25 @@ StackType StackType::Exnref() {
   return StackType{binary::ValueType::Exnref_NoLocation()};
 }
 
-bool StackType::is_value_type() const {
-  return holds_alternative<binary::ValueType>(type);
-}
+auto StackType::value_type() const -> binary::ValueType {
+  switch (kind) {
+    case Kind::NumericType:
+      return binary::ValueType{static_cast<NumericType>(code)};
 
-bool StackType::is_any() const {
-  return holds_alternative<Any>(type);
-}
+    case Kind::ReferenceKind:
+      return binary::ValueType{
+          binary::ReferenceType{static_cast<ReferenceKind>(code)}};
 
-auto StackType::value_type() -> binary::ValueType& {
-  return get<binary::ValueType>(type);
-}
+    case Kind::Ref:
+      return binary::ValueType{binary::ReferenceType{binary::RefType{
+          GetHeapType(*this), nullable ? Null::Yes : Null::No}}};
 
-auto StackType::value_type() const -> const binary::ValueType& {
-  return get<binary::ValueType>(type);
+    case Kind::Rtt:
+      return binary::ValueType{binary::Rtt{depth, GetHeapType(*this)}};
+
+    default:
+      WASP_UNREACHABLE();
+  }
 }
 
 auto ToValueType(binary::StorageType type) -> binary::ValueType {
@@ -159,12 +218,14 @@ auto ToStackTypeList(const binary::LocalsList& locals_list) -> StackTypeList {
 }
 
 bool IsReferenceTypeOrAny(StackType type) {
-  return type.is_any() ||
-         (type.is_value_type() && type.value_type().is_reference_type());
+  return type.kind == StackType::Kind::Any ||
+         type.kind == StackType::Kind::ReferenceKind ||
+         type.kind == StackType::Kind::Ref;
 }
 
 bool IsRttOrAny(StackType type) {
-  return type.is_any() || (type.is_value_type() && type.value_type().is_rtt());
+  return type.kind == StackType::Kind::Any ||
+         type.kind == StackType::Kind::Rtt;
 }
 
 auto Canonicalize(binary::ReferenceType type) -> binary::ReferenceType {
@@ -227,8 +288,7 @@ bool IsNullableType(binary::ValueType type) {
 }
 
 bool IsNullableType(StackType type) {
-  return type.is_any() ||
-         (type.is_value_type() && IsNullableType(type.value_type()));
+  return IsReferenceTypeOrAny(type);
 }
 
 auto AsNonNullableType(binary::RefType type) -> binary::RefType {
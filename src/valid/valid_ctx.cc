@@ -21,12 +21,14 @@
 namespace wasp::valid {
 
 Label::Label(LabelType label_type,
-             StackTypeSpan param_types,
-             StackTypeSpan result_types,
+             Index types_begin,
+             Index param_count,
+             Index result_count,
              Index type_stack_limit)
     : label_type{label_type},
-      param_types{param_types.begin(), param_types.end()},
-      result_types{result_types.begin(), result_types.end()},
+      types_begin{types_begin},
+      param_count{param_count},
+      result_count{result_count},
       type_stack_limit{type_stack_limit},
       unreachable{false} {}
 
@@ -44,6 +46,49 @@ void ValidCtx::Reset() {
   *this = ValidCtx{features, *errors};
 }
 
+void ValidCtx::PushLabel(LabelType label_type,
+                         const binary::ValueTypeList& param_types,
+                         const binary::ValueTypeList& result_types,
+                         Index type_stack_limit) {
+  Index types_begin = static_cast<Index>(label_types.size());
+  for (const auto& value_type : param_types) {
+    label_types.push_back(StackType{*value_type});
+  }
+  for (const auto& value_type : result_types) {
+    label_types.push_back(StackType{*value_type});
+  }
+  label_stack.emplace_back(label_type, types_begin,
+                           static_cast<Index>(param_types.size()),
+                           static_cast<Index>(result_types.size()),
+                           type_stack_limit);
+}
+
+void ValidCtx::PopLabel() {
+  assert(!label_stack.empty());
+  label_types.resize(label_stack.back().types_begin);
+  label_stack.pop_back();
+}
+
+void ValidCtx::ClearLabels() {
+  label_stack.clear();
+  label_types.clear();
+}
+
+auto ValidCtx::GetParamTypes(const Label& label) const -> StackTypeSpan {
+  return StackTypeSpan{label_types}.subspan(label.types_begin,
+                                            label.param_count);
+}
+
+auto ValidCtx::GetResultTypes(const Label& label) const -> StackTypeSpan {
+  return StackTypeSpan{label_types}.subspan(
+      label.types_begin + label.param_count, label.result_count);
+}
+
+auto ValidCtx::GetBrTypes(const Label& label) const -> StackTypeSpan {
+  return label.label_type == LabelType::Loop ? GetParamTypes(label)
+                                             : GetResultTypes(label);
+}
+
 bool ValidCtx::IsStackPolymorphic() const {
   assert(!label_stack.empty());
   return label_stack.back().unreachable;
@@ -63,9 +108,32 @@ bool ValidCtx::IsArrayType(Index index) const {
 
 void SameTypes::Reset(Index size) {
   disjoint_set_.Reset(size);
+  classified_count_ = 0;
+  assume_.clear();
+}
+
+void SameTypes::SetClasses(const std::vector<Index>& type_classes) {
+  Index count = static_cast<Index>(type_classes.size());
+  assert(count == 0 || disjoint_set_.IsValid(count - 1));
+  // Merge each type into the first type of its class.
+  std::vector<Index> first_of_class(count, count);
+  for (Index i = 0; i < count; ++i) {
+    Index& first = first_of_class[type_classes[i]];
+    if (first == count) {
+      first = i;
+    } else {
+      disjoint_set_.MergeSets(first, i);
+    }
+  }
+  classified_count_ = count;
   assume_.clear();
 }
 
+bool SameTypes::IsSameClass(Index expected, Index actual) {
+  return expected < classified_count_ && actual < classified_count_ &&
+         disjoint_set_.IsSameSet(expected, actual);
+}
+
 auto SameTypes::Get(Index expected, Index actual) -> optional<bool> {
   MaybeSwapIndexes(expected, actual);
   if (!(disjoint_set_.IsValid(expected) && disjoint_set_.IsValid(actual))) {
@@ -78,6 +146,11 @@ auto SameTypes::Get(Index expected, Index actual) -> optional<bool> {
     return true;
   }
 
+  if (actual < classified_count_) {
+    // Both types have been assigned to classes, and they're different.
+    return false;
+  }
+
   auto iter = assume_.find({expected, actual});
   if (iter == assume_.end()) {
     return nullopt;
@@ -28,6 +28,7 @@
 #include "wasp/binary/lazy_expression.h"
 #include "wasp/valid/match.h"
 #include "wasp/valid/valid_ctx.h"
+#include "wasp/valid/validation_snapshot.h"
 
 namespace wasp::valid {
 
@@ -48,6 +49,12 @@ bool EndTypeSection(ValidCtx& ctx) {
   // since it allows the type and import sections (among others) to be
   // repeated.
   ctx.defined_type_count = static_cast<Index>(ctx.types.size());
+
+  // Only the function-references and GC proposals allow value types to refer
+  // to defined types, so only they need type equivalence classes.
+  if (ctx.features.function_references_enabled()) {
+    ctx.same_types.SetClasses(ComputeTypeClasses(ctx.types));
+  }
   return true;
 }
 
@@ -62,7 +69,7 @@ bool BeginCode(ValidCtx& ctx, Location loc) {
   ctx.code_count++;
   const binary::Function& function = ctx.functions[func_index];
   ctx.type_stack.clear();
-  ctx.label_stack.clear();
+  ctx.ClearLabels();
   ctx.locals.Reset();
   // Don't validate the index, should have already been validated at this point.
   if (function.type_index < ctx.types.size()) {
@@ -75,13 +82,12 @@ bool BeginCode(ValidCtx& ctx, Location loc) {
     assert(defined_type.is_function_type());
     const auto& function_type = defined_type.function_type();
     ctx.locals.Append(function_type->param_types);
-    ctx.label_stack.push_back(
-        Label{LabelType::Function, ToStackTypeList(function_type->param_types),
-              ToStackTypeList(function_type->result_types), 0});
+    ctx.PushLabel(LabelType::Function, function_type->param_types,
+                  function_type->result_types, 0);
     return true;
   } else {
     // Not valid, but try to continue anyway.
-    ctx.label_stack.push_back(Label{LabelType::Function, {}, {}, 0});
+    ctx.PushLabel(LabelType::Function, {}, {}, 0);
     return false;
   }
 }
@@ -135,6 +141,22 @@ bool Validate(ValidCtx& ctx, const At<binary::UnpackedCode>& value) {
   return valid;
 }
 
+bool Validate(ValidCtx& ctx, const binary::PackedExpression& value) {
+  bool valid = true;
+  for (auto&& instr : value) {
+    valid &= Validate(ctx, instr);
+  }
+  return valid;
+}
+
+bool Validate(ValidCtx& ctx, const At<binary::PackedCode>& value) {
+  bool valid = true;
+  valid &= BeginCode(ctx, value.loc());
+  valid &= Validate(ctx, value->locals, RequireDefaultable::Yes);
+  valid &= Validate(ctx, value->body);
+  return valid;
+}
+
 bool Validate(ValidCtx& ctx, const At<binary::ArrayType>& value) {
   ErrorsContextGuard guard{*ctx.errors, value.loc(), "array type"};
   return Validate(ctx, value->field);
@@ -154,16 +176,13 @@ bool Validate(ValidCtx& ctx,
   bool valid = true;
   ValidCtx new_context{ctx};
   new_context.type_stack.clear();
-  new_context.label_stack.clear();
+  new_context.ClearLabels();
   new_context.locals.Reset();
 
   // Validate as if this expression was a function that takes no parameters,
   // and returns the expected type.
-  new_context.label_stack.push_back(
-      Label{LabelType::Function,
-            {},
-            ToStackTypeList(binary::ValueTypeList{expected_type}),
-            0});
+  new_context.PushLabel(LabelType::Function, {},
+                        binary::ValueTypeList{expected_type}, 0);
 
   for (auto&& instruction : value->instructions) {
     switch (instruction->opcode) {
@@ -267,10 +286,11 @@ bool Validate(ValidCtx& ctx,
     case Opcode::RefFunc: {
       actual_type = binary::ReferenceType::Funcref_NoLocation();
       auto index = instruction->index_immediate();
-      if (!ValidateFunctionIndex(ctx, index)) {
+      if (ValidateFunctionIndex(ctx, index)) {
+        ctx.declared_functions.insert(index);
+      } else {
         valid = false;
       }
-      ctx.declared_functions.insert(index);
       break;
     }
 
@@ -321,8 +341,9 @@ bool Validate(ValidCtx& ctx, const At<binary::ElementSegment>& value) {
     }
 
     for (auto index : elements.list) {
-      valid &= ValidateIndex(ctx, index, max_index, "index");
-      if (elements.kind == ExternalKind::Function) {
+      if (!ValidateIndex(ctx, index, max_index, "index")) {
+        valid = false;
+      } else if (elements.kind == ExternalKind::Function) {
         ctx.declared_functions.insert(index);
       }
     }
@@ -341,17 +362,19 @@ bool Validate(ValidCtx& ctx, const At<binary::Export>& value) {
   ErrorsContextGuard guard{*ctx.errors, value.loc(), "export"};
   bool valid = true;
 
-  if (ctx.export_names.find(value->name) != ctx.export_names.end()) {
+  if (!ctx.export_names.insert(value->name).second) {
     ctx.errors->OnError(value.loc(),
                         concat("Duplicate export name ", value->name));
     valid = false;
   }
-  ctx.export_names.insert(value->name);
 
   switch (value->kind) {
     case ExternalKind::Function:
-      valid &= ValidateFunctionIndex(ctx, value->index);
-      ctx.declared_functions.insert(value->index);
+      if (ValidateFunctionIndex(ctx, value->index)) {
+        ctx.declared_functions.insert(value->index);
+      } else {
+        valid = false;
+      }
       break;
 
     case ExternalKind::Table:
@@ -787,7 +810,11 @@ bool ValidateKnownSection(ValidCtx& ctx, const optional<T>& value) {
   return valid;
 }
 
-bool Validate(ValidCtx& ctx, const binary::Module& value) {
+namespace {
+
+// Validates the sections that precede the code section, i.e. everything that
+// function bodies are validated against.
+bool ValidateModuleContext(ValidCtx& ctx, const binary::Module& value) {
   bool valid = true;
   valid &= BeginTypeSection(ctx, static_cast<Index>(value.types.size()));
   valid &= ValidateKnownSection(ctx, value.types);
@@ -798,13 +825,81 @@ bool Validate(ValidCtx& ctx, const binary::Module& value) {
   valid &= ValidateKnownSection(ctx, value.memories);
   valid &= ValidateKnownSection(ctx, value.globals);
   valid &= ValidateKnownSection(ctx, value.events);
+  ctx.export_names.reserve(value.exports.size());
   valid &= ValidateKnownSection(ctx, value.exports);
   valid &= ValidateKnownSection(ctx, value.start);
   valid &= ValidateKnownSection(ctx, value.element_segments);
   valid &= ValidateKnownSection(ctx, value.data_count);
+  return valid;
+}
+
+template <typename T>
+void AddContextItems(ValidationSnapshotBuilder& builder,
+                     binary::SectionId id,
+                     const std::vector<T>& values) {
+  for (auto& value : values) {
+    builder.OnContextItem(id, value.loc());
+  }
+}
+
+template <typename T>
+void AddContextItems(ValidationSnapshotBuilder& builder,
+                     binary::SectionId id,
+                     const optional<T>& value) {
+  if (value) {
+    builder.OnContextItem(id, value->loc());
+  }
+}
+
+}  // namespace
+
+bool Validate(ValidCtx& ctx, const binary::Module& value) {
+  bool valid = true;
+  valid &= ValidateModuleContext(ctx, value);
   valid &= ValidateKnownSection(ctx, value.codes);
   valid &= ValidateKnownSection(ctx, value.data_segments);
   return valid;
 }
 
+bool Validate(ValidCtx& ctx, const binary::PackedModule& value) {
+  bool valid = true;
+  valid &= ValidateModuleContext(ctx, value.module);
+  valid &= ValidateKnownSection(ctx, value.codes);
+  valid &= ValidateKnownSection(ctx, value.module.data_segments);
+  return valid;
+}
+
+bool Validate(ValidCtx& ctx,
+              const binary::Module& value,
+              ValidationSnapshot& snapshot) {
+  using binary::SectionId;
+  ValidationSnapshotBuilder builder{ctx.features, snapshot};
+  AddContextItems(builder, SectionId::Type, value.types);
+  AddContextItems(builder, SectionId::Import, value.imports);
+  AddContextItems(builder, SectionId::Function, value.functions);
+  AddContextItems(builder, SectionId::Table, value.tables);
+  AddContextItems(builder, SectionId::Memory, value.memories);
+  AddContextItems(builder, SectionId::Global, value.globals);
+  AddContextItems(builder, SectionId::Event, value.events);
+  AddContextItems(builder, SectionId::Export, value.exports);
+  AddContextItems(builder, SectionId::Start, value.start);
+  AddContextItems(builder, SectionId::Element, value.element_segments);
+  AddContextItems(builder, SectionId::DataCount, value.data_count);
+
+  bool valid = ValidateModuleContext(ctx, value);
+  builder.EndContext(valid);
+  for (auto& code : value.codes) {
+    Index code_index = ctx.code_count;
+    if (builder.BeginCode(code_index, code.loc())) {
+      ctx.code_count++;
+      continue;
+    }
+    bool code_valid = Validate(ctx, code);
+    builder.EndCode(code_index, code_valid);
+    valid &= code_valid;
+  }
+  valid &= ValidateKnownSection(ctx, value.data_segments);
+  return valid;
+}
+
 }  // namespace wasp::valid
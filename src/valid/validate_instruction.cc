@@ -26,6 +26,10 @@
 #include "wasp/base/macros.h"
 #include "wasp/base/types.h"
 #include "wasp/binary/formatters.h"
+#include "wasp/binary/packed_expression.h"
+#include "wasp/binary/read.h"
+#include "wasp/binary/read/read_ctx.h"
+#include "wasp/binary/read/read_var_int.h"
 #include "wasp/valid/formatters.h"
 #include "wasp/valid/match.h"
 #include "wasp/valid/valid_ctx.h"
@@ -72,16 +76,24 @@ bool AllTrue(T first, Args... rest) {
   return !!first & AllTrue(rest...);
 }
 
-optional<FunctionType> GetFunctionType(ValidCtx& ctx, At<Index> index) {
+// Like GetFunctionType, but without copying the function type.
+const FunctionType* GetFunctionTypePtr(ValidCtx& ctx, At<Index> index) {
   if (!ValidateIndex(ctx, index, static_cast<Index>(ctx.types.size()),
                      "type index")) {
-    return nullopt;
+    return nullptr;
   }
   if (!ctx.types[index].is_function_type()) {
     ctx.errors->OnError(index.loc(), "Expected a function type");
-    return nullopt;
+    return nullptr;
+  }
+  return &ctx.types[index].function_type().value();
+}
+
+optional<FunctionType> GetFunctionType(ValidCtx& ctx, At<Index> index) {
+  if (const auto* function_type = GetFunctionTypePtr(ctx, index)) {
+    return *function_type;
   }
-  return ctx.types[index].function_type();
+  return nullopt;
 }
 
 optional<StructType> GetStructType(ValidCtx& ctx, At<Index> index) {
@@ -160,19 +172,31 @@ optional<PackedType> GetStructFieldPackedType(ValidCtx& ctx,
   return GetFieldPackedType(ctx, loc, *field_type);
 }
 
-optional<FunctionType> GetBlockTypeSignature(ValidCtx& ctx,
-                                             BlockType block_type) {
+// Appends the param types and result types of the block type to
+// ctx.label_types, and returns the number of params.
+optional<Index> AppendBlockTypeSignature(ValidCtx& ctx, BlockType block_type) {
   if (block_type.is_void()) {
-    return FunctionType{};
+    return 0;
   } else if (block_type.is_value_type()) {
     const auto& value_type = block_type.value_type();
     if (!Validate(ctx, value_type)) {
       return nullopt;
     }
-    return FunctionType{{}, {value_type}};
+    ctx.label_types.push_back(StackType{*value_type});
+    return 0;
   } else {
     assert(block_type.is_index());
-    return GetFunctionType(ctx, block_type.index());
+    const auto* function_type = GetFunctionTypePtr(ctx, block_type.index());
+    if (!function_type) {
+      return nullopt;
+    }
+    for (const auto& value_type : function_type->param_types) {
+      ctx.label_types.push_back(StackType{*value_type});
+    }
+    for (const auto& value_type : function_type->result_types) {
+      ctx.label_types.push_back(StackType{*value_type});
+    }
+    return static_cast<Index>(function_type->param_types.size());
   }
 }
 
@@ -238,11 +262,7 @@ optional<StackType> GetLocalType(ValidCtx& ctx, At<Index> index) {
   if (!ValidateIndex(ctx, index, ctx.locals.GetCount(), "local index")) {
     return nullopt;
   }
-  auto local_type = ctx.locals.GetType(index);
-  if (!local_type) {
-    return nullopt;
-  }
-  return StackType(*local_type);
+  return ctx.locals.GetStackType(index);
 }
 
 bool CheckDataSegment(ValidCtx& ctx, At<Index> index) {
@@ -281,7 +301,7 @@ ReferenceType MaybeDefault(optional<ReferenceType> value) {
 }
 
 Label MaybeDefault(const Label* value) {
-  return value ? *value : Label{LabelType::Block, {}, {}, 0};
+  return value ? *value : Label{LabelType::Block, 0, 0, 0, 0};
 }
 
 optional<StackType> PeekType(ValidCtx& ctx, Location loc) {
@@ -338,7 +358,7 @@ bool CheckResultTypes(ValidCtx& ctx,
   auto* label = GetFunctionLabel(ctx);
   assert(label != nullptr);
   auto caller = ToStackTypeList(function_type.result_types);
-  auto callee = label->br_types();
+  auto callee = ctx.GetBrTypes(*label);
 
   if (!IsMatch(ctx, callee, caller)) {
     ctx.errors->OnError(loc,
@@ -515,17 +535,22 @@ Label* GetFunctionLabel(ValidCtx& ctx) {
   return GetLabel(ctx, static_cast<Index>(ctx.label_stack.size() - 1));
 }
 
+// Pushes a label whose signature has already been appended to
+// ctx.label_types, starting at `types_begin`.
 bool PushLabel(ValidCtx& ctx,
                Location loc,
                LabelType label_type,
-               const FunctionType& type) {
-  auto stack_param_types = ToStackTypeList(type.param_types);
-  auto stack_result_types = ToStackTypeList(type.result_types);
-  bool valid = PopTypes(ctx, loc, stack_param_types);
-  ctx.label_stack.emplace_back(label_type, stack_param_types,
-                               stack_result_types,
+               Index types_begin,
+               Index param_count) {
+  // The types are added before the label itself, so the params can be popped
+  // from the enclosing label's stack directly from ctx.label_types.
+  auto types = StackTypeSpan{ctx.label_types}.subspan(types_begin);
+  auto param_types = types.subspan(0, param_count);
+  bool valid = PopTypes(ctx, loc, param_types);
+  ctx.label_stack.emplace_back(label_type, types_begin, param_count,
+                               static_cast<Index>(types.size()) - param_count,
                                static_cast<Index>(ctx.type_stack.size()));
-  PushTypes(ctx, stack_param_types);
+  PushTypes(ctx, param_types);
   return valid;
 }
 
@@ -533,11 +558,12 @@ bool PushLabel(ValidCtx& ctx,
                Location loc,
                LabelType label_type,
                BlockType block_type) {
-  auto sig = GetBlockTypeSignature(ctx, block_type);
-  if (!sig) {
+  Index types_begin = static_cast<Index>(ctx.label_types.size());
+  auto param_count = AppendBlockTypeSignature(ctx, block_type);
+  if (!param_count) {
     return false;
   }
-  return PushLabel(ctx, loc, label_type, *sig);
+  return PushLabel(ctx, loc, label_type, types_begin, *param_count);
 }
 
 bool CheckTypeStackEmpty(ValidCtx& ctx, Location loc) {
@@ -556,7 +582,7 @@ bool Catch(ValidCtx& ctx, Location loc) {
     ctx.errors->OnError(loc, "Got catch instruction without try");
     return false;
   }
-  bool valid = PopTypes(ctx, loc, top_label.result_types);
+  bool valid = PopTypes(ctx, loc, ctx.GetResultTypes(top_label));
   valid &= CheckTypeStackEmpty(ctx, loc);
   ResetTypeStackToLimit(ctx);
   PushTypes(ctx, span_exnref);
@@ -571,10 +597,10 @@ bool Else(ValidCtx& ctx, Location loc) {
     ctx.errors->OnError(loc, "Got else instruction without if");
     return false;
   }
-  bool valid = PopTypes(ctx, loc, top_label.result_types);
+  bool valid = PopTypes(ctx, loc, ctx.GetResultTypes(top_label));
   valid &= CheckTypeStackEmpty(ctx, loc);
   ResetTypeStackToLimit(ctx);
-  PushTypes(ctx, top_label.param_types);
+  PushTypes(ctx, ctx.GetParamTypes(top_label));
   top_label.label_type = LabelType::Else;
   top_label.unreachable = false;
   return valid;
@@ -588,17 +614,17 @@ bool End(ValidCtx& ctx, Location loc) {
   } else if (top_label.label_type == LabelType::Let) {
     ctx.locals.Pop();
   }
-  valid &= PopTypes(ctx, loc, top_label.result_types);
+  valid &= PopTypes(ctx, loc, ctx.GetResultTypes(top_label));
   valid &= CheckTypeStackEmpty(ctx, loc);
   ResetTypeStackToLimit(ctx);
-  PushTypes(ctx, top_label.result_types);
-  ctx.label_stack.pop_back();
+  PushTypes(ctx, ctx.GetResultTypes(top_label));
+  ctx.PopLabel();
   return valid;
 }
 
 bool Br(ValidCtx& ctx, Location loc, At<Index> depth) {
   const auto* label = GetLabel(ctx, depth);
-  bool valid = PopTypes(ctx, loc, MaybeDefault(label).br_types());
+  bool valid = PopTypes(ctx, loc, ctx.GetBrTypes(MaybeDefault(label)));
   SetUnreachable(ctx);
   return AllTrue(label, valid);
 }
@@ -606,53 +632,70 @@ bool Br(ValidCtx& ctx, Location loc, At<Index> depth) {
 bool BrIf(ValidCtx& ctx, Location loc, At<Index> depth) {
   bool valid = PopType(ctx, loc, StackType::I32());
   const auto* label = GetLabel(ctx, depth);
-  auto label_ = MaybeDefault(label);
-  return AllTrue(
-      valid, label,
-      PopAndPushTypes(ctx, loc, label_.br_types(), label_.br_types()));
+  auto br_types = ctx.GetBrTypes(MaybeDefault(label));
+  return AllTrue(valid, label, PopAndPushTypes(ctx, loc, br_types, br_types));
 }
 
+bool BrTableTarget(ValidCtx& ctx, StackTypeSpan br_types, At<Index> target) {
+  const auto* label = GetLabel(ctx, target);
+  if (!label) {
+    return false;
+  }
+  bool valid = true;
+  StackTypeSpan label_br_types = ctx.GetBrTypes(*label);
+  if (ctx.features.function_references_enabled()) {
+    if (br_types.size() != label_br_types.size()) {
+      ctx.errors->OnError(
+          target.loc(),
+          concat("br_table labels must have the same arity; expected ",
+                 br_types.size(), ", got ", label_br_types.size()));
+      valid = false;
+    }
+    valid &= CheckTypes(ctx, target.loc(), label_br_types);
+  } else {
+    if (br_types != label_br_types) {
+      ctx.errors->OnError(
+          target.loc(),
+          concat("br_table labels must have the same signature; expected ",
+                 br_types, ", got ", label_br_types));
+      valid = false;
+    }
+  }
+  return valid;
+}
+
+// `for_each_target` is called with a function that checks one target, so the
+// targets don't have to be stored in a BrTableImmediate.
+template <typename F>
 bool BrTable(ValidCtx& ctx,
              Location loc,
-             const At<BrTableImmediate>& immediate) {
+             At<Index> default_target,
+             F&& for_each_target) {
   bool valid = PopType(ctx, loc, StackType::I32());
-  const auto* default_label = GetLabel(ctx, immediate->default_target);
+  const auto* default_label = GetLabel(ctx, default_target);
   if (!default_label) {
     return false;
   }
 
-  StackTypeSpan br_types = default_label->br_types();
-  valid &= CheckTypes(ctx, immediate->default_target.loc(), br_types);
-
-  for (auto target : immediate->targets) {
-    const auto* label = GetLabel(ctx, target);
-    if (label) {
-      if (ctx.features.function_references_enabled()) {
-        if (br_types.size() != label->br_types().size()) {
-          ctx.errors->OnError(
-              target.loc(),
-              concat("br_table labels must have the same arity; expected ",
-                     br_types.size(), ", got ", label->br_types().size()));
-          valid = false;
-        }
-        valid &= CheckTypes(ctx, target.loc(), label->br_types());
-      } else {
-        if (br_types != label->br_types()) {
-          ctx.errors->OnError(
-              target.loc(),
-              concat("br_table labels must have the same signature; expected ",
-                     br_types, ", got ", label->br_types()));
-          valid = false;
-        }
-      }
-    } else {
-      valid = false;
-    }
-  }
+  StackTypeSpan br_types = ctx.GetBrTypes(*default_label);
+  valid &= CheckTypes(ctx, default_target.loc(), br_types);
+  for_each_target([&](At<Index> target) {
+    valid &= BrTableTarget(ctx, br_types, target);
+  });
   SetUnreachable(ctx);
   return valid;
 }
 
+bool BrTable(ValidCtx& ctx,
+             Location loc,
+             const At<BrTableImmediate>& immediate) {
+  return BrTable(ctx, loc, immediate->default_target, [&](auto&& check) {
+    for (auto target : immediate->targets) {
+      check(target);
+    }
+  });
+}
+
 bool Call(ValidCtx& ctx, Location loc, At<Index> function_index) {
   auto function = GetFunction(ctx, function_index);
   auto function_type = GetFunctionType(ctx, MaybeDefault(function).type_index);
@@ -756,7 +799,7 @@ bool TableSet(ValidCtx& ctx, Location loc, At<Index> index) {
 }
 
 bool RefFunc(ValidCtx& ctx, Location loc, At<Index> index) {
-  if (ctx.declared_functions.find(index) == ctx.declared_functions.end()) {
+  if (!ctx.declared_functions.count(index)) {
     ctx.errors->OnError(loc, concat("Undeclared function reference ", index));
     return false;
   }
@@ -767,11 +810,13 @@ bool RefFunc(ValidCtx& ctx, Location loc, At<Index> index) {
 }
 
 bool CheckAlignment(ValidCtx& ctx,
-                    const At<Instruction>& instruction,
+                    Location loc,
+                    Opcode opcode,
+                    const At<MemArgImmediate>& immediate,
                     u32 max_align) {
-  if (instruction->mem_arg_immediate()->align_log2 > max_align) {
-    ctx.errors->OnError(instruction.loc(),
-                        concat("Invalid alignment ", instruction));
+  if (immediate->align_log2 > max_align) {
+    ctx.errors->OnError(
+        loc, concat("Invalid alignment ", Instruction{opcode, immediate}));
     return false;
   }
   return true;
@@ -791,12 +836,15 @@ StackTypeSpan GetIndexTypeSpan(const optional<MemoryType>& memory_type) {
   return span_i32;
 }
 
-bool Load(ValidCtx& ctx, Location loc, const At<Instruction>& instruction) {
+bool Load(ValidCtx& ctx,
+          Location loc,
+          Opcode opcode,
+          const At<MemArgImmediate>& immediate) {
   auto memory_type = GetMemoryType(ctx, 0);
   auto index_span = GetIndexTypeSpan(memory_type);
   StackTypeSpan span;
   u32 max_align;
-  switch (instruction->opcode) {
+  switch (opcode) {
     case Opcode::I32Load:    span = span_i32; max_align = 2; break;
     case Opcode::I64Load:    span = span_i64; max_align = 3; break;
     case Opcode::F32Load:    span = span_f32; max_align = 2; break;
@@ -828,16 +876,19 @@ bool Load(ValidCtx& ctx, Location loc, const At<Instruction>& instruction) {
       WASP_UNREACHABLE();
   }
 
-  bool valid = CheckAlignment(ctx, instruction, max_align);
+  bool valid = CheckAlignment(ctx, loc, opcode, immediate, max_align);
   return AllTrue(memory_type, valid,
                  PopAndPushTypes(ctx, loc, index_span, span));
 }
 
-bool Store(ValidCtx& ctx, Location loc, const At<Instruction>& instruction) {
+bool Store(ValidCtx& ctx,
+           Location loc,
+           Opcode opcode,
+           const At<MemArgImmediate>& immediate) {
   auto memory_type = GetMemoryType(ctx, 0);
   StackType type;
   u32 max_align;
-  switch (instruction->opcode) {
+  switch (opcode) {
     case Opcode::I32Store:   type = StackType::I32(); max_align = 2; break;
     case Opcode::I64Store:   type = StackType::I64(); max_align = 3; break;
     case Opcode::F32Store:   type = StackType::F32(); max_align = 2; break;
@@ -853,7 +904,7 @@ bool Store(ValidCtx& ctx, Location loc, const At<Instruction>& instruction) {
   }
 
   StackTypeList params{GetIndexType(memory_type), type};
-  bool valid = CheckAlignment(ctx, instruction, max_align);
+  bool valid = CheckAlignment(ctx, loc, opcode, immediate, max_align);
   return AllTrue(memory_type, valid, PopTypes(ctx, loc, params));
 }
 
@@ -1184,7 +1235,7 @@ bool BrOnExn(ValidCtx& ctx,
   auto* label = GetLabel(ctx, immediate->target);
   bool valid =
       IsMatch(ctx, ToStackTypeList(MaybeDefault(function_type).param_types),
-              MaybeDefault(label).br_types());
+              ctx.GetBrTypes(MaybeDefault(label)));
   valid &= PopAndPushTypes(ctx, loc, span_exnref, span_exnref);
   return AllTrue(event_type, function_type, label, valid);
 }
@@ -1195,8 +1246,8 @@ bool BrOnNull(ValidCtx& ctx, Location loc, const At<Index>& depth) {
   auto type = MaybeDefault(type_opt);
 
   const auto* label = GetLabel(ctx, depth);
-  auto label_ = MaybeDefault(label);
-  valid &= PopAndPushTypes(ctx, loc, label_.br_types(), label_.br_types());
+  auto br_types = ctx.GetBrTypes(MaybeDefault(label));
+  valid &= PopAndPushTypes(ctx, loc, br_types, br_types);
 
   if (IsNullableType(type)) {
     PushType(ctx, AsNonNullableType(type));
@@ -1495,7 +1546,7 @@ bool BrOnCast(ValidCtx& ctx, Location loc, const At<Index>& immediate) {
       StackType{ValueType{ReferenceType{RefType{rtt_opt->type, Null::Yes}}}}};
 
   auto* label = GetLabel(ctx, immediate);
-  auto label_types = MaybeDefault(label).br_types();
+  auto label_types = ctx.GetBrTypes(MaybeDefault(label));
   if (!IsMatch(ctx, sub_type, label_types)) {
     ctx.errors->OnError(
         loc, concat("Label type is ", label_types, ", got ", sub_type));
@@ -1742,96 +1793,698 @@ bool ArrayLen(ValidCtx& ctx, Location loc, const At<Index>& immediate) {
   return PopAndPushTypes(ctx, loc, params, span_i32);
 }
 
-}  // namespace
-
-bool Validate(ValidCtx& ctx,
-              const At<Locals>& value,
-              RequireDefaultable require_defaultable) {
-  ErrorsContextGuard guard{*ctx.errors, value.loc(), "locals"};
-  bool valid = true;
-  if (require_defaultable == RequireDefaultable::Yes) {
-    valid &= CheckDefaultable(ctx, value->type, "local type");
-  }
-  valid &= Validate(ctx, value->type);
+// Gets the signature of an instruction whose validation only pops `params`
+// and pushes `results`, whatever its immediates are. Returns false for all
+// other instructions.
+bool GetSimpleSignature(Opcode opcode,
+                        StackTypeSpan* params,
+                        StackTypeSpan* results) {
+  switch (opcode) {
+    case Opcode::I32Eqz:
+    case Opcode::I32Clz:
+    case Opcode::I32Ctz:
+    case Opcode::I32Popcnt:
+    case Opcode::I32Extend8S:
+    case Opcode::I32Extend16S:
+      *params = span_i32, *results = span_i32;
+      return true;
 
-  if (!ctx.locals.Append(value->count, value->type)) {
-    const Index max = std::numeric_limits<Index>::max();
-    ctx.errors->OnError(
-        value.loc(),
-        concat("Too many locals; max is ", max, ", got ",
-               static_cast<u64>(ctx.locals.GetCount()) + value->count));
-    valid = false;
-  }
-  return valid;
-}
+    case Opcode::I64Eqz:
+    case Opcode::I32WrapI64:
+      *params = span_i64, *results = span_i32;
+      return true;
 
-bool Validate(ValidCtx& ctx,
-              const At<LocalsList>& value,
-              RequireDefaultable require_defaultable) {
-  bool valid = true;
-  for (auto&& locals : *value) {
-    valid &= Validate(ctx, locals, require_defaultable);
-  }
-  return valid;
-}
+    case Opcode::I64Clz:
+    case Opcode::I64Ctz:
+    case Opcode::I64Popcnt:
+    case Opcode::I64Extend8S:
+    case Opcode::I64Extend16S:
+    case Opcode::I64Extend32S:
+      *params = span_i64, *results = span_i64;
+      return true;
 
-bool Validate(ValidCtx& ctx, const At<Instruction>& value) {
-  ErrorsContextGuard guard{*ctx.errors, value.loc(), "instruction"};
-  if (ctx.label_stack.empty()) {
-    ctx.errors->OnError(value.loc(),
-                        "Unexpected instruction after function end");
-    return false;
-  }
+    case Opcode::I32Eq:
+    case Opcode::I32Ne:
+    case Opcode::I32LtS:
+    case Opcode::I32LtU:
+    case Opcode::I32GtS:
+    case Opcode::I32GtU:
+    case Opcode::I32LeS:
+    case Opcode::I32LeU:
+    case Opcode::I32GeS:
+    case Opcode::I32GeU:
+    case Opcode::I32Add:
+    case Opcode::I32Sub:
+    case Opcode::I32Mul:
+    case Opcode::I32DivS:
+    case Opcode::I32DivU:
+    case Opcode::I32RemS:
+    case Opcode::I32RemU:
+    case Opcode::I32And:
+    case Opcode::I32Or:
+    case Opcode::I32Xor:
+    case Opcode::I32Shl:
+    case Opcode::I32ShrS:
+    case Opcode::I32ShrU:
+    case Opcode::I32Rotl:
+    case Opcode::I32Rotr:
+      *params = span_i32_i32, *results = span_i32;
+      return true;
 
-  Location loc = value.loc();
+    case Opcode::I64Eq:
+    case Opcode::I64Ne:
+    case Opcode::I64LtS:
+    case Opcode::I64LtU:
+    case Opcode::I64GtS:
+    case Opcode::I64GtU:
+    case Opcode::I64LeS:
+    case Opcode::I64LeU:
+    case Opcode::I64GeS:
+    case Opcode::I64GeU:
+      *params = span_i64_i64, *results = span_i32;
+      return true;
 
-  StackTypeSpan params, results;
-  switch (value->opcode) {
-    case Opcode::Unreachable:
-      SetUnreachable(ctx);
+    case Opcode::F32Eq:
+    case Opcode::F32Ne:
+    case Opcode::F32Lt:
+    case Opcode::F32Gt:
+    case Opcode::F32Le:
+    case Opcode::F32Ge:
+      *params = span_f32_f32, *results = span_i32;
       return true;
 
-    case Opcode::Nop:
+    case Opcode::F64Eq:
+    case Opcode::F64Ne:
+    case Opcode::F64Lt:
+    case Opcode::F64Gt:
+    case Opcode::F64Le:
+    case Opcode::F64Ge:
+      *params = span_f64_f64, *results = span_i32;
       return true;
 
-    case Opcode::Block:
-      return PushLabel(ctx, loc, LabelType::Block,
-                       value->block_type_immediate());
+    case Opcode::I64Add:
+    case Opcode::I64Sub:
+    case Opcode::I64Mul:
+    case Opcode::I64DivS:
+    case Opcode::I64DivU:
+    case Opcode::I64RemS:
+    case Opcode::I64RemU:
+    case Opcode::I64And:
+    case Opcode::I64Or:
+    case Opcode::I64Xor:
+    case Opcode::I64Shl:
+    case Opcode::I64ShrS:
+    case Opcode::I64ShrU:
+    case Opcode::I64Rotl:
+    case Opcode::I64Rotr:
+      *params = span_i64_i64, *results = span_i64;
+      return true;
 
-    case Opcode::Loop:
-      return PushLabel(ctx, loc, LabelType::Loop,
-                       value->block_type_immediate());
+    case Opcode::F32Abs:
+    case Opcode::F32Neg:
+    case Opcode::F32Ceil:
+    case Opcode::F32Floor:
+    case Opcode::F32Trunc:
+    case Opcode::F32Nearest:
+    case Opcode::F32Sqrt:
+      *params = span_f32, *results = span_f32;
+      return true;
 
-    case Opcode::If: {
-      bool valid = PopType(ctx, loc, StackType::I32());
-      valid &=
-          PushLabel(ctx, loc, LabelType::If, value->block_type_immediate());
-      return valid;
-    }
+    case Opcode::F32Add:
+    case Opcode::F32Sub:
+    case Opcode::F32Mul:
+    case Opcode::F32Div:
+    case Opcode::F32Min:
+    case Opcode::F32Max:
+    case Opcode::F32Copysign:
+      *params = span_f32_f32, *results = span_f32;
+      return true;
 
-    case Opcode::Else:
-      return Else(ctx, loc);
+    case Opcode::F64Abs:
+    case Opcode::F64Neg:
+    case Opcode::F64Ceil:
+    case Opcode::F64Floor:
+    case Opcode::F64Trunc:
+    case Opcode::F64Nearest:
+    case Opcode::F64Sqrt:
+      *params = span_f64, *results = span_f64;
+      return true;
 
-    case Opcode::End:
-      return End(ctx, loc);
+    case Opcode::F64Add:
+    case Opcode::F64Sub:
+    case Opcode::F64Mul:
+    case Opcode::F64Div:
+    case Opcode::F64Min:
+    case Opcode::F64Max:
+    case Opcode::F64Copysign:
+      *params = span_f64_f64, *results = span_f64;
+      return true;
 
-    case Opcode::Try:
-      return PushLabel(ctx, loc, LabelType::Try, value->block_type_immediate());
+    case Opcode::I32TruncF32S:
+    case Opcode::I32TruncF32U:
+    case Opcode::I32ReinterpretF32:
+    case Opcode::I32TruncSatF32S:
+    case Opcode::I32TruncSatF32U:
+      *params = span_f32, *results = span_i32;
+      return true;
 
-    case Opcode::Catch:
-      return Catch(ctx, loc);
+    case Opcode::I32TruncF64S:
+    case Opcode::I32TruncF64U:
+    case Opcode::I32TruncSatF64S:
+    case Opcode::I32TruncSatF64U:
+      *params = span_f64, *results = span_i32;
+      return true;
 
-    case Opcode::Throw:
-      return Throw(ctx, loc, value->index_immediate());
+    case Opcode::I64ExtendI32S:
+    case Opcode::I64ExtendI32U:
+      *params = span_i32, *results = span_i64;
+      return true;
 
-    case Opcode::Rethrow:
-      return Rethrow(ctx, loc);
+    case Opcode::I64TruncF32S:
+    case Opcode::I64TruncF32U:
+    case Opcode::I64TruncSatF32S:
+    case Opcode::I64TruncSatF32U:
+      *params = span_f32, *results = span_i64;
+      return true;
 
-    case Opcode::BrOnExn:
-      return BrOnExn(ctx, loc, value->br_on_exn_immediate());
+    case Opcode::I64TruncF64S:
+    case Opcode::I64TruncF64U:
+    case Opcode::I64ReinterpretF64:
+    case Opcode::I64TruncSatF64S:
+    case Opcode::I64TruncSatF64U:
+      *params = span_f64, *results = span_i64;
+      return true;
 
-    case Opcode::Br:
-      return Br(ctx, loc, value->index_immediate());
+    case Opcode::F32ConvertI32S:
+    case Opcode::F32ConvertI32U:
+    case Opcode::F32ReinterpretI32:
+      *params = span_i32, *results = span_f32;
+      return true;
+
+    case Opcode::F32ConvertI64S:
+    case Opcode::F32ConvertI64U:
+      *params = span_i64, *results = span_f32;
+      return true;
+
+    case Opcode::F32DemoteF64:
+      *params = span_f64, *results = span_f32;
+      return true;
+
+    case Opcode::F64ConvertI32S:
+    case Opcode::F64ConvertI32U:
+      *params = span_i32, *results = span_f64;
+      return true;
+
+    case Opcode::F64ConvertI64S:
+    case Opcode::F64ConvertI64U:
+    case Opcode::F64ReinterpretI64:
+      *params = span_i64, *results = span_f64;
+      return true;
+
+    case Opcode::F64PromoteF32:
+      *params = span_f32, *results = span_f64;
+      return true;
+
+    case Opcode::V128Not:
+    case Opcode::I8X16Neg:
+    case Opcode::I16X8Neg:
+    case Opcode::I32X4Neg:
+    case Opcode::I64X2Neg:
+    case Opcode::F32X4Abs:
+    case Opcode::F32X4Neg:
+    case Opcode::F32X4Sqrt:
+    case Opcode::F32X4Ceil:
+    case Opcode::F32X4Floor:
+    case Opcode::F32X4Trunc:
+    case Opcode::F32X4Nearest:
+    case Opcode::F64X2Abs:
+    case Opcode::F64X2Neg:
+    case Opcode::F64X2Sqrt:
+    case Opcode::F64X2Ceil:
+    case Opcode::F64X2Floor:
+    case Opcode::F64X2Trunc:
+    case Opcode::F64X2Nearest:
+    case Opcode::I32X4TruncSatF32X4S:
+    case Opcode::I32X4TruncSatF32X4U:
+    case Opcode::F32X4ConvertI32X4S:
+    case Opcode::F32X4ConvertI32X4U:
+    case Opcode::I16X8WidenLowI8X16S:
+    case Opcode::I16X8WidenHighI8X16S:
+    case Opcode::I16X8WidenLowI8X16U:
+    case Opcode::I16X8WidenHighI8X16U:
+    case Opcode::I32X4WidenLowI16X8S:
+    case Opcode::I32X4WidenHighI16X8S:
+    case Opcode::I32X4WidenLowI16X8U:
+    case Opcode::I32X4WidenHighI16X8U:
+    case Opcode::I8X16Abs:
+    case Opcode::I16X8Abs:
+    case Opcode::I32X4Abs:
+      *params = span_v128, *results = span_v128;
+      return true;
+
+    case Opcode::V128BitSelect:
+      *params = span_v128_v128_v128, *results = span_v128;
+      return true;
+
+    case Opcode::I8X16Eq:
+    case Opcode::I8X16Ne:
+    case Opcode::I8X16LtS:
+    case Opcode::I8X16LtU:
+    case Opcode::I8X16GtS:
+    case Opcode::I8X16GtU:
+    case Opcode::I8X16LeS:
+    case Opcode::I8X16LeU:
+    case Opcode::I8X16GeS:
+    case Opcode::I8X16GeU:
+    case Opcode::I16X8Eq:
+    case Opcode::I16X8Ne:
+    case Opcode::I16X8LtS:
+    case Opcode::I16X8LtU:
+    case Opcode::I16X8GtS:
+    case Opcode::I16X8GtU:
+    case Opcode::I16X8LeS:
+    case Opcode::I16X8LeU:
+    case Opcode::I16X8GeS:
+    case Opcode::I16X8GeU:
+    case Opcode::I32X4Eq:
+    case Opcode::I32X4Ne:
+    case Opcode::I32X4LtS:
+    case Opcode::I32X4LtU:
+    case Opcode::I32X4GtS:
+    case Opcode::I32X4GtU:
+    case Opcode::I32X4LeS:
+    case Opcode::I32X4LeU:
+    case Opcode::I32X4GeS:
+    case Opcode::I32X4GeU:
+    case Opcode::F32X4Eq:
+    case Opcode::F32X4Ne:
+    case Opcode::F32X4Lt:
+    case Opcode::F32X4Gt:
+    case Opcode::F32X4Le:
+    case Opcode::F32X4Ge:
+    case Opcode::F64X2Eq:
+    case Opcode::F64X2Ne:
+    case Opcode::F64X2Lt:
+    case Opcode::F64X2Gt:
+    case Opcode::F64X2Le:
+    case Opcode::F64X2Ge:
+    case Opcode::V128And:
+    case Opcode::V128Or:
+    case Opcode::V128Xor:
+    case Opcode::I8X16Add:
+    case Opcode::I8X16AddSatS:
+    case Opcode::I8X16AddSatU:
+    case Opcode::I8X16Sub:
+    case Opcode::I8X16SubSatS:
+    case Opcode::I8X16SubSatU:
+    case Opcode::I8X16MinS:
+    case Opcode::I8X16MinU:
+    case Opcode::I8X16MaxS:
+    case Opcode::I8X16MaxU:
+    case Opcode::I16X8Add:
+    case Opcode::I16X8AddSatS:
+    case Opcode::I16X8AddSatU:
+    case Opcode::I16X8Sub:
+    case Opcode::I16X8SubSatS:
+    case Opcode::I16X8SubSatU:
+    case Opcode::I16X8Mul:
+    case Opcode::I16X8MinS:
+    case Opcode::I16X8MinU:
+    case Opcode::I16X8MaxS:
+    case Opcode::I16X8MaxU:
+    case Opcode::I32X4Add:
+    case Opcode::I32X4Sub:
+    case Opcode::I32X4Mul:
+    case Opcode::I32X4MinS:
+    case Opcode::I32X4MinU:
+    case Opcode::I32X4MaxS:
+    case Opcode::I32X4MaxU:
+    case Opcode::I32X4DotI16X8S:
+    case Opcode::I64X2Add:
+    case Opcode::I64X2Sub:
+    case Opcode::I64X2Mul:
+    case Opcode::F32X4Add:
+    case Opcode::F32X4Sub:
+    case Opcode::F32X4Mul:
+    case Opcode::F32X4Div:
+    case Opcode::F32X4Min:
+    case Opcode::F32X4Max:
+    case Opcode::F32X4Pmin:
+    case Opcode::F32X4Pmax:
+    case Opcode::F64X2Add:
+    case Opcode::F64X2Sub:
+    case Opcode::F64X2Mul:
+    case Opcode::F64X2Div:
+    case Opcode::F64X2Min:
+    case Opcode::F64X2Max:
+    case Opcode::F64X2Pmin:
+    case Opcode::F64X2Pmax:
+    case Opcode::I8X16Swizzle:
+    case Opcode::I8X16NarrowI16X8S:
+    case Opcode::I8X16NarrowI16X8U:
+    case Opcode::I16X8NarrowI32X4S:
+    case Opcode::I16X8NarrowI32X4U:
+    case Opcode::V128Andnot:
+    case Opcode::I8X16AvgrU:
+    case Opcode::I16X8AvgrU:
+      *params = span_v128_v128, *results = span_v128;
+      return true;
+
+    case Opcode::I8X16Splat:
+    case Opcode::I16X8Splat:
+    case Opcode::I32X4Splat:
+      *params = span_i32, *results = span_v128;
+      return true;
+
+    case Opcode::I64X2Splat:
+      *params = span_i64, *results = span_v128;
+      return true;
+
+    case Opcode::F32X4Splat:
+      *params = span_f32, *results = span_v128;
+      return true;
+
+    case Opcode::F64X2Splat:
+      *params = span_f64, *results = span_v128;
+      return true;
+
+    case Opcode::I8X16AnyTrue:
+    case Opcode::I8X16AllTrue:
+    case Opcode::I8X16Bitmask:
+    case Opcode::I16X8AnyTrue:
+    case Opcode::I16X8AllTrue:
+    case Opcode::I16X8Bitmask:
+    case Opcode::I32X4AnyTrue:
+    case Opcode::I32X4AllTrue:
+    case Opcode::I32X4Bitmask:
+      *params = span_v128, *results = span_i32;
+      return true;
+
+    case Opcode::I8X16Shl:
+    case Opcode::I8X16ShrS:
+    case Opcode::I8X16ShrU:
+    case Opcode::I16X8Shl:
+    case Opcode::I16X8ShrS:
+    case Opcode::I16X8ShrU:
+    case Opcode::I32X4Shl:
+    case Opcode::I32X4ShrS:
+    case Opcode::I32X4ShrU:
+    case Opcode::I64X2Shl:
+    case Opcode::I64X2ShrS:
+    case Opcode::I64X2ShrU:
+      *params = span_v128_i32, *results = span_v128;
+      return true;
+
+    case Opcode::RefEq:
+      *params = span_eqref_eqref, *results = span_i32;
+      return true;
+
+    case Opcode::I31New:
+      *params = span_i32, *results = span_i31ref;
+      return true;
+
+    case Opcode::I31GetS:
+    case Opcode::I31GetU:
+      *params = span_i31ref, *results = span_i32;
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+// The numeric block types read by binary::FastReadInstruction.
+StackType GetNumericBlockType(u64 encoding) {
+  switch (encoding) {
+    case 0x7f: return StackType::I32();
+    case 0x7e: return StackType::I64();
+    case 0x7d: return StackType::F32();
+    case 0x7c: return StackType::F64();
+    default:
+      WASP_UNREACHABLE();
+  }
+}
+
+// Same as Validate(ctx, unpacked), for an instruction decoded by
+// binary::FastReadInstruction from the bytes at `loc`.
+bool ValidatePacked(ValidCtx& ctx,
+                    Location loc,
+                    const PackedInstruction& packed) {
+  ErrorsContextGuard guard{*ctx.errors, loc, "instruction"};
+  if (ctx.label_stack.empty()) {
+    ctx.errors->OnError(loc, "Unexpected instruction after function end");
+    return false;
+  }
+
+  auto opcode = static_cast<Opcode>(packed.opcode);
+  StackTypeSpan params, results;
+  if (GetSimpleSignature(opcode, &params, &results)) {
+    return PopAndPushTypes(ctx, loc, params, results);
+  }
+
+  // All of these instructions have a one byte opcode, followed by the
+  // immediate.
+  At<Index> index{loc.subspan(1), static_cast<Index>(packed.immediate)};
+
+  switch (packed.kind) {
+    case PackedInstruction::Kind::BlockTypeVoid:
+    case PackedInstruction::Kind::BlockTypeNumeric: {
+      LabelType label_type = opcode == Opcode::Block ? LabelType::Block
+                             : opcode == Opcode::Loop ? LabelType::Loop
+                                                      : LabelType::If;
+      bool valid = true;
+      if (label_type == LabelType::If) {
+        valid &= PopType(ctx, loc, StackType::I32());
+      }
+      Index types_begin = static_cast<Index>(ctx.label_types.size());
+      if (packed.kind == PackedInstruction::Kind::BlockTypeNumeric) {
+        ctx.label_types.push_back(GetNumericBlockType(packed.immediate));
+      }
+      return AllTrue(valid, PushLabel(ctx, loc, label_type, types_begin, 0));
+    }
+
+    case PackedInstruction::Kind::MemArg: {
+      // Packed as the alignment in the low 32 bits and the offset in the high
+      // 32 bits.
+      MemArgImmediate immediate{static_cast<u32>(packed.immediate),
+                                static_cast<u32>(packed.immediate >> 32)};
+      // The stores (0x36..0x3e) are all after the loads (0x28..0x35).
+      if (opcode >= Opcode::I32Store) {
+        return Store(ctx, loc, opcode, immediate);
+      }
+      return Load(ctx, loc, opcode, immediate);
+    }
+
+    default:
+      break;
+  }
+
+  switch (opcode) {
+    case Opcode::Unreachable:
+      SetUnreachable(ctx);
+      return true;
+
+    case Opcode::Nop:
+      return true;
+
+    case Opcode::Else:
+      return Else(ctx, loc);
+
+    case Opcode::End:
+      return End(ctx, loc);
+
+    case Opcode::Br:
+      return Br(ctx, loc, index);
+
+    case Opcode::BrIf:
+      return BrIf(ctx, loc, index);
+
+    case Opcode::Return:
+      return Br(ctx, loc, static_cast<Index>(ctx.label_stack.size() - 1));
+
+    case Opcode::Call:
+      return Call(ctx, loc, index);
+
+    case Opcode::Drop:
+      return DropTypes(ctx, loc, 1);
+
+    case Opcode::Select:
+      return Select(ctx, loc);
+
+    case Opcode::LocalGet:
+      return LocalGet(ctx, index);
+
+    case Opcode::LocalSet:
+      return LocalSet(ctx, loc, index);
+
+    case Opcode::LocalTee:
+      return LocalTee(ctx, loc, index);
+
+    case Opcode::GlobalGet:
+      return GlobalGet(ctx, index);
+
+    case Opcode::GlobalSet:
+      return GlobalSet(ctx, loc, index);
+
+    case Opcode::I32Const:
+      PushType(ctx, StackType::I32());
+      return true;
+
+    case Opcode::I64Const:
+      PushType(ctx, StackType::I64());
+      return true;
+
+    case Opcode::F32Const:
+      PushType(ctx, StackType::F32());
+      return true;
+
+    case Opcode::F64Const:
+      PushType(ctx, StackType::F64());
+      return true;
+
+    default:
+      // binary::FastReadInstruction doesn't read any other instruction.
+      WASP_UNREACHABLE();
+  }
+}
+
+// Validates a br_table at the front of `data` without building its
+// BrTableImmediate, and removes it from `data`. Returns nullopt, without
+// consuming anything, if the instruction needs the full reader.
+optional<bool> ReadAndValidateBrTable(ValidCtx& ctx,
+                                      ReadCtx& read_ctx,
+                                      SpanU8* data) {
+  if (read_ctx.seen_final_end || data->empty() || (*data)[0] != 0x0e) {
+    return nullopt;
+  }
+
+  // Check that the whole instruction can be decoded before validating any of
+  // it, so the full reader can take over if it can't.
+  SpanU8 rest = data->subspan(1);
+  auto count = ReadVarIntFast<Index>(&rest);
+  if (!count) {
+    return nullopt;
+  }
+  SpanU8 targets = rest;
+  for (Index i = 0; i < *count; ++i) {
+    if (!ReadVarIntFast<Index>(&rest)) {
+      return nullopt;
+    }
+  }
+  auto default_target = ReadVarIntFast<Index>(&rest);
+  if (!default_target) {
+    return nullopt;
+  }
+
+  Location loc = MakeSpan(data->data(), rest.data());
+  *data = rest;
+
+  ErrorsContextGuard guard{*ctx.errors, loc, "instruction"};
+  if (ctx.label_stack.empty()) {
+    ctx.errors->OnError(loc, "Unexpected instruction after function end");
+    return false;
+  }
+  return BrTable(ctx, loc, *default_target, [&](auto&& check) {
+    for (Index i = 0; i < *count; ++i) {
+      check(*ReadVarIntFast<Index>(&targets));
+    }
+  });
+}
+
+}  // namespace
+
+bool Validate(ValidCtx& ctx,
+              const At<Locals>& value,
+              RequireDefaultable require_defaultable) {
+  ErrorsContextGuard guard{*ctx.errors, value.loc(), "locals"};
+  bool valid = true;
+  if (require_defaultable == RequireDefaultable::Yes) {
+    valid &= CheckDefaultable(ctx, value->type, "local type");
+  }
+  valid &= Validate(ctx, value->type);
+
+  if (!ctx.locals.Append(value->count, value->type)) {
+    const Index max = std::numeric_limits<Index>::max();
+    ctx.errors->OnError(
+        value.loc(),
+        concat("Too many locals; max is ", max, ", got ",
+               static_cast<u64>(ctx.locals.GetCount()) + value->count));
+    valid = false;
+  }
+  return valid;
+}
+
+bool Validate(ValidCtx& ctx,
+              const At<LocalsList>& value,
+              RequireDefaultable require_defaultable) {
+  bool valid = true;
+  for (auto&& locals : *value) {
+    valid &= Validate(ctx, locals, require_defaultable);
+  }
+  return valid;
+}
+
+bool Validate(ValidCtx& ctx, const At<Instruction>& value) {
+  ErrorsContextGuard guard{*ctx.errors, value.loc(), "instruction"};
+  if (ctx.label_stack.empty()) {
+    ctx.errors->OnError(value.loc(),
+                        "Unexpected instruction after function end");
+    return false;
+  }
+
+  Location loc = value.loc();
+
+  StackTypeSpan params, results;
+  if (GetSimpleSignature(value->opcode, &params, &results)) {
+    return PopAndPushTypes(ctx, loc, params, results);
+  }
+
+  switch (value->opcode) {
+    case Opcode::Unreachable:
+      SetUnreachable(ctx);
+      return true;
+
+    case Opcode::Nop:
+      return true;
+
+    case Opcode::Block:
+      return PushLabel(ctx, loc, LabelType::Block,
+                       value->block_type_immediate());
+
+    case Opcode::Loop:
+      return PushLabel(ctx, loc, LabelType::Loop,
+                       value->block_type_immediate());
+
+    case Opcode::If: {
+      bool valid = PopType(ctx, loc, StackType::I32());
+      valid &=
+          PushLabel(ctx, loc, LabelType::If, value->block_type_immediate());
+      return valid;
+    }
+
+    case Opcode::Else:
+      return Else(ctx, loc);
+
+    case Opcode::End:
+      return End(ctx, loc);
+
+    case Opcode::Try:
+      return PushLabel(ctx, loc, LabelType::Try, value->block_type_immediate());
+
+    case Opcode::Catch:
+      return Catch(ctx, loc);
+
+    case Opcode::Throw:
+      return Throw(ctx, loc, value->index_immediate());
+
+    case Opcode::Rethrow:
+      return Rethrow(ctx, loc);
+
+    case Opcode::BrOnExn:
+      return BrOnExn(ctx, loc, value->br_on_exn_immediate());
+
+    case Opcode::Br:
+      return Br(ctx, loc, value->index_immediate());
 
     case Opcode::BrIf:
       return BrIf(ctx, loc, value->index_immediate());
@@ -1934,248 +2587,43 @@ bool Validate(ValidCtx& ctx, const At<Instruction>& value) {
     case Opcode::V128Load16X4U:
     case Opcode::V128Load32X2S:
     case Opcode::V128Load32X2U:
-    case Opcode::V128Load32Zero:
-    case Opcode::V128Load64Zero:
-      return Load(ctx, loc, value);
-
-    case Opcode::I32Store:
-    case Opcode::I64Store:
-    case Opcode::F32Store:
-    case Opcode::F64Store:
-    case Opcode::I32Store8:
-    case Opcode::I32Store16:
-    case Opcode::I64Store8:
-    case Opcode::I64Store16:
-    case Opcode::I64Store32:
-    case Opcode::V128Store:
-      return Store(ctx, loc, value);
-
-    case Opcode::MemorySize:
-      return MemorySize(ctx);
-
-    case Opcode::MemoryGrow:
-      return MemoryGrow(ctx, loc);
-
-    case Opcode::I32Const:
-      PushType(ctx, StackType::I32());
-      return true;
-
-    case Opcode::I64Const:
-      PushType(ctx, StackType::I64());
-      return true;
-
-    case Opcode::F32Const:
-      PushType(ctx, StackType::F32());
-      return true;
-
-    case Opcode::F64Const:
-      PushType(ctx, StackType::F64());
-      return true;
-
-    case Opcode::I32Eqz:
-    case Opcode::I32Clz:
-    case Opcode::I32Ctz:
-    case Opcode::I32Popcnt:
-    case Opcode::I32Extend8S:
-    case Opcode::I32Extend16S:
-      params = span_i32, results = span_i32;
-      break;
-
-    case Opcode::I64Eqz:
-    case Opcode::I32WrapI64:
-      params = span_i64, results = span_i32;
-      break;
-
-    case Opcode::I64Clz:
-    case Opcode::I64Ctz:
-    case Opcode::I64Popcnt:
-    case Opcode::I64Extend8S:
-    case Opcode::I64Extend16S:
-    case Opcode::I64Extend32S:
-      params = span_i64, results = span_i64;
-      break;
-
-    case Opcode::I32Eq:
-    case Opcode::I32Ne:
-    case Opcode::I32LtS:
-    case Opcode::I32LtU:
-    case Opcode::I32GtS:
-    case Opcode::I32GtU:
-    case Opcode::I32LeS:
-    case Opcode::I32LeU:
-    case Opcode::I32GeS:
-    case Opcode::I32GeU:
-    case Opcode::I32Add:
-    case Opcode::I32Sub:
-    case Opcode::I32Mul:
-    case Opcode::I32DivS:
-    case Opcode::I32DivU:
-    case Opcode::I32RemS:
-    case Opcode::I32RemU:
-    case Opcode::I32And:
-    case Opcode::I32Or:
-    case Opcode::I32Xor:
-    case Opcode::I32Shl:
-    case Opcode::I32ShrS:
-    case Opcode::I32ShrU:
-    case Opcode::I32Rotl:
-    case Opcode::I32Rotr:
-      params = span_i32_i32, results = span_i32;
-      break;
-
-    case Opcode::I64Eq:
-    case Opcode::I64Ne:
-    case Opcode::I64LtS:
-    case Opcode::I64LtU:
-    case Opcode::I64GtS:
-    case Opcode::I64GtU:
-    case Opcode::I64LeS:
-    case Opcode::I64LeU:
-    case Opcode::I64GeS:
-    case Opcode::I64GeU:
-      params = span_i64_i64, results = span_i32;
-      break;
-
-    case Opcode::F32Eq:
-    case Opcode::F32Ne:
-    case Opcode::F32Lt:
-    case Opcode::F32Gt:
-    case Opcode::F32Le:
-    case Opcode::F32Ge:
-      params = span_f32_f32, results = span_i32;
-      break;
-
-    case Opcode::F64Eq:
-    case Opcode::F64Ne:
-    case Opcode::F64Lt:
-    case Opcode::F64Gt:
-    case Opcode::F64Le:
-    case Opcode::F64Ge:
-      params = span_f64_f64, results = span_i32;
-      break;
-
-    case Opcode::I64Add:
-    case Opcode::I64Sub:
-    case Opcode::I64Mul:
-    case Opcode::I64DivS:
-    case Opcode::I64DivU:
-    case Opcode::I64RemS:
-    case Opcode::I64RemU:
-    case Opcode::I64And:
-    case Opcode::I64Or:
-    case Opcode::I64Xor:
-    case Opcode::I64Shl:
-    case Opcode::I64ShrS:
-    case Opcode::I64ShrU:
-    case Opcode::I64Rotl:
-    case Opcode::I64Rotr:
-      params = span_i64_i64, results = span_i64;
-      break;
-
-    case Opcode::F32Abs:
-    case Opcode::F32Neg:
-    case Opcode::F32Ceil:
-    case Opcode::F32Floor:
-    case Opcode::F32Trunc:
-    case Opcode::F32Nearest:
-    case Opcode::F32Sqrt:
-      params = span_f32, results = span_f32;
-      break;
-
-    case Opcode::F32Add:
-    case Opcode::F32Sub:
-    case Opcode::F32Mul:
-    case Opcode::F32Div:
-    case Opcode::F32Min:
-    case Opcode::F32Max:
-    case Opcode::F32Copysign:
-      params = span_f32_f32, results = span_f32;
-      break;
-
-    case Opcode::F64Abs:
-    case Opcode::F64Neg:
-    case Opcode::F64Ceil:
-    case Opcode::F64Floor:
-    case Opcode::F64Trunc:
-    case Opcode::F64Nearest:
-    case Opcode::F64Sqrt:
-      params = span_f64, results = span_f64;
-      break;
-
-    case Opcode::F64Add:
-    case Opcode::F64Sub:
-    case Opcode::F64Mul:
-    case Opcode::F64Div:
-    case Opcode::F64Min:
-    case Opcode::F64Max:
-    case Opcode::F64Copysign:
-      params = span_f64_f64, results = span_f64;
-      break;
-
-    case Opcode::I32TruncF32S:
-    case Opcode::I32TruncF32U:
-    case Opcode::I32ReinterpretF32:
-    case Opcode::I32TruncSatF32S:
-    case Opcode::I32TruncSatF32U:
-      params = span_f32, results = span_i32;
-      break;
-
-    case Opcode::I32TruncF64S:
-    case Opcode::I32TruncF64U:
-    case Opcode::I32TruncSatF64S:
-    case Opcode::I32TruncSatF64U:
-      params = span_f64, results = span_i32;
-      break;
-
-    case Opcode::I64ExtendI32S:
-    case Opcode::I64ExtendI32U:
-      params = span_i32, results = span_i64;
-      break;
-
-    case Opcode::I64TruncF32S:
-    case Opcode::I64TruncF32U:
-    case Opcode::I64TruncSatF32S:
-    case Opcode::I64TruncSatF32U:
-      params = span_f32, results = span_i64;
-      break;
+    case Opcode::V128Load32Zero:
+    case Opcode::V128Load64Zero:
+      return Load(ctx, loc, value->opcode, value->mem_arg_immediate());
 
-    case Opcode::I64TruncF64S:
-    case Opcode::I64TruncF64U:
-    case Opcode::I64ReinterpretF64:
-    case Opcode::I64TruncSatF64S:
-    case Opcode::I64TruncSatF64U:
-      params = span_f64, results = span_i64;
-      break;
+    case Opcode::I32Store:
+    case Opcode::I64Store:
+    case Opcode::F32Store:
+    case Opcode::F64Store:
+    case Opcode::I32Store8:
+    case Opcode::I32Store16:
+    case Opcode::I64Store8:
+    case Opcode::I64Store16:
+    case Opcode::I64Store32:
+    case Opcode::V128Store:
+      return Store(ctx, loc, value->opcode, value->mem_arg_immediate());
 
-    case Opcode::F32ConvertI32S:
-    case Opcode::F32ConvertI32U:
-    case Opcode::F32ReinterpretI32:
-      params = span_i32, results = span_f32;
-      break;
+    case Opcode::MemorySize:
+      return MemorySize(ctx);
 
-    case Opcode::F32ConvertI64S:
-    case Opcode::F32ConvertI64U:
-      params = span_i64, results = span_f32;
-      break;
+    case Opcode::MemoryGrow:
+      return MemoryGrow(ctx, loc);
 
-    case Opcode::F32DemoteF64:
-      params = span_f64, results = span_f32;
-      break;
+    case Opcode::I32Const:
+      PushType(ctx, StackType::I32());
+      return true;
 
-    case Opcode::F64ConvertI32S:
-    case Opcode::F64ConvertI32U:
-      params = span_i32, results = span_f64;
-      break;
+    case Opcode::I64Const:
+      PushType(ctx, StackType::I64());
+      return true;
 
-    case Opcode::F64ConvertI64S:
-    case Opcode::F64ConvertI64U:
-    case Opcode::F64ReinterpretI64:
-      params = span_i64, results = span_f64;
-      break;
+    case Opcode::F32Const:
+      PushType(ctx, StackType::F32());
+      return true;
 
-    case Opcode::F64PromoteF32:
-      params = span_f32, results = span_f64;
-      break;
+    case Opcode::F64Const:
+      PushType(ctx, StackType::F64());
+      return true;
 
     case Opcode::ReturnCall:
       return ReturnCall(ctx, loc, value->index_immediate());
@@ -2217,172 +2665,9 @@ bool Validate(ValidCtx& ctx, const At<Instruction>& value) {
       PushType(ctx, StackType::V128());
       return true;
 
-    case Opcode::V128Not:
-    case Opcode::I8X16Neg:
-    case Opcode::I16X8Neg:
-    case Opcode::I32X4Neg:
-    case Opcode::I64X2Neg:
-    case Opcode::F32X4Abs:
-    case Opcode::F32X4Neg:
-    case Opcode::F32X4Sqrt:
-    case Opcode::F32X4Ceil:
-    case Opcode::F32X4Floor:
-    case Opcode::F32X4Trunc:
-    case Opcode::F32X4Nearest:
-    case Opcode::F64X2Abs:
-    case Opcode::F64X2Neg:
-    case Opcode::F64X2Sqrt:
-    case Opcode::F64X2Ceil:
-    case Opcode::F64X2Floor:
-    case Opcode::F64X2Trunc:
-    case Opcode::F64X2Nearest:
-    case Opcode::I32X4TruncSatF32X4S:
-    case Opcode::I32X4TruncSatF32X4U:
-    case Opcode::F32X4ConvertI32X4S:
-    case Opcode::F32X4ConvertI32X4U:
-    case Opcode::I16X8WidenLowI8X16S:
-    case Opcode::I16X8WidenHighI8X16S:
-    case Opcode::I16X8WidenLowI8X16U:
-    case Opcode::I16X8WidenHighI8X16U:
-    case Opcode::I32X4WidenLowI16X8S:
-    case Opcode::I32X4WidenHighI16X8S:
-    case Opcode::I32X4WidenLowI16X8U:
-    case Opcode::I32X4WidenHighI16X8U:
-    case Opcode::I8X16Abs:
-    case Opcode::I16X8Abs:
-    case Opcode::I32X4Abs:
-      params = span_v128, results = span_v128;
-      break;
-
-    case Opcode::V128BitSelect:
-      params = span_v128_v128_v128, results = span_v128;
-      break;
-
-    case Opcode::I8X16Eq:
-    case Opcode::I8X16Ne:
-    case Opcode::I8X16LtS:
-    case Opcode::I8X16LtU:
-    case Opcode::I8X16GtS:
-    case Opcode::I8X16GtU:
-    case Opcode::I8X16LeS:
-    case Opcode::I8X16LeU:
-    case Opcode::I8X16GeS:
-    case Opcode::I8X16GeU:
-    case Opcode::I16X8Eq:
-    case Opcode::I16X8Ne:
-    case Opcode::I16X8LtS:
-    case Opcode::I16X8LtU:
-    case Opcode::I16X8GtS:
-    case Opcode::I16X8GtU:
-    case Opcode::I16X8LeS:
-    case Opcode::I16X8LeU:
-    case Opcode::I16X8GeS:
-    case Opcode::I16X8GeU:
-    case Opcode::I32X4Eq:
-    case Opcode::I32X4Ne:
-    case Opcode::I32X4LtS:
-    case Opcode::I32X4LtU:
-    case Opcode::I32X4GtS:
-    case Opcode::I32X4GtU:
-    case Opcode::I32X4LeS:
-    case Opcode::I32X4LeU:
-    case Opcode::I32X4GeS:
-    case Opcode::I32X4GeU:
-    case Opcode::F32X4Eq:
-    case Opcode::F32X4Ne:
-    case Opcode::F32X4Lt:
-    case Opcode::F32X4Gt:
-    case Opcode::F32X4Le:
-    case Opcode::F32X4Ge:
-    case Opcode::F64X2Eq:
-    case Opcode::F64X2Ne:
-    case Opcode::F64X2Lt:
-    case Opcode::F64X2Gt:
-    case Opcode::F64X2Le:
-    case Opcode::F64X2Ge:
-    case Opcode::V128And:
-    case Opcode::V128Or:
-    case Opcode::V128Xor:
-    case Opcode::I8X16Add:
-    case Opcode::I8X16AddSatS:
-    case Opcode::I8X16AddSatU:
-    case Opcode::I8X16Sub:
-    case Opcode::I8X16SubSatS:
-    case Opcode::I8X16SubSatU:
-    case Opcode::I8X16MinS:
-    case Opcode::I8X16MinU:
-    case Opcode::I8X16MaxS:
-    case Opcode::I8X16MaxU:
-    case Opcode::I16X8Add:
-    case Opcode::I16X8AddSatS:
-    case Opcode::I16X8AddSatU:
-    case Opcode::I16X8Sub:
-    case Opcode::I16X8SubSatS:
-    case Opcode::I16X8SubSatU:
-    case Opcode::I16X8Mul:
-    case Opcode::I16X8MinS:
-    case Opcode::I16X8MinU:
-    case Opcode::I16X8MaxS:
-    case Opcode::I16X8MaxU:
-    case Opcode::I32X4Add:
-    case Opcode::I32X4Sub:
-    case Opcode::I32X4Mul:
-    case Opcode::I32X4MinS:
-    case Opcode::I32X4MinU:
-    case Opcode::I32X4MaxS:
-    case Opcode::I32X4MaxU:
-    case Opcode::I32X4DotI16X8S:
-    case Opcode::I64X2Add:
-    case Opcode::I64X2Sub:
-    case Opcode::I64X2Mul:
-    case Opcode::F32X4Add:
-    case Opcode::F32X4Sub:
-    case Opcode::F32X4Mul:
-    case Opcode::F32X4Div:
-    case Opcode::F32X4Min:
-    case Opcode::F32X4Max:
-    case Opcode::F32X4Pmin:
-    case Opcode::F32X4Pmax:
-    case Opcode::F64X2Add:
-    case Opcode::F64X2Sub:
-    case Opcode::F64X2Mul:
-    case Opcode::F64X2Div:
-    case Opcode::F64X2Min:
-    case Opcode::F64X2Max:
-    case Opcode::F64X2Pmin:
-    case Opcode::F64X2Pmax:
-    case Opcode::I8X16Swizzle:
-    case Opcode::I8X16NarrowI16X8S:
-    case Opcode::I8X16NarrowI16X8U:
-    case Opcode::I16X8NarrowI32X4S:
-    case Opcode::I16X8NarrowI32X4U:
-    case Opcode::V128Andnot:
-    case Opcode::I8X16AvgrU:
-    case Opcode::I16X8AvgrU:
-      params = span_v128_v128, results = span_v128;
-      break;
-
     case Opcode::I8X16Shuffle:
       return SimdShuffle(ctx, loc, value->shuffle_immediate());
 
-    case Opcode::I8X16Splat:
-    case Opcode::I16X8Splat:
-    case Opcode::I32X4Splat:
-      params = span_i32, results = span_v128;
-      break;
-
-    case Opcode::I64X2Splat:
-      params = span_i64, results = span_v128;
-      break;
-
-    case Opcode::F32X4Splat:
-      params = span_f32, results = span_v128;
-      break;
-
-    case Opcode::F64X2Splat:
-      params = span_f64, results = span_v128;
-      break;
-
     case Opcode::I8X16ExtractLaneS:
     case Opcode::I8X16ExtractLaneU:
     case Opcode::I16X8ExtractLaneS:
@@ -2399,33 +2684,6 @@ bool Validate(ValidCtx& ctx, const At<Instruction>& value) {
     case Opcode::F64X2ReplaceLane:
       return SimdLane(ctx, loc, value);
 
-    case Opcode::I8X16AnyTrue:
-    case Opcode::I8X16AllTrue:
-    case Opcode::I8X16Bitmask:
-    case Opcode::I16X8AnyTrue:
-    case Opcode::I16X8AllTrue:
-    case Opcode::I16X8Bitmask:
-    case Opcode::I32X4AnyTrue:
-    case Opcode::I32X4AllTrue:
-    case Opcode::I32X4Bitmask:
-      params = span_v128, results = span_i32;
-      break;
-
-    case Opcode::I8X16Shl:
-    case Opcode::I8X16ShrS:
-    case Opcode::I8X16ShrU:
-    case Opcode::I16X8Shl:
-    case Opcode::I16X8ShrS:
-    case Opcode::I16X8ShrU:
-    case Opcode::I32X4Shl:
-    case Opcode::I32X4ShrS:
-    case Opcode::I32X4ShrU:
-    case Opcode::I64X2Shl:
-    case Opcode::I64X2ShrS:
-    case Opcode::I64X2ShrU:
-      params = span_v128_i32, results = span_v128;
-      break;
-
     case Opcode::MemoryAtomicNotify:
       return MemoryAtomicNotify(ctx, loc, value);
 
@@ -2502,19 +2760,6 @@ bool Validate(ValidCtx& ctx, const At<Instruction>& value) {
     case Opcode::I64AtomicRmw32CmpxchgU:
       return AtomicRmw(ctx, loc, value);
 
-    case Opcode::RefEq:
-      params = span_eqref_eqref, results = span_i32;
-      break;
-
-    case Opcode::I31New:
-      params = span_i32, results = span_i31ref;
-      break;
-
-    case Opcode::I31GetS:
-    case Opcode::I31GetU:
-      params = span_i31ref, results = span_i32;
-      break;
-
     case Opcode::RttCanon:
       return RttCanon(ctx, loc, value->heap_type_immediate());
 
@@ -2564,9 +2809,46 @@ bool Validate(ValidCtx& ctx, const At<Instruction>& value) {
 
     case Opcode::ArrayLen:
       return ArrayLen(ctx, loc, value->index_immediate());
+
+    default:
+      // Handled by GetSimpleSignature above.
+      WASP_UNREACHABLE();
   }
+}
 
-  return PopAndPushTypes(ctx, loc, params, results);
+auto ReadAndValidateExpression(ValidCtx& ctx,
+                                ReadCtx& read_ctx,
+                                SpanU8 expr) -> ExpressionResult {
+  read_ctx.seen_final_end = false;
+  SpanU8 data = expr;
+  bool read_ok = true;
+  while (!data.empty()) {
+    const u8* begin = data.data();
+    PackedInstruction packed;
+    if (FastReadInstruction(&data, read_ctx, &packed)) {
+      if (!ValidatePacked(ctx, MakeSpan(begin, data.data()), packed)) {
+        return ExpressionResult::Invalid;
+      }
+    } else if (auto valid = ReadAndValidateBrTable(ctx, read_ctx, &data)) {
+      if (!*valid) {
+        return ExpressionResult::Invalid;
+      }
+    } else {
+      auto instr = Read<Instruction>(&data, read_ctx);
+      if (!instr) {
+        read_ok = false;
+        break;
+      }
+      if (!Validate(ctx, *instr)) {
+        return ExpressionResult::Invalid;
+      }
+    }
+  }
+  // Called even after a read error, since it may report more errors (e.g. a
+  // missing final end).
+  bool end_ok = EndCode(expr.last(0), read_ctx);
+  return read_ok && end_ok ? ExpressionResult::Valid
+                           : ExpressionResult::ReadError;
 }
 
 }  // namespace wasp::valid
@@ -16,12 +16,44 @@
 
 #include "wasp/valid/validate_visitor.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <memory>
+#include <thread>
+
+#include "wasp/base/buffered_errors.h"
+#include "wasp/binary/lazy_expression.h"
+#include "wasp/binary/read.h"
+#include "wasp/binary/read/read_ctx.h"
 
 namespace wasp::valid {
 
-ValidateVisitor::ValidateVisitor(Features features, Errors& errors)
-    : ctx{features, errors}, features{features}, errors{errors} {}
+ValidateVisitor::ValidateVisitor(Features features,
+                                 Errors& errors,
+                                 Index thread_count,
+                                 ValidationSnapshot* snapshot)
+    : ctx{features, errors},
+      features{features},
+      errors{errors},
+      thread_count{thread_count},
+      snapshot{snapshot} {}
+
+auto ValidateVisitor::BeginModule(const binary::LazyModule&) -> Result {
+  if (snapshot) {
+    snapshot_builder.emplace(features, *snapshot);
+  }
+  return Result::Ok;
+}
+
+template <typename T>
+auto ValidateVisitor::ValidateContextItem(binary::SectionId id,
+                                          const At<T>& item) -> Result {
+  if (snapshot_builder) {
+    snapshot_builder->OnContextItem(id, item.loc());
+  }
+  return FailUnless(Validate(ctx, item));
+}
 
 auto ValidateVisitor::BeginTypeSection(binary::LazyTypeSection sec) -> Result {
   return FailUnless(valid::BeginTypeSection(ctx, sec.count.value_or(0)));
@@ -29,7 +61,7 @@ auto ValidateVisitor::BeginTypeSection(binary::LazyTypeSection sec) -> Result {
 
 auto ValidateVisitor::OnType(const At<binary::DefinedType>& defined_type)
     -> Result {
-  return FailUnless(Validate(ctx, defined_type));
+  return ValidateContextItem(binary::SectionId::Type, defined_type);
 }
 
 auto ValidateVisitor::EndTypeSection(binary::LazyTypeSection sec) -> Result {
@@ -37,51 +69,103 @@ auto ValidateVisitor::EndTypeSection(binary::LazyTypeSection sec) -> Result {
 }
 
 auto ValidateVisitor::OnImport(const At<binary::Import>& import) -> Result {
-  return FailUnless(Validate(ctx, import));
+  return ValidateContextItem(binary::SectionId::Import, import);
 }
 
 auto ValidateVisitor::OnFunction(const At<binary::Function>& function)
     -> Result {
-  return FailUnless(Validate(ctx, function));
+  return ValidateContextItem(binary::SectionId::Function, function);
 }
 
 auto ValidateVisitor::OnTable(const At<binary::Table>& table) -> Result {
-  return FailUnless(Validate(ctx, table));
+  return ValidateContextItem(binary::SectionId::Table, table);
 }
 
 auto ValidateVisitor::OnMemory(const At<binary::Memory>& memory) -> Result {
-  return FailUnless(Validate(ctx, memory));
+  return ValidateContextItem(binary::SectionId::Memory, memory);
 }
 
 auto ValidateVisitor::OnGlobal(const At<binary::Global>& global) -> Result {
-  return FailUnless(Validate(ctx, global));
+  return ValidateContextItem(binary::SectionId::Global, global);
 }
 
 auto ValidateVisitor::OnEvent(const At<binary::Event>& event) -> Result {
-  return FailUnless(Validate(ctx, event));
+  return ValidateContextItem(binary::SectionId::Event, event);
+}
+
+auto ValidateVisitor::BeginExportSection(binary::LazyExportSection sec)
+    -> Result {
+  ctx.export_names.reserve(sec.count.value_or(0));
+  return Result::Ok;
 }
 
 auto ValidateVisitor::OnExport(const At<binary::Export>& export_) -> Result {
-  return FailUnless(Validate(ctx, export_));
+  return ValidateContextItem(binary::SectionId::Export, export_);
 }
 
 auto ValidateVisitor::OnStart(const At<binary::Start>& start) -> Result {
-  return FailUnless(Validate(ctx, start));
+  return ValidateContextItem(binary::SectionId::Start, start);
 }
 
 auto ValidateVisitor::OnElement(const At<binary::ElementSegment>& segment)
     -> Result {
-  return FailUnless(Validate(ctx, segment));
+  return ValidateContextItem(binary::SectionId::Element, segment);
 }
 
 auto ValidateVisitor::OnDataCount(const At<binary::DataCount>& data_count)
     -> Result {
-  return FailUnless(Validate(ctx, data_count));
+  return ValidateContextItem(binary::SectionId::DataCount, data_count);
+}
+
+auto ValidateVisitor::BeginCodeSection(binary::LazyCodeSection sec)
+    -> Result {
+  codes.clear();
+  skip_codes.clear();
+  if (thread_count > 1) {
+    codes.reserve(sec.count.value_or(0));
+    skip_codes.reserve(sec.count.value_or(0));
+  }
+  if (snapshot_builder) {
+    // Visiting stops at the first invalid item, so the context is valid.
+    snapshot_builder->EndContext(true);
+  }
+  return Result::Ok;
 }
 
 auto ValidateVisitor::BeginCode(const At<binary::Code>& code) -> Result {
-  return FailUnless(valid::BeginCode(ctx, code.loc()) &&
-                    Validate(ctx, code->locals, RequireDefaultable::Yes));
+  Index code_index = ctx.code_count + static_cast<Index>(codes.size());
+  bool skip = snapshot_builder &&
+              snapshot_builder->BeginCode(code_index, code.loc());
+  if (thread_count > 1) {
+    // Validated in EndCodeSection.
+    codes.push_back(code);
+    skip_codes.push_back(skip);
+    return Result::Skip;
+  }
+  if (skip) {
+    ctx.code_count++;
+    return Result::Skip;
+  }
+  if (!(valid::BeginCode(ctx, code.loc()) &&
+        Validate(ctx, code->locals, RequireDefaultable::Yes))) {
+    return Result::Fail;
+  }
+  if (fused) {
+    // The body is validated here instead of by OnInstruction, so it is
+    // skipped by the caller.
+    binary::ReadCtx read_ctx{features, errors};
+    read_ctx.declared_data_count = ctx.declared_data_count;
+    // Like binary::visit::Visit, a read error ends this body but not the
+    // visit. EndCode records the body as invalid, since an error was
+    // reported.
+    if (ReadAndValidateExpression(ctx, read_ctx, code->body->data) ==
+        ExpressionResult::Invalid) {
+      return Result::Fail;
+    }
+    EndCode(code);
+    return Result::Skip;
+  }
+  return Result::Ok;
 }
 
 auto ValidateVisitor::OnInstruction(const At<binary::Instruction>& instruction)
@@ -89,6 +173,23 @@ auto ValidateVisitor::OnInstruction(const At<binary::Instruction>& instruction)
   return FailUnless(Validate(ctx, instruction));
 }
 
+auto ValidateVisitor::EndCode(const At<binary::Code>& code) -> Result {
+  if (snapshot_builder) {
+    // Validation errors stop visiting before this, but read errors (e.g. a
+    // missing final end) don't. HasError() is sticky, so a body that follows
+    // a read error is conservatively recorded as invalid too.
+    snapshot_builder->EndCode(ctx.code_count - 1, !errors.HasError());
+  }
+  return Result::Ok;
+}
+
+auto ValidateVisitor::EndCodeSection(binary::LazyCodeSection sec) -> Result {
+  if (thread_count > 1) {
+    return FailUnless(ValidateCodesInParallel());
+  }
+  return Result::Ok;
+}
+
 auto ValidateVisitor::OnData(const At<binary::DataSegment>& segment) -> Result {
   return FailUnless(Validate(ctx, segment));
 }
@@ -97,4 +198,103 @@ auto ValidateVisitor::FailUnless(bool b) -> Result {
   return b ? Result::Ok : Result::Fail;
 }
 
+namespace {
+
+// Validates a single function body the same way binary::visit::Visit and
+// ValidateVisitor would, stopping at the first validation failure. As in
+// serial validation, only an invalid body stops the bodies that follow from
+// being validated; one with a read error doesn't.
+auto ValidateCode(ValidCtx& ctx,
+                  binary::ReadCtx& read_ctx,
+                  const At<binary::Code>& code,
+                  bool fused) -> ExpressionResult {
+  if (!(BeginCode(ctx, code.loc()) &&
+        Validate(ctx, code->locals, RequireDefaultable::Yes))) {
+    return ExpressionResult::Invalid;
+  }
+  if (fused) {
+    return ReadAndValidateExpression(ctx, read_ctx, code->body->data);
+  }
+  for (auto&& instr : binary::ReadExpression(*code->body, read_ctx)) {
+    if (!Validate(ctx, instr)) {
+      return ExpressionResult::Invalid;
+    }
+  }
+  // A read error ends the body early without a validation error.
+  bool end_ok = binary::EndCode(code->body->data.last(0), read_ctx);
+  return end_ok && !read_ctx.errors.HasError() ? ExpressionResult::Valid
+                                               : ExpressionResult::ReadError;
+}
+
+}  // namespace
+
+bool ValidateVisitor::ValidateCodesInParallel() {
+  const Index count = static_cast<Index>(codes.size());
+  const Index first_code_index = ctx.code_count;
+  // Only the bodies that had errors keep a buffer.
+  std::vector<std::unique_ptr<BufferedErrors>> code_errors(count);
+  std::vector<char> code_valid(count, true);
+  // Functions after the first invalid one are never reported, so there is no
+  // need to validate them.
+  std::atomic<Index> first_invalid{count};
+  std::atomic<Index> next{0};
+
+  auto worker = [&]() {
+    ValidCtx worker_ctx{ctx, errors};
+    auto body_errors = std::make_unique<BufferedErrors>();
+    for (Index i; (i = next++) < count;) {
+      if (i > first_invalid) {
+        break;
+      }
+      if (skip_codes[i]) {
+        continue;
+      }
+      worker_ctx.errors = body_errors.get();
+      worker_ctx.code_count = first_code_index + i;
+      binary::ReadCtx read_ctx{features, *body_errors};
+      read_ctx.declared_data_count = ctx.declared_data_count;
+      auto result = ValidateCode(worker_ctx, read_ctx, codes[i], fused);
+      if (body_errors->HasError()) {
+        code_errors[i] = std::move(body_errors);
+        body_errors = std::make_unique<BufferedErrors>();
+      }
+      if (snapshot_builder) {
+        snapshot_builder->EndCode(first_code_index + i,
+                                  result == ExpressionResult::Valid);
+      }
+      if (result == ExpressionResult::Invalid) {
+        code_valid[i] = false;
+        Index expected = first_invalid;
+        while (i < expected &&
+               !first_invalid.compare_exchange_weak(expected, i)) {
+        }
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  Index worker_count = std::min(thread_count, count);
+  for (Index i = 1; i < worker_count; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ctx.code_count += count;
+  codes.clear();
+  skip_codes.clear();
+
+  for (Index i = 0; i < count; ++i) {
+    if (code_errors[i]) {
+      code_errors[i]->ReplayTo(errors);
+    }
+    if (!code_valid[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace wasp::valid
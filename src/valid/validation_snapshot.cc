@@ -0,0 +1,69 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "wasp/valid/validation_snapshot.h"
+
+#include <cassert>
+#include <utility>
+
+namespace wasp::valid {
+
+ValidationSnapshotBuilder::ValidationSnapshotBuilder(
+    const Features& features,
+    ValidationSnapshot& snapshot)
+    : previous_{std::move(snapshot)}, snapshot_{snapshot} {
+  snapshot_ = ValidationSnapshot{};
+  context_hash_.Update(u64{features.bits()});
+}
+
+void ValidationSnapshotBuilder::OnContextItem(binary::SectionId id,
+                                              Location loc) {
+  if (loc.empty()) {
+    has_context_hash_ = false;
+    return;
+  }
+  // Include the section id and size, so the same bytes moved to a different
+  // item or section give a different hash.
+  context_hash_.Update(u64{static_cast<u32>(id)} << 32 | loc.size());
+  context_hash_.Update(loc);
+}
+
+void ValidationSnapshotBuilder::EndContext(bool valid) {
+  if (has_context_hash_) {
+    snapshot_.context_hash = context_hash_.Digest();
+  }
+  snapshot_.context_valid = valid;
+  reuse_codes_ = snapshot_.context_hash &&
+                 snapshot_.context_hash == previous_.context_hash &&
+                 previous_.context_valid;
+}
+
+bool ValidationSnapshotBuilder::BeginCode(Index code_index, Location loc) {
+  assert(code_index == snapshot_.codes.size());
+  u64 hash = HashContent(loc);
+  bool reuse = reuse_codes_ && !loc.empty() &&
+               code_index < previous_.codes.size() &&
+               previous_.codes[code_index].hash == hash &&
+               previous_.codes[code_index].valid;
+  snapshot_.codes.push_back(ValidationSnapshot::Code{hash, reuse});
+  return reuse;
+}
+
+void ValidationSnapshotBuilder::EndCode(Index code_index, bool valid) {
+  snapshot_.codes[code_index].valid = valid;
+}
+
+}  // namespace wasp::valid
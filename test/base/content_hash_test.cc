@@ -0,0 +1,63 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "wasp/base/content_hash.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace ::wasp;
+
+TEST(ContentHashTest, KnownValues) {
+  // Reference values from the XXH64 implementation.
+  EXPECT_EQ(0xef46db3751d8e999ull, HashContent(""_su8));
+  EXPECT_EQ(0xd24ec4f1a98c6e5bull, HashContent("a"_su8));
+  EXPECT_EQ(0x44bc2cf5ad770999ull, HashContent("abc"_su8));
+}
+
+TEST(ContentHashTest, Seed) {
+  EXPECT_NE(HashContent("abc"_su8), HashContent("abc"_su8, 1));
+}
+
+TEST(ContentHashTest, Streaming) {
+  std::vector<u8> data(100);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<u8>(i * 7);
+  }
+  SpanU8 span{data};
+  const u64 expected = HashContent(span);
+
+  for (size_t split = 0; split <= data.size(); ++split) {
+    ContentHash hash;
+    hash.Update(span.first(split));
+    hash.Update(span.subspan(split));
+    EXPECT_EQ(expected, hash.Digest()) << "split at " << split;
+  }
+
+  ContentHash bytewise;
+  for (size_t i = 0; i < data.size(); ++i) {
+    bytewise.Update(span.subspan(i, 1));
+  }
+  EXPECT_EQ(expected, bytewise.Digest());
+}
+
+TEST(ContentHashTest, U64) {
+  ContentHash a, b;
+  a.Update(u64{0x0807060504030201});
+  b.Update("\x01\x02\x03\x04\x05\x06\x07\x08"_su8);
+  EXPECT_EQ(a.Digest(), b.Digest());
+}
@@ -0,0 +1,116 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "wasp/base/errors.h"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "wasp/base/buffered_errors.h"
+#include "wasp/base/concat.h"
+#include "wasp/base/errors_context_guard.h"
+
+using namespace ::wasp;
+
+namespace {
+
+class LogErrors : public Errors {
+ public:
+  bool HasError() const override { return false; }
+
+  std::vector<std::string> log;
+
+ protected:
+  void HandlePushContext(Location loc, string_view desc) override {
+    log.push_back(concat("push ", desc));
+  }
+  void HandlePopContext() override { log.push_back("pop"); }
+  void HandleOnError(Location loc, string_view message) override {
+    log.push_back(concat("error ", message));
+  }
+};
+
+}  // namespace
+
+TEST(ErrorsTest, ContextsWithoutErrorsAreNotHandled) {
+  LogErrors errors;
+  {
+    ErrorsContextGuard guard1{errors, {}, "a"};
+    ErrorsContextGuard guard2{errors, {}, "b"};
+  }
+  EXPECT_TRUE(errors.log.empty());
+}
+
+TEST(ErrorsTest, ContextsAreHandledOnError) {
+  LogErrors errors;
+  {
+    ErrorsContextGuard guard1{errors, {}, "a"};
+    {
+      ErrorsContextGuard guard2{errors, {}, "b"};
+    }
+    ErrorsContextGuard guard3{errors, {}, "c"};
+    errors.OnError({}, "1");
+    {
+      ErrorsContextGuard guard4{errors, {}, "d"};
+      errors.OnError({}, "2");
+    }
+    errors.OnError({}, "3");
+  }
+  EXPECT_EQ((std::vector<std::string>{"push a", "push c", "error 1", "push d",
+                                      "error 2", "pop", "error 3", "pop",
+                                      "pop"}),
+            errors.log);
+}
+
+TEST(ErrorsTest, DeepContexts) {
+  LogErrors errors;
+  const int kDepth = 100;
+  std::vector<std::string> descs;
+  for (int i = 0; i < kDepth; ++i) {
+    descs.push_back(concat(i));
+  }
+  for (int i = 0; i < kDepth; ++i) {
+    errors.PushContext({}, descs[i]);
+  }
+  errors.OnError({}, "deep");
+  for (int i = 0; i < kDepth; ++i) {
+    errors.PopContext();
+  }
+
+  ASSERT_EQ(2u * kDepth + 1, errors.log.size());
+  for (int i = 0; i < kDepth; ++i) {
+    EXPECT_EQ(concat("push ", i), errors.log[i]);
+    EXPECT_EQ("pop", errors.log[kDepth + 1 + i]);
+  }
+  EXPECT_EQ("error deep", errors.log[kDepth]);
+}
+
+TEST(ErrorsTest, BufferedErrors) {
+  BufferedErrors buffered;
+  {
+    ErrorsContextGuard guard1{buffered, {}, "a"};
+    ErrorsContextGuard guard2{buffered, {}, "b"};
+    buffered.OnError({}, "1");
+  }
+  EXPECT_TRUE(buffered.HasError());
+
+  LogErrors errors;
+  buffered.ReplayTo(errors);
+  EXPECT_EQ((std::vector<std::string>{"push a", "push b", "error 1", "pop",
+                                      "pop"}),
+            errors.log);
+}
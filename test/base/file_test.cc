@@ -0,0 +1,73 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "wasp/base/file.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace ::wasp;
+
+namespace {
+
+std::string WriteTempFile(string_view name, string_view contents) {
+  std::string filename = testing::TempDir() + std::string{name};
+  std::ofstream stream{filename, std::ios::out | std::ios::binary};
+  stream.write(contents.data(), contents.size());
+  return filename;
+}
+
+}  // namespace
+
+TEST(FileTest, ReadFile) {
+  auto filename = WriteTempFile("wasp_read_file", "\0asm\1\0\0\0"_sv);
+  auto buffer = ReadFile(filename);
+  ASSERT_TRUE(buffer.has_value());
+  EXPECT_EQ((Buffer{0, 'a', 's', 'm', 1, 0, 0, 0}), *buffer);
+  std::remove(filename.c_str());
+}
+
+TEST(FileTest, ReadFile_Missing) {
+  EXPECT_FALSE(ReadFile("/this/file/does/not/exist").has_value());
+}
+
+TEST(FileTest, MapFile) {
+  auto filename = WriteTempFile("wasp_map_file", "\0asm\1\0\0\0"_sv);
+  auto file = MapFile(filename);
+  ASSERT_TRUE(file.has_value());
+  EXPECT_EQ("\0asm\1\0\0\0"_su8, file->data());
+
+  // Moving the file keeps the data valid.
+  MappedFile moved{std::move(*file)};
+  EXPECT_EQ("\0asm\1\0\0\0"_su8, moved.data());
+  EXPECT_TRUE(file->data().empty());
+  std::remove(filename.c_str());
+}
+
+TEST(FileTest, MapFile_Empty) {
+  auto filename = WriteTempFile("wasp_map_file_empty", "");
+  auto file = MapFile(filename);
+  ASSERT_TRUE(file.has_value());
+  EXPECT_TRUE(file->data().empty());
+  std::remove(filename.c_str());
+}
+
+TEST(FileTest, MapFile_Missing) {
+  EXPECT_FALSE(MapFile("/this/file/does/not/exist").has_value());
+}
@@ -0,0 +1,329 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// End-to-end throughput benchmarks for the readers, the validator and the
+// converters, run on synthetic modules (see generators.h). Not run as part of
+// the tests; run `wasp_bench [filter] [scale]` directly, preferably from a
+// release build. Only the benchmarks whose "module/stage" name contains
+// `filter` are run.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <thread>
+
+#include "test/bench/generators.h"
+#include "wasp/base/buffer.h"
+#include "wasp/base/errors.h"
+#include "wasp/base/features.h"
+#include "wasp/base/formatters.h"
+#include "wasp/base/span.h"
+#include "wasp/binary/formatters.h"
+#include "wasp/binary/lazy_module.h"
+#include "wasp/binary/packed_expression.h"
+#include "wasp/binary/read.h"
+#include "wasp/binary/read/read_ctx.h"
+#include "wasp/binary/visitor.h"
+#include "wasp/binary/write.h"
+#include "wasp/convert/to_binary.h"
+#include "wasp/text/desugar.h"
+#include "wasp/text/formatters.h"
+#include "wasp/text/read.h"
+#include "wasp/text/read/lex.h"
+#include "wasp/text/read/read_ctx.h"
+#include "wasp/text/read/tokenizer.h"
+#include "wasp/text/resolve.h"
+#include "wasp/text/write.h"
+#include "wasp/valid/valid_ctx.h"
+#include "wasp/valid/validate.h"
+#include "wasp/valid/validate_visitor.h"
+
+using namespace ::wasp;
+using namespace ::wasp::bench;
+
+namespace {
+
+// Prints the first error, since the generated modules should have none.
+class BenchErrors : public Errors {
+ public:
+  bool HasError() const override { return has_error_; }
+
+ protected:
+  void HandlePushContext(Location loc, string_view desc) override {}
+  void HandlePopContext() override {}
+  void HandleOnError(Location loc, string_view message) override {
+    if (!has_error_) {
+      fprintf(stderr, "error: %.*s\n", static_cast<int>(message.size()),
+              message.data());
+    }
+    has_error_ = true;
+  }
+
+ private:
+  bool has_error_ = false;
+};
+
+struct Input {
+  std::string text;
+  text::Module text_module;
+  Buffer binary;
+  size_t instruction_count = 0;
+};
+
+SpanU8 ToSpan(const std::string& str) {
+  return SpanU8{reinterpret_cast<const u8*>(str.data()), str.size()};
+}
+
+Features GetFeatures() {
+  Features features;
+  features.EnableAll();
+  return features;
+}
+
+bool Matches(const std::string& name, const char* filter) {
+  return name.find(filter) != std::string::npos;
+}
+
+// Runs `func` until it has run `min_repeat` times and for at least
+// `min_seconds`, then prints the throughput of the best run. `setup`, if
+// given, is run untimed before each run of `func`.
+void Run(const std::string& name,
+         size_t bytes,
+         size_t instruction_count,
+         const std::function<bool()>& func,
+         const std::function<void()>& setup = nullptr) {
+  const int min_repeat = 3;
+  const double min_seconds = 0.5;
+  double best = 1e30;
+  double total = 0;
+  bool ok = true;
+  for (int i = 0; i < min_repeat || total < min_seconds; ++i) {
+    if (setup) {
+      setup();
+    }
+    auto start = std::chrono::steady_clock::now();
+    ok &= func();
+    std::chrono::duration<double> duration =
+        std::chrono::steady_clock::now() - start;
+    best = std::min(best, duration.count());
+    total += duration.count();
+  }
+  printf("%-40s %9.2f ms %9.1f MB/s %9.1f Minstr/s%s\n", name.c_str(),
+         best * 1e3, bytes / best / 1e6, instruction_count / best / 1e6,
+         ok ? "" : " (FAILED)");
+}
+
+bool Prepare(const Generator& generator, Index scale, Input& input) {
+  auto features = GetFeatures();
+  BenchErrors errors;
+  input.text = generator.generate(scale);
+  text::Tokenizer tokenizer{ToSpan(input.text)};
+  text::ReadCtx read_context{features, errors};
+  input.text_module =
+      ReadSingleModule(tokenizer, read_context).value_or(text::Module{});
+  Expect(tokenizer, read_context, text::TokenType::Eof);
+  text::Resolve(input.text_module, errors);
+  text::Desugar(input.text_module);
+  if (errors.HasError()) {
+    return false;
+  }
+
+  convert::BinCtx convert_context{features};
+  auto binary_module = convert::ToBinary(convert_context, input.text_module);
+  binary::Write(binary_module, std::back_inserter(input.binary));
+
+  // Check the generated module up front, so every stage is benchmarked on a
+  // valid module.
+  valid::ValidCtx validate_context{features, errors};
+  if (!valid::Validate(validate_context, binary_module)) {
+    return false;
+  }
+  for (const auto& code : binary_module->codes) {
+    input.instruction_count += code->body.instructions.size();
+  }
+  return true;
+}
+
+void BenchModule(const Generator& generator, Index scale, const char* filter) {
+  const std::string prefix = std::string{generator.name} + "/";
+  auto matches = [&](const char* stage) {
+    return Matches(prefix + stage, filter);
+  };
+  if (!matches("lex") && !matches("binary_read") &&
+      !matches("binary_read_packed") && !matches("binary_visit") &&
+      !matches("validate") &&
+      !matches("validate_fused") &&
+      !matches("text_read") && !matches("text_read_parallel") &&
+      !matches("resolve") && !matches("to_binary") &&
+      !matches("text_write")) {
+    return;
+  }
+
+  Input input;
+  if (!Prepare(generator, scale, input)) {
+    printf("%-40s (FAILED to generate)\n", generator.name);
+    return;
+  }
+
+  const auto features = GetFeatures();
+  const SpanU8 binary = input.binary;
+  const size_t binary_size = input.binary.size();
+  const size_t text_size = input.text.size();
+  const size_t instrs = input.instruction_count;
+
+  // Binary stages report the binary size, and text stages the text size.
+  if (matches("lex")) {
+    Run(prefix + "lex", text_size, instrs, [&]() {
+      SpanU8 data = ToSpan(input.text);
+      size_t token_count = 0;
+      while (text::LexNoWhitespace(&data).type != text::TokenType::Eof) {
+        ++token_count;
+      }
+      return token_count > 0;
+    });
+  }
+
+  if (matches("binary_read")) {
+    Run(prefix + "binary_read", binary_size, instrs, [&]() {
+      BenchErrors errors;
+      binary::ReadCtx read_context{features, errors};
+      auto module = binary::ReadModule(binary, read_context);
+      return module.has_value() && !errors.HasError();
+    });
+  }
+
+  if (matches("binary_read_packed")) {
+    Run(prefix + "binary_read_packed", binary_size, instrs, [&]() {
+      BenchErrors errors;
+      binary::ReadCtx read_context{features, errors};
+      auto module = binary::ReadPackedModule(binary, read_context);
+      return module.has_value() && !errors.HasError();
+    });
+  }
+
+  // Reads every section and instruction lazily, without building a module.
+  if (matches("binary_visit")) {
+    Run(prefix + "binary_visit", binary_size, instrs, [&]() {
+      BenchErrors errors;
+      auto module = binary::ReadLazyModule(binary, features, errors);
+      binary::visit::Visitor visitor;
+      return binary::visit::Visit(module, visitor) ==
+                 binary::visit::Result::Ok &&
+             !errors.HasError();
+    });
+  }
+
+  if (matches("validate")) {
+    Run(prefix + "validate", binary_size, instrs, [&]() {
+      BenchErrors errors;
+      auto module = binary::ReadLazyModule(binary, features, errors);
+      valid::ValidateVisitor visitor{features, errors};
+      return binary::visit::Visit(module, visitor) ==
+                 binary::visit::Result::Ok &&
+             !errors.HasError();
+    });
+  }
+
+  if (matches("validate_fused")) {
+    Run(prefix + "validate_fused", binary_size, instrs, [&]() {
+      BenchErrors errors;
+      auto module = binary::ReadLazyModule(binary, features, errors);
+      valid::ValidateVisitor visitor{features, errors};
+      visitor.fused = true;
+      return binary::visit::Visit(module, visitor) ==
+                 binary::visit::Result::Ok &&
+             !errors.HasError();
+    });
+  }
+
+  if (matches("text_read")) {
+    Run(prefix + "text_read", text_size, instrs, [&]() {
+      BenchErrors errors;
+      text::Tokenizer tokenizer{ToSpan(input.text)};
+      text::ReadCtx read_context{features, errors};
+      auto module = ReadSingleModule(tokenizer, read_context);
+      return module.has_value() && !errors.HasError();
+    });
+  }
+
+  if (matches("text_read_parallel")) {
+    Run(prefix + "text_read_parallel", text_size, instrs, [&]() {
+      BenchErrors errors;
+      text::Tokenizer tokenizer{ToSpan(input.text)};
+      text::ReadCtx read_context{features, errors};
+      read_context.thread_count =
+          std::max(std::thread::hardware_concurrency(), 2u);
+      auto module = ReadSingleModule(tokenizer, read_context);
+      return module.has_value() && !errors.HasError();
+    });
+  }
+
+  // Resolve modifies the module, so it is read again before each run.
+  if (matches("resolve")) {
+    text::Module module;
+    Run(
+        prefix + "resolve", text_size, instrs,
+        [&]() {
+          BenchErrors errors;
+          text::Resolve(module, errors);
+          return !errors.HasError();
+        },
+        [&]() {
+          BenchErrors errors;
+          text::Tokenizer tokenizer{ToSpan(input.text)};
+          text::ReadCtx read_context{features, errors};
+          module = ReadSingleModule(tokenizer, read_context)
+                       .value_or(text::Module{});
+        });
+  }
+
+  if (matches("to_binary")) {
+    Run(prefix + "to_binary", binary_size, instrs, [&]() {
+      convert::BinCtx convert_context{features};
+      auto module = convert::ToBinary(convert_context, input.text_module);
+      Buffer buffer;
+      binary::Write(module, std::back_inserter(buffer));
+      return buffer.size() == binary_size;
+    });
+  }
+
+  if (matches("text_write")) {
+    Run(prefix + "text_write", text_size, instrs, [&]() {
+      text::WriteCtx write_context;
+      Buffer buffer;
+      text::Write(write_context, input.text_module,
+                  std::back_inserter(buffer));
+      return !buffer.empty();
+    });
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* filter = argc > 1 ? argv[1] : "";
+  Index scale = argc > 2 ? static_cast<Index>(atoi(argv[2])) : 1;
+  scale = std::max(scale, Index{1});
+
+  for (const auto& generator : GetGenerators()) {
+    BenchModule(generator, scale, filter);
+  }
+  return 0;
+}
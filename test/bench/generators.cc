@@ -0,0 +1,355 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "test/bench/generators.h"
+
+#include <random>
+
+#include "absl/strings/str_cat.h"
+
+namespace wasp::bench {
+
+namespace {
+
+// A fixed seed, so every run benchmarks the same module.
+constexpr u32 kSeed = 0x5eed;
+
+}  // namespace
+
+std::string GenerateManySmallFunctions(Index scale) {
+  const Index count = 20000 * scale;
+  std::string result = "(module\n";
+  absl::StrAppend(&result,
+                  "  (type $t (func (param i32 i32) (result i32)))\n"
+                  "  (memory 1)\n"
+                  "  (global $g (mut i32) (i32.const 0))\n");
+  for (Index i = 0; i < count; ++i) {
+    absl::StrAppend(&result, "  (func (type $t) (local i64)\n",
+                    "    local.get 0 local.get 1 i32.add\n",
+                    "    i32.const ", i, " i32.mul\n",
+                    "    global.get $g i32.xor\n");
+    if (i > 0) {
+      absl::StrAppend(&result, "    local.get 0 local.get 1 call ", i - 1, "\n");
+    } else {
+      absl::StrAppend(&result, "    local.get 1 i32.load\n");
+    }
+    absl::StrAppend(&result, "    i32.add)\n");
+  }
+  absl::StrAppend(&result, ")\n");
+  return result;
+}
+
+std::string GenerateGiantFunction(Index scale) {
+  // Each iteration is 8 instructions.
+  const Index iterations = 125000 * scale;
+  std::mt19937 rng{kSeed};
+  std::string result =
+      "(module\n"
+      "  (memory 1)\n"
+      "  (func (param i32) (result i32) (local i32 i64 f64)\n";
+  for (Index i = 0; i < iterations; ++i) {
+    u32 value = rng();
+    absl::StrAppend(&result, "    local.get 0 i32.const ", value % 1000,
+                    " i32.add local.tee 1\n",
+                    "    i64.extend_i32_u local.get 2 i64.add local.set 2\n",
+                    "    local.get 1 local.set 0\n");
+  }
+  absl::StrAppend(&result, "    local.get 0))\n");
+  return result;
+}
+
+std::string GenerateDeepNesting(Index scale) {
+  const Index functions = 40 * scale;
+  const Index depth = 1000;
+  std::string result = "(module\n";
+  for (Index f = 0; f < functions; ++f) {
+    absl::StrAppend(&result, "  (func (param i32)\n");
+    for (Index i = 0; i < depth; ++i) {
+      absl::StrAppend(&result, "    block\n");
+    }
+    for (Index i = 0; i < depth; ++i) {
+      // Only `depth - i` blocks (plus the function) are left to branch to.
+      absl::StrAppend(&result, "    local.get 0 br_if ", i % 16 % (depth - i),
+                      "\n",
+                      "    end\n");
+    }
+    absl::StrAppend(&result, "  )\n");
+  }
+  absl::StrAppend(&result, ")\n");
+  return result;
+}
+
+std::string GenerateHugeBrTables(Index scale) {
+  const Index functions = 20 * scale;
+  const Index targets = 50000;
+  const Index depth = 16;
+  std::mt19937 rng{kSeed};
+  std::string result = "(module\n";
+  for (Index f = 0; f < functions; ++f) {
+    absl::StrAppend(&result, "  (func (param i32)\n");
+    for (Index i = 0; i < depth; ++i) {
+      absl::StrAppend(&result, "    block\n");
+    }
+    absl::StrAppend(&result, "    local.get 0\n    br_table");
+    for (Index i = 0; i <= targets; ++i) {
+      absl::StrAppend(&result, i % 32 == 0 ? "\n     " : "", " ",
+                      rng() % depth);
+    }
+    absl::StrAppend(&result, "\n");
+    for (Index i = 0; i < depth; ++i) {
+      absl::StrAppend(&result, "    end\n");
+    }
+    absl::StrAppend(&result, "  )\n");
+  }
+  absl::StrAppend(&result, ")\n");
+  return result;
+}
+
+std::string GenerateGcTypes(Index scale) {
+  const Index count = 2000 * scale;
+  std::mt19937 rng{kSeed};
+  std::string result = "(module\n";
+  for (Index i = 0; i < count; ++i) {
+    // Each struct references an earlier type, or itself for the first one.
+    Index ref = i == 0 ? 0 : rng() % i;
+    absl::StrAppend(&result, "  (type $s", i, " (struct (field i32)",
+                    " (field (mut (ref null $s", ref, ")))",
+                    " (field (mut f64)) (field (ref null $a", ref, "))))\n",
+                    "  (type $a", i, " (array (mut (ref null $s", i,
+                    "))))\n");
+  }
+  absl::StrAppend(&result, ")\n");
+  return result;
+}
+
+std::string GenerateHugeDataSegments(Index scale) {
+  const Index segments = 64 * scale;
+  const Index segment_size = 65536;
+  std::mt19937 rng{kSeed};
+  std::string result = absl::StrCat("(module\n  (memory ", segments, ")\n");
+  const char hex[] = "0123456789abcdef";
+  for (Index s = 0; s < segments; ++s) {
+    absl::StrAppend(&result, "  (data (i32.const ", s * segment_size,
+                    ")\n    \"");
+    for (Index i = 0; i < segment_size; ++i) {
+      u8 byte = rng();
+      char escape[] = {'\\', hex[byte >> 4], hex[byte & 15]};
+      result.append(escape, sizeof(escape));
+      if (i % 64 == 63 && i + 1 < segment_size) {
+        absl::StrAppend(&result, "\"\n    \"");
+      }
+    }
+    absl::StrAppend(&result, "\")\n");
+  }
+  absl::StrAppend(&result, ")\n");
+  return result;
+}
+
+std::string GenerateTextDataSegments(Index scale) {
+  const Index segments = 64 * scale;
+  const Index segment_size = 65536;
+  const Index piece_size = 1024;
+  const char* const words[] = {"lorem", "ipsum", "dolor",  "sit",  "amet",
+                               "wasm",  "text",  "format", "data", "segment"};
+  std::mt19937 rng{kSeed};
+  auto append_words = [&](std::string* out, Index size) {
+    while (out->size() < size) {
+      absl::StrAppend(out, words[rng() % 10], " ");
+    }
+    out->resize(size);
+  };
+
+  std::string result = absl::StrCat("(module\n  (memory ", segments, ")\n");
+  for (Index s = 0; s < segments; ++s) {
+    std::string comment;
+    append_words(&comment, 1024);
+    absl::StrAppend(&result, "  ;; segment ", s, ": ", comment, "\n",
+                    "  (; ", comment, " ;)\n",
+                    "  (data (i32.const ", s * segment_size, ")\n");
+    for (Index i = 0; i < segment_size; i += piece_size) {
+      // Each piece ends with an escaped newline, like a line of a text file.
+      std::string piece;
+      append_words(&piece, piece_size - 1);
+      absl::StrAppend(&result, "            \"", piece, "\\0a\"\n");
+    }
+    absl::StrAppend(&result, "  )\n");
+  }
+  absl::StrAppend(&result, ")\n");
+  return result;
+}
+
+std::string GenerateManyModuleFields(Index scale) {
+  const Index count = 20000 * scale;
+  const char* const types[] = {"i32", "i64", "f32", "f64"};
+  std::string result = "(module\n";
+  // The globals are imported, since validating each defined global's
+  // initializer copies the validation context.
+  for (Index i = 0; i < count; ++i) {
+    const char* type = types[i % 4];
+    absl::StrAppend(&result, "  (type $t", i, " (func (param ", type, " i32)",
+                    " (result ", type, ")))\n",
+                    "  (import \"env\" \"f", i, "\" (func (type $t", i,
+                    ")))\n",
+                    "  (import \"env\" \"g", i, "\" (global $g", i, " ",
+                    type, "))\n");
+  }
+  for (Index i = 0; i < count; ++i) {
+    absl::StrAppend(&result, "  (func $f", i, " (type $t", i, ")\n",
+                    "    local.get 0 local.get 1 drop)\n",
+                    "  (export \"f", i, "\" (func $f", i, "))\n",
+                    "  (export \"g", i, "\" (global $g", i, "))\n",
+                    "  (elem declare func $f", i, " ", i, ")\n");
+  }
+  absl::StrAppend(&result, ")\n");
+  return result;
+}
+
+std::string GenerateDeepStacks(Index scale) {
+  const Index functions = 2000 * scale;
+  const Index depth = 64;
+  std::string result =
+      "(module\n"
+      "  (type $b (func (param i32 i64 funcref) (result i32 i64 funcref)))\n";
+  for (Index f = 0; f < functions; ++f) {
+    absl::StrAppend(&result, "  (func (result i32)\n");
+    for (Index i = 0; i < depth; ++i) {
+      absl::StrAppend(&result, "    i32.const ", i, " i64.const ", f,
+                      " ref.null func\n");
+    }
+    for (Index i = 0; i < depth; ++i) {
+      absl::StrAppend(&result, "    block (type $b) end\n");
+    }
+    for (Index i = 0; i < depth; ++i) {
+      absl::StrAppend(&result, "    drop drop drop\n");
+    }
+    absl::StrAppend(&result, "    i32.const 0)\n");
+  }
+  absl::StrAppend(&result, ")\n");
+  return result;
+}
+
+std::string GenerateInstructionKeywords(Index scale) {
+  const Index functions = 2500 * scale;
+  const Index repeat = 20;
+  std::string body;
+  for (Index i = 0; i < repeat; ++i) {
+    absl::StrAppend(
+        &body,
+        "    local.get 0 i32.const 1 i32.add local.tee 2 i64.extend_i32_u\n"
+        "    local.get 1 i64.add local.set 1\n"
+        "    block (result i32) local.get 0 i32.load offset=4 align=4 end "
+        "drop\n"
+        "    f32.const nan f32.const 1.5 f32.mul f32.sqrt i32.trunc_f32_s\n"
+        "    i32.eqz if nop else nop end\n"
+        "    global.get 0 global.get 0 memory.size i32.lt_u br_if 0 drop\n"
+        "    i64.const 1 local.get 1 i64.rotl f64.convert_i64_u f64.neg "
+        "drop\n"
+        "    v128.const i32x4 0 1 2 3 v128.const i32x4 4 5 6 7\n"
+        "    i8x16.add_sat_s i32x4.extract_lane 0 drop\n");
+  }
+  std::string result =
+      "(module\n"
+      "  (memory 1)\n"
+      "  (global (mut i32) (i32.const 0))\n";
+  for (Index f = 0; f < functions; ++f) {
+    absl::StrAppend(&result,
+                    "  (func (param i32 i64) (result i32) (local i32)\n", body,
+                    "    local.get 2)\n");
+  }
+  absl::StrAppend(&result, ")\n");
+  return result;
+}
+
+std::string GenerateNamedReferences(Index scale) {
+  const Index count = 20000 * scale;
+  std::string result = "(module\n";
+  // The globals are imported, since validating each defined global's
+  // initializer copies the validation context.
+  for (Index i = 0; i < count; ++i) {
+    absl::StrAppend(&result, "  (import \"env\" \"g", i, "\" (global $g", i,
+                    " (mut i32)))\n");
+  }
+  for (Index i = 0; i < count; ++i) {
+    absl::StrAppend(&result, "  (func $f", i,
+                    " (param $p i32) (result i32) (local $l i32)\n",
+                    "    local.get $p global.get $g", u64{i} * 7919 % count,
+                    " i32.add local.set $l\n",
+                    "    block $done local.get $l br_if $done end\n",
+                    "    local.get $l call $f", u64{i} * 104729 % count,
+                    ")\n");
+  }
+  absl::StrAppend(&result, ")\n");
+  return result;
+}
+
+std::string GenerateNamedLabels(Index scale) {
+  const Index functions = 20 * scale;
+  const Index depth = 1000;
+  std::string body;
+  for (Index i = 0; i < depth; ++i) {
+    absl::StrAppend(&body, "    block $b", i, "\n");
+  }
+  for (Index i = depth; i > 0; --i) {
+    // Labels $b0 to $b{i-1} are in scope here.
+    absl::StrAppend(&body, "    local.get 0 br_if $b", i * 7919 % i,
+                    " end\n");
+  }
+  std::string result = "(module\n";
+  for (Index f = 0; f < functions; ++f) {
+    absl::StrAppend(&result, "  (func (param i32)\n", body, "  )\n");
+  }
+  absl::StrAppend(&result, ")\n");
+  return result;
+}
+
+std::string GenerateInlineSignatures(Index scale) {
+  const Index count = 50000 * scale;
+  const Index signature_count = 2000;
+  const char* const types[] = {"i32", "i64", "f32", "f64"};
+  std::string result = "(module\n";
+  for (Index i = 0; i < count; ++i) {
+    // The params are the base-4 digits of the signature number.
+    Index signature = u64{i} * 7919 % signature_count;
+    absl::StrAppend(&result, "  (func (param");
+    for (Index j = 0; j < 6; ++j, signature /= 4) {
+      absl::StrAppend(&result, " ", types[signature % 4]);
+    }
+    absl::StrAppend(&result, ") (result i32) unreachable)\n");
+  }
+  absl::StrAppend(&result, ")\n");
+  return result;
+}
+
+auto GetGenerators() -> const std::vector<Generator>& {
+  static const std::vector<Generator> generators = {
+      {"many_small_functions", GenerateManySmallFunctions},
+      {"giant_function", GenerateGiantFunction},
+      {"deep_nesting", GenerateDeepNesting},
+      {"huge_br_tables", GenerateHugeBrTables},
+      {"gc_types", GenerateGcTypes},
+      {"huge_data_segments", GenerateHugeDataSegments},
+      {"text_data_segments", GenerateTextDataSegments},
+      {"many_module_fields", GenerateManyModuleFields},
+      {"deep_stacks", GenerateDeepStacks},
+      {"instruction_keywords", GenerateInstructionKeywords},
+      {"named_references", GenerateNamedReferences},
+      {"named_labels", GenerateNamedLabels},
+      {"inline_signatures", GenerateInlineSignatures},
+  };
+  return generators;
+}
+
+}  // namespace wasp::bench
@@ -0,0 +1,83 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef WASP_TEST_BENCH_GENERATORS_H_
+#define WASP_TEST_BENCH_GENERATORS_H_
+
+#include <string>
+#include <vector>
+
+#include "wasp/base/types.h"
+
+namespace wasp::bench {
+
+// Synthetic modules in the text format. Each generator is deterministic, and
+// `scale` multiplies the size of the module (roughly linearly).
+struct Generator {
+  const char* name;
+  std::string (*generate)(Index scale);
+};
+
+// 20000 functions of about 10 instructions each.
+std::string GenerateManySmallFunctions(Index scale);
+
+// One function with 1 million instructions.
+std::string GenerateGiantFunction(Index scale);
+
+// Functions with 1000 nested blocks.
+std::string GenerateDeepNesting(Index scale);
+
+// Functions with a 50000 entry br_table.
+std::string GenerateHugeBrTables(Index scale);
+
+// 4000 struct and array types that reference each other (GC proposal).
+std::string GenerateGcTypes(Index scale);
+
+// 4 MiB of active data segments.
+std::string GenerateHugeDataSegments(Index scale);
+
+// 4 MiB of active data segments of mostly unescaped text, with long comments
+// and whitespace between them.
+std::string GenerateTextDataSegments(Index scale);
+
+// 20000 each of types, imported functions and globals, small functions,
+// exports and element segments.
+std::string GenerateManyModuleFields(Index scale);
+
+// 2000 functions that keep 192 operands of mixed numeric and reference types
+// on the stack, and pass them through multi-value blocks.
+std::string GenerateDeepStacks(Index scale);
+
+// 2500 functions that are mostly instruction keywords, with few immediates.
+std::string GenerateInstructionKeywords(Index scale);
+
+// 20000 functions that refer to each other, to imported globals, and to
+// their own params, locals and labels by name.
+std::string GenerateNamedReferences(Index scale);
+
+// Functions with 1000 nested named blocks, and branches to labels at every
+// depth.
+std::string GenerateNamedLabels(Index scale);
+
+// 50000 functions with inline signatures, `(param ...) (result ...)`, of
+// 2000 distinct function types.
+std::string GenerateInlineSignatures(Index scale);
+
+auto GetGenerators() -> const std::vector<Generator>&;
+
+}  // namespace wasp::bench
+
+#endif  // WASP_TEST_BENCH_GENERATORS_H_
@@ -21,6 +21,7 @@
 
 #include "gtest/gtest.h"
 #include "test/test_utils.h"
+#include "wasp/binary/module_index.h"
 
 using namespace ::wasp;
 using namespace ::wasp::binary;
@@ -85,6 +86,25 @@ TEST(BinaryLazyModuleUtilsTest, CopyFunctionNames) {
   ExpectNoErrors(errors);
 }
 
+TEST(BinaryLazyModuleUtilsTest, CopyFunctionNames_ModuleIndex) {
+  Features features;
+  TestErrors errors;
+  auto module = ReadLazyModule(GetModuleData(), features, errors);
+  ModuleIndex index{module};
+
+  using FunctionNameMap = std::map<Index, string_view>;
+
+  // Can be called repeatedly with the same index.
+  for (int i = 0; i < 2; ++i) {
+    FunctionNameMap function_names;
+    CopyFunctionNames(index, features,
+                      std::inserter(function_names, function_names.end()));
+    EXPECT_EQ((FunctionNameMap{{0, "import"}, {1, "export"}, {2, "custom"}}),
+              function_names);
+  }
+  ExpectNoErrors(errors);
+}
+
 TEST(BinaryLazyModuleUtilsTest, GetImportCount) {
   Features features;
   TestErrors errors;
@@ -0,0 +1,93 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "wasp/binary/module_index.h"
+
+#include "gtest/gtest.h"
+#include "test/test_utils.h"
+#include "wasp/binary/lazy_module.h"
+#include "wasp/binary/read/read_ctx.h"
+
+using namespace ::wasp;
+using namespace ::wasp::binary;
+using namespace ::wasp::test;
+
+namespace {
+
+SpanU8 GetModuleData() {
+  return "\0asm\x01\0\0\0"
+         "\x01\x04\x01\x60\0\0"          // 1 type: params:[] results:[]
+         "\x02\x0b\x01\0\x06import\0\0"  // 1 import: func mod:"" name:"import"
+         "\x03\x03\x02\0\0"              // 2 funcs: type 0, type 0
+         "\x0a\x08\x02\x02\0\x0b\x03\0\x01\x0b"  // 2 code: empty, nop
+         "\0\x05\x04name"_su8;                   // empty "name" section
+}
+
+}  // namespace
+
+TEST(BinaryModuleIndexTest, Sections) {
+  Features features;
+  TestErrors errors;
+  auto module = ReadLazyModule(GetModuleData(), features, errors);
+  ModuleIndex index{module};
+
+  EXPECT_EQ(5u, index.sections().size());
+  auto function_section = index.GetKnownSection(SectionId::Function);
+  ASSERT_TRUE(function_section.has_value());
+  EXPECT_EQ("\x02\0\0"_su8, function_section->value().data);
+  EXPECT_FALSE(index.GetKnownSection(SectionId::Export).has_value());
+
+  auto name_section = index.GetCustomSection("name");
+  ASSERT_TRUE(name_section.has_value());
+  EXPECT_EQ(""_su8, name_section->value().data);
+  EXPECT_FALSE(index.GetCustomSection("producers").has_value());
+  ExpectNoErrors(errors);
+}
+
+TEST(BinaryModuleIndexTest, ImportCount) {
+  Features features;
+  TestErrors errors;
+  auto module = ReadLazyModule(GetModuleData(), features, errors);
+  ModuleIndex index{module};
+
+  EXPECT_EQ(1u, index.GetImportCount(ExternalKind::Function));
+  EXPECT_EQ(0u, index.GetImportCount(ExternalKind::Table));
+  EXPECT_EQ(0u, index.GetImportCount(ExternalKind::Memory));
+  EXPECT_EQ(0u, index.GetImportCount(ExternalKind::Global));
+  EXPECT_EQ(1u, index.imported_function_count());
+  ExpectNoErrors(errors);
+}
+
+TEST(BinaryModuleIndexTest, GetCode) {
+  Features features;
+  TestErrors errors;
+  auto module = ReadLazyModule(GetModuleData(), features, errors);
+  ModuleIndex index{module};
+
+  EXPECT_EQ(2u, index.code_count());
+  EXPECT_FALSE(index.GetCode(0, module.ctx).has_value());  // Imported.
+
+  auto code1 = index.GetCode(1, module.ctx);
+  ASSERT_TRUE(code1.has_value());
+  EXPECT_EQ("\x0b"_su8, code1->value().body->data);
+
+  auto code2 = index.GetCode(2, module.ctx);
+  ASSERT_TRUE(code2.has_value());
+  EXPECT_EQ("\x01\x0b"_su8, code2->value().body->data);
+
+  EXPECT_FALSE(index.GetCode(3, module.ctx).has_value());
+  ExpectNoErrors(errors);
+}
@@ -0,0 +1,312 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "wasp/binary/packed_expression.h"
+
+#include "gtest/gtest.h"
+#include "test/test_utils.h"
+#include "wasp/base/features.h"
+#include "wasp/binary/lazy_expression.h"
+#include "wasp/binary/read.h"
+#include "wasp/binary/read/read_ctx.h"
+
+using namespace ::wasp;
+using namespace ::wasp::binary;
+using namespace ::wasp::test;
+
+namespace {
+
+using Kind = PackedInstruction::Kind;
+
+void ExpectSameSpan(Location expected, Location actual) {
+  EXPECT_EQ(expected.data(), actual.data());
+  EXPECT_EQ(expected.size(), actual.size());
+}
+
+}  // namespace
+
+TEST(BinaryPackedExprTest, Empty) {
+  PackedExpression expr;
+  EXPECT_TRUE(expr.empty());
+  EXPECT_EQ(expr.begin(), expr.end());
+}
+
+TEST(BinaryPackedExprTest, MatchesLazyExpression) {
+  Features features;
+  features.enable_bulk_memory();
+  features.enable_reference_types();
+  features.enable_simd();
+  TestErrors errors;
+  ReadCtx ctx{features, errors};
+
+  auto data =
+      "\x02\x40"                  // block
+      "\x02\x7f"                  // block (result i32)
+      "\x41\x80\x01"              // i32.const 128
+      "\x42\x7f"                  // i64.const -1
+      "\x43\x00\x00\x80\x3f"      // f32.const 1
+      "\x28\x02\x10"              // i32.load align=4 offset=16
+      "\x11\x00\x00"              // call_indirect 0 0
+      "\x0e\x02\x00\x01\x00"      // br_table 0 1 0
+      "\xfc\x0a\x00\x00"          // memory.copy
+      "\xfd\x0c\x00\x00\x00\x00"  // v128.const 0 ...
+      "\x00\x00\x00\x00\x00\x00"
+      "\x00\x00\x00\x00\x00\x00"
+      "\xd0\x70"                  // ref.null func
+      "\x1c\x01\x7f"              // select (result i32)
+      "\x0b\x0b"_su8;             // end end
+
+  auto packed = ReadPackedExpression(data, ctx);
+  ExpectNoErrors(errors);
+
+  std::vector<At<Instruction>> expected;
+  for (auto&& instr : ReadExpression(data, ctx)) {
+    expected.push_back(instr);
+  }
+  ASSERT_EQ(expected.size(), packed.size());
+
+  size_t i = 0;
+  for (auto&& instr : packed) {
+    EXPECT_EQ(expected[i], instr);
+    ExpectSameSpan(expected[i].loc(), instr.loc());
+    ExpectSameSpan(expected[i]->opcode.loc(), instr->opcode.loc());
+    if (instr->has_br_table_immediate()) {
+      const auto& expected_imm = *expected[i]->br_table_immediate();
+      const auto& imm = *instr->br_table_immediate();
+      ASSERT_EQ(expected_imm.targets.size(), imm.targets.size());
+      for (size_t j = 0; j < imm.targets.size(); ++j) {
+        ExpectSameSpan(expected_imm.targets[j].loc(), imm.targets[j].loc());
+      }
+      ExpectSameSpan(expected_imm.default_target.loc(),
+                     imm.default_target.loc());
+    }
+    ++i;
+  }
+  EXPECT_EQ(expected.size(), i);
+
+  // v128.const is too large to pack.
+  size_t out_of_line = 0;
+  for (auto&& instr : packed.packed_instructions()) {
+    if (instr.kind == Kind::OutOfLine) {
+      ++out_of_line;
+    }
+  }
+  EXPECT_EQ(1u, out_of_line);
+}
+
+TEST(BinaryPackedExprTest, SideArenas) {
+  Features features;
+  features.enable_reference_types();
+  TestErrors errors;
+  ReadCtx ctx{features, errors};
+
+  auto data =
+      "\x0e\x02\x00\x81\x01\x02"  // br_table 0 129 2
+      "\x1c\x01\x7e"              // select (result i64)
+      "\x0e\x00\x03"              // br_table 3
+      "\x0b"_su8;                  // end
+  auto packed = ReadPackedExpression(data, ctx);
+  ExpectNoErrors(errors);
+
+  auto instrs = packed.packed_instructions();
+  ASSERT_EQ(4u, instrs.size());
+  ASSERT_EQ(Kind::BrTable, instrs[0].kind);
+  ASSERT_EQ(Kind::Select, instrs[1].kind);
+  ASSERT_EQ(Kind::BrTable, instrs[2].kind);
+
+  EXPECT_EQ((std::vector<Index>{0, 129}),
+            (std::vector<Index>{packed.br_table_targets(instrs[0]).begin(),
+                                packed.br_table_targets(instrs[0]).end()}));
+  EXPECT_EQ(2u, packed.br_table_default_target(instrs[0]));
+  ASSERT_EQ(1u, packed.select_types(instrs[1]).size());
+  EXPECT_EQ(NumericType::I64,
+            *packed.select_types(instrs[1])[0]->numeric_type());
+  EXPECT_TRUE(packed.br_table_targets(instrs[2]).empty());
+  EXPECT_EQ(3u, packed.br_table_default_target(instrs[2]));
+}
+
+TEST(BinaryPackedExprTest, LongBrTable) {
+  // A br_table that is longer than PackedInstruction::length can hold.
+  std::vector<u8> data = {0x0e, 0xac, 0x02};  // br_table with 300 targets
+  for (int i = 0; i < 300; ++i) {
+    data.push_back(i % 2);
+  }
+  data.push_back(0x00);  // default target
+  data.push_back(0x0b);  // end
+
+  Features features;
+  TestErrors errors;
+  ReadCtx ctx{features, errors};
+  auto packed = ReadPackedExpression(data, ctx);
+  ExpectNoErrors(errors);
+
+  ASSERT_EQ(2u, packed.size());
+  EXPECT_EQ(Kind::BrTable, packed.packed_instructions()[0].kind);
+
+  std::vector<At<Instruction>> expected;
+  for (auto&& instr : ReadExpression(data, ctx)) {
+    expected.push_back(instr);
+  }
+  ASSERT_EQ(2u, expected.size());
+  auto it = packed.begin();
+  EXPECT_EQ(expected[0], *it);
+  ExpectSameSpan(expected[0].loc(), it->loc());
+  ++it;
+  EXPECT_EQ(expected[1], *it);
+  ExpectSameSpan(expected[1].loc(), it->loc());
+}
+
+TEST(BinaryPackedExprTest, NoLocation) {
+  // Instructions without a location in the expression's data are stored out
+  // of line.
+  PackedExpression expr;
+  expr.Append(At{Instruction{Opcode::Nop}});
+  ASSERT_EQ(1u, expr.size());
+  EXPECT_EQ(Kind::OutOfLine, expr.packed_instructions()[0].kind);
+  EXPECT_EQ(At{Instruction{Opcode::Nop}}, *expr.begin());
+}
+
+namespace {
+
+void ExpectFastReadMatches(SpanU8 data,
+                           const Features& features = Features{}) {
+  TestErrors errors, fast_errors;
+  ReadCtx ctx{features, errors}, fast_ctx{features, fast_errors};
+  auto packed = ReadPackedExpression(data, ctx);
+  auto fast_packed = FastReadPackedExpression(data, fast_ctx);
+
+  ASSERT_EQ(packed.size(), fast_packed.size());
+  auto it = fast_packed.begin();
+  for (auto&& instr : packed) {
+    EXPECT_EQ(instr, *it);
+    ExpectSameSpan(instr.loc(), it->loc());
+    ++it;
+  }
+  EXPECT_EQ(ctx.seen_final_end, fast_ctx.seen_final_end);
+  EXPECT_EQ(ctx.open_blocks, fast_ctx.open_blocks);
+  ExpectErrors(errors.errors, fast_errors);
+}
+
+}  // namespace
+
+TEST(BinaryPackedExprTest, FastRead) {
+  ExpectFastReadMatches(
+      "\x02\x40"                                  // block
+      "\x03\x7e"                                  // loop (result i64)
+      "\x04\x40\x05\x0b"                          // if else end
+      "\x20\x00\x21\x81\x01"                      // local.get local.set
+      "\x41\x7f"                                  // i32.const -1
+      "\x42\x80\x80\x80\x80\x80\x80\x80\x80\x01"  // i64.const
+      "\x44\x00\x00\x00\x00\x00\x00\xf0\x3f"      // f64.const 1
+      "\x36\x02\x00"                              // i32.store
+      "\x0e\x00\x00"                              // br_table 0
+      "\x6a\x1a"                                  // i32.add drop
+      "\x0b\x0b\x0b"_su8);                        // end end end
+}
+
+TEST(BinaryPackedExprTest, FastRead_Fallback) {
+  Features features;
+  features.enable_multi_value();
+  features.enable_sign_extension();
+  // block (type 1), i32.extend8_s, memory.size, call_indirect
+  ExpectFastReadMatches("\x02\x01\xc0\x3f\x00\x11\x00\x00\x0b\x0b"_su8,
+                        features);
+}
+
+TEST(BinaryPackedExprTest, FastRead_Errors) {
+  // else without if
+  ExpectFastReadMatches("\x05"_su8);
+  // Truncated i32.const and f32.const.
+  ExpectFastReadMatches("\x41\x80"_su8);
+  ExpectFastReadMatches("\x43\x00\x00"_su8);
+  // local.get with a u32 that is too large.
+  ExpectFastReadMatches("\x20\x80\x80\x80\x80\x70"_su8);
+  // nop after the final end.
+  ExpectFastReadMatches("\x0b\x01"_su8);
+  // block (result v128) without simd enabled.
+  ExpectFastReadMatches("\x02\x7b\x0b\x0b"_su8);
+  // Unclosed block.
+  ExpectFastReadMatches("\x02\x40"_su8);
+}
+
+TEST(BinaryPackedExprTest, IteratorCopy) {
+  PackedExpression expr;
+  expr.Append(At{Instruction{Opcode::Nop}});
+  expr.Append(At{Instruction{Opcode::I32Const, s32{1}}});
+  auto iter = expr.begin();
+  EXPECT_EQ(Opcode::Nop, (*iter++)->opcode);
+  auto copy = iter;
+  EXPECT_EQ(Opcode::I32Const, (*copy)->opcode);
+  EXPECT_EQ(Opcode::I32Const, (*iter)->opcode);
+  EXPECT_EQ(expr.end(), ++copy);
+}
+
+TEST(BinaryPackedExprTest, ReadPackedModule) {
+  // (module
+  //   (func (result i32) (local i32) i32.const 1 i32.const 2 i32.add)
+  //   (func (result i32) i32.const 5))
+  const SpanU8 data =
+      "\0asm\x01\0\0\0"
+      "\x01\x05\x01\x60\x00\x01\x7f"
+      "\x03\x03\x02\x00\x00"
+      "\x0a\x10\x02"
+      "\x09\x01\x01\x7f\x41\x01\x41\x02\x6a\x0b"
+      "\x04\x00\x41\x05\x0b"_su8;
+
+  TestErrors errors;
+  ReadCtx ctx{errors};
+  auto module = ReadModule(data, ctx);
+  ASSERT_TRUE(module.has_value());
+  auto packed = ReadPackedModule(data, ctx);
+  ASSERT_TRUE(packed.has_value());
+  ExpectNoErrors(errors);
+
+  EXPECT_TRUE(packed->module.codes.empty());
+  ASSERT_EQ(module->codes.size(), packed->codes.size());
+  for (size_t i = 0; i < module->codes.size(); ++i) {
+    const auto& code = module->codes[i];
+    const auto& packed_code = packed->codes[i];
+    EXPECT_EQ(code.loc(), packed_code.loc());
+    EXPECT_EQ(code->locals, packed_code->locals);
+    const auto& instructions = code->body.instructions;
+    ASSERT_EQ(instructions.size(), packed_code->body.size());
+    size_t j = 0;
+    for (const auto& instr : packed_code->body) {
+      EXPECT_EQ(instructions[j], instr);
+      ExpectSameSpan(instructions[j].loc(), instr.loc());
+      ++j;
+    }
+  }
+  module->codes.clear();
+  EXPECT_EQ(*module, packed->module);
+}
+
+TEST(BinaryPackedExprTest, ReadPackedModule_Errors) {
+  // (module (func <unknown opcode 0xff>))
+  const SpanU8 data =
+      "\0asm\x01\0\0\0"
+      "\x01\x04\x01\x60\x00\x00"
+      "\x03\x02\x01\x00"
+      "\x0a\x05\x01"
+      "\x03\x00\xff\x0b"_su8;
+
+  TestErrors expected_errors, actual_errors;
+  ReadCtx expected_ctx{expected_errors}, actual_ctx{actual_errors};
+  EXPECT_FALSE(ReadModule(data, expected_ctx).has_value());
+  EXPECT_FALSE(ReadPackedModule(data, actual_ctx).has_value());
+  EXPECT_FALSE(expected_errors.errors.empty());
+  ExpectErrors(expected_errors.errors, actual_errors);
+}
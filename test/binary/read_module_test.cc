@@ -16,6 +16,11 @@
 
 #include "wasp/binary/read.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "test/binary/constants.h"
 #include "test/binary/test_utils.h"
@@ -27,6 +32,32 @@ using namespace ::wasp::binary;
 using namespace ::wasp::test;
 using namespace ::wasp::binary::test;
 
+namespace {
+
+// The size of the largest allocation made while `track_allocations` is set.
+bool track_allocations = false;
+size_t largest_allocation = 0;
+
+}  // namespace
+
+void* operator new(size_t size) {
+  if (track_allocations) {
+    largest_allocation = std::max(largest_allocation, size);
+  }
+  if (void* ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+  std::free(ptr);
+}
+
 class BinaryReadModuleTest : public ::testing::Test {
  protected:
   void OK(const Module& expected, SpanU8 data) {
@@ -129,6 +160,65 @@ TEST_F(BinaryReadModuleTest, SimpleModule) {
       "\x0a\x06\x01\x04\x00\x41\x2a\x0b"_su8);
 }
 
+TEST_F(BinaryReadModuleTest, LargeBodyFewInstructions) {
+  auto append_leb = [](std::vector<u8>& out, u32 value) {
+    do {
+      u8 byte = value & 0x7f;
+      value >>= 7;
+      out.push_back(value ? byte | 0x80 : byte);
+    } while (value);
+  };
+
+  // (func br_table 0 0 ... 0), with 10000 targets.
+  const u32 target_count = 10000;
+  std::vector<u8> body = {0x00, 0x0e};  // No locals, br_table.
+  append_leb(body, target_count);
+  body.insert(body.end(), target_count + 1, 0x00);  // Targets and default.
+  body.push_back(0x0b);                             // end
+
+  std::vector<u8> code_section = {0x01};  // One code entry.
+  append_leb(code_section, static_cast<u32>(body.size()));
+  code_section.insert(code_section.end(), body.begin(), body.end());
+
+  std::vector<u8> data = {0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+                          0x01, 0x04, 0x01, 0x60, 0x00, 0x00,  // type
+                          0x03, 0x02, 0x01, 0x00,              // func
+                          0x0a};                               // code
+  append_leb(data, static_cast<u32>(code_section.size()));
+  data.insert(data.end(), code_section.begin(), code_section.end());
+
+  auto module = ReadModule(data, ctx);
+  ExpectNoErrors(errors);
+  ASSERT_TRUE(module.has_value());
+  ASSERT_EQ(1u, module->codes.size());
+  const auto& instructions = module->codes[0]->body.instructions;
+  EXPECT_EQ(2u, instructions.size());
+  // The instruction list isn't left sized for the body's byte count.
+  EXPECT_LE(instructions.capacity(), 2 * instructions.size());
+}
+
+TEST_F(BinaryReadModuleTest, LargeSectionCount) {
+  // An import section that claims 1000000 imports, and is large enough to
+  // pass ReadCount, but whose first import is malformed.
+  const u32 count = 1000000;
+  std::vector<u8> section = {0xc0, 0x84, 0x3d};  // count
+  section.insert(section.end(), count, 0xff);
+
+  std::vector<u8> data = {0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+                          0x02, 0xc3, 0x84, 0x3d};  // import, 1000003 bytes
+  data.insert(data.end(), section.begin(), section.end());
+
+  largest_allocation = 0;
+  track_allocations = true;
+  auto module = ReadModule(data, ctx);
+  track_allocations = false;
+  EXPECT_FALSE(module.has_value());
+  errors.Clear();
+  // Reserving the declared count would allocate count * sizeof(At<Import>)
+  // bytes, hundreds of times the section size.
+  EXPECT_LT(largest_allocation, 2 * data.size());
+}
+
 TEST_F(BinaryReadModuleTest, BadMagic) {
   Fail({{0, "module"},
         {0, "magic"},
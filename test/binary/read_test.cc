@@ -23,6 +23,7 @@
 #include "test/binary/constants.h"
 #include "test/binary/test_utils.h"
 #include "test/test_utils.h"
+#include "wasp/binary/encoding.h"
 #include "wasp/binary/formatters.h"
 #include "wasp/binary/name_section/read.h"
 #include "wasp/binary/read/read_ctx.h"
@@ -3317,6 +3318,36 @@ TEST_F(BinaryReadTest, Opcode_Unknown_threads_prefix) {
   FailUnknownOpcode(0xfe, 268435456);
 }
 
+TEST_F(BinaryReadTest, Opcode_AllOpcodes) {
+  ctx.features.EnableAll();
+
+  constexpr u32 kOpcodeCount = 0
+#define WASP_V(...) +1
+#define WASP_FEATURE_V(...) +1
+#define WASP_PREFIX_V(...) +1
+#include "wasp/base/inc/opcode.inc"
+#undef WASP_V
+#undef WASP_FEATURE_V
+#undef WASP_PREFIX_V
+      ;
+
+  // Every opcode in opcode.inc should round-trip through the decoding tables.
+  for (u32 i = 0; i < kOpcodeCount; ++i) {
+    auto opcode = Opcode(i);
+    auto encoded = encoding::Opcode::Encode(opcode);
+    u8 data[] = {encoded.u8_code, 0, 0, 0, 0, 0};
+    size_t length = 1;
+    if (encoded.u32_code) {
+      u32 code = *encoded.u32_code;
+      do {
+        data[length++] = (code & 0x7f) | (code >= 0x80 ? 0x80 : 0);
+        code >>= 7;
+      } while (code > 0);
+    }
+    OK(Read<Opcode>, opcode, SpanU8{data, length});
+  }
+}
+
 TEST_F(BinaryReadTest, Opcode_function_references) {
   ctx.features.enable_function_references();
 
@@ -3716,6 +3747,78 @@ TEST_F(BinaryReadTest, DefinedType_BadForm) {
        "\x40"_su8);
 }
 
+namespace {
+
+template <typename T>
+std::vector<u8> EncodeVarInt(T value, size_t padding) {
+  std::vector<u8> result;
+  bool more;
+  do {
+    u8 byte = value & 0x7f;
+    value >>= 7;
+    if (std::is_signed_v<T>) {
+      more = !((value == 0 && (byte & 0x40) == 0) ||
+               (value == -1 && (byte & 0x40) != 0));
+    } else {
+      more = value != 0;
+    }
+    result.push_back(byte | (more ? 0x80 : 0));
+  } while (more);
+  // Pad with bytes that look like a continuation of the varint.
+  result.insert(result.end(), padding, 0xff);
+  return result;
+}
+
+template <typename T>
+void ExpectVarIntRoundTrip(T value, ReadCtx& ctx) {
+  for (size_t padding : {0, 1, 7, 8}) {
+    auto buffer = EncodeVarInt(value, padding);
+    SpanU8 data{buffer};
+    auto actual = Read<T>(&data, ctx);
+    ASSERT_TRUE(actual.has_value());
+    EXPECT_EQ(value, **actual);
+    EXPECT_EQ(buffer.size() - padding, actual->loc().size());
+    EXPECT_EQ(padding, data.size());
+  }
+}
+
+}  // namespace
+
+TEST_F(BinaryReadTest, VarInt_Padded) {
+  for (int bits = 0; bits < 32; ++bits) {
+    ExpectVarIntRoundTrip<u32>(u32{1} << bits, ctx);
+    ExpectVarIntRoundTrip<u32>((u32{1} << bits) - 1, ctx);
+    ExpectVarIntRoundTrip<s32>(static_cast<s32>(u32{1} << bits), ctx);
+    // Negated in unsigned arithmetic, since -INT32_MIN overflows.
+    ExpectVarIntRoundTrip<s32>(static_cast<s32>(~(u32{1} << bits) + 1), ctx);
+  }
+  ExpectVarIntRoundTrip<u32>(~u32{0}, ctx);
+  for (int bits = 0; bits < 64; ++bits) {
+    ExpectVarIntRoundTrip<s64>(static_cast<s64>(u64{1} << bits), ctx);
+    ExpectVarIntRoundTrip<s64>(static_cast<s64>((u64{1} << bits) - 1), ctx);
+    ExpectVarIntRoundTrip<s64>(static_cast<s64>(~(u64{1} << bits) + 1), ctx);
+  }
+  ExpectNoErrors(errors);
+}
+
+TEST_F(BinaryReadTest, VarInt_Padded_Malformed) {
+  // Errors are the same when there are enough bytes left for the fast path.
+  Fail(Read<u32>,
+       {{0, "u32"},
+        {4, "Last byte of u32 must be zero extension: expected 0x2, got 0x12"}},
+       "\xf0\xf0\xf0\xf0\x12\x00\x00\x00"_su8);
+  Fail(Read<u32>,
+       {{0, "u32"},
+        {4, "Last byte of u32 must be zero extension: expected 0x0, got 0x80"}},
+       "\x80\x80\x80\x80\x80\x80\x80\x80"_su8);
+  Fail(Read<s32>,
+       {{0, "s32"},
+        {4,
+         "Last byte of s32 must be sign extension: expected "
+         "0x3 or 0x7b, got 0x73"}},
+       "\xff\xff\xff\xff\x73\x00\x00\x00"_su8);
+}
+
 TEST_F(BinaryReadTest, U32) {
   OK(Read<u32>, 32u, "\x20"_su8);
   OK(Read<u32>, 448u, "\xc0\x03"_su8);
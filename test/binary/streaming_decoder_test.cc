@@ -0,0 +1,171 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "wasp/binary/streaming_decoder.h"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test/test_utils.h"
+#include "wasp/base/concat.h"
+#include "wasp/base/features.h"
+#include "wasp/binary/formatters.h"
+#include "wasp/binary/lazy_module.h"
+
+using namespace ::wasp;
+using namespace ::wasp::binary;
+using namespace ::wasp::test;
+
+namespace {
+
+// Same module as in visitor_test.cc.
+const u8 kTestModule[] = {
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x03, 0x60,
+    0x01, 0x7f, 0x01, 0x7f, 0x60, 0x01, 0x7d, 0x01, 0x7d, 0x60, 0x00, 0x00,
+    0x02, 0x0b, 0x01, 0x03, 0x66, 0x6f, 0x6f, 0x03, 0x62, 0x61, 0x72, 0x00,
+    0x00, 0x03, 0x03, 0x02, 0x01, 0x02, 0x04, 0x05, 0x01, 0x70, 0x01, 0x01,
+    0x02, 0x05, 0x03, 0x01, 0x00, 0x01, 0x06, 0x06, 0x01, 0x7f, 0x00, 0x41,
+    0x01, 0x0b, 0x07, 0x08, 0x01, 0x04, 0x71, 0x75, 0x75, 0x78, 0x00, 0x01,
+    0x08, 0x01, 0x02, 0x09, 0x08, 0x01, 0x00, 0x41, 0x00, 0x0b, 0x02, 0x00,
+    0x01, 0x0a, 0x0c, 0x02, 0x07, 0x00, 0x43, 0x00, 0x00, 0x28, 0x42, 0x0b,
+    0x02, 0x00, 0x0b, 0x0b, 0x0b, 0x01, 0x00, 0x41, 0x02, 0x0b, 0x05, 0x68,
+    0x65, 0x6c, 0x6c, 0x6f,
+};
+
+struct RecordingVisitor : visit::Visitor {
+  visit::Result BeginModule(LazyModule&) { return Record("BeginModule"); }
+  visit::Result EndModule(LazyModule&) { return Record("EndModule"); }
+  visit::Result OnType(const At<DefinedType>& x) { return Record("Type", x); }
+  visit::Result OnImport(const At<Import>& x) { return Record("Import", x); }
+  visit::Result OnFunction(const At<Function>& x) {
+    return Record("Function", x);
+  }
+  visit::Result OnTable(const At<Table>& x) { return Record("Table", x); }
+  visit::Result OnMemory(const At<Memory>& x) { return Record("Memory", x); }
+  visit::Result OnGlobal(const At<Global>& x) { return Record("Global", x); }
+  visit::Result OnExport(const At<Export>& x) { return Record("Export", x); }
+  visit::Result OnStart(const At<Start>& x) { return Record("Start", x); }
+  visit::Result OnElement(const At<ElementSegment>& x) {
+    return Record("Element", x);
+  }
+  visit::Result BeginCode(const At<Code>&) { return Record("BeginCode"); }
+  visit::Result OnInstruction(const At<Instruction>& x) {
+    return Record("Instruction", x);
+  }
+  visit::Result EndCode(const At<Code>&) { return Record("EndCode"); }
+  visit::Result OnData(const At<DataSegment>& x) { return Record("Data", x); }
+
+  template <typename... Args>
+  visit::Result Record(Args&&... args) {
+    events.push_back(concat(std::forward<Args>(args)...));
+    return events.size() == fail_after ? visit::Result::Fail
+                                       : visit::Result::Ok;
+  }
+
+  std::vector<std::string> events;
+  size_t fail_after = 0;
+};
+
+auto VisitInChunks(SpanU8 data,
+                   span_extent_t chunk_size,
+                   RecordingVisitor& visitor,
+                   TestErrors& errors) -> visit::Result {
+  Features features;
+  visit::StreamingDecoder<RecordingVisitor> decoder{features, errors, visitor};
+  while (!data.empty()) {
+    auto chunk = data.first(std::min(chunk_size, data.size()));
+    data.remove_prefix(chunk.size());
+    if (decoder.Push(chunk) == visit::Result::Fail) {
+      return visit::Result::Fail;
+    }
+  }
+  return decoder.Finish();
+}
+
+std::vector<std::string> ErrorMessages(const TestErrors& errors) {
+  std::vector<std::string> result;
+  for (auto&& error_list : errors.errors) {
+    result.push_back(error_list.back().message);
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(BinaryStreamingDecoderTest, MatchesVisit) {
+  Features features;
+  TestErrors errors;
+  RecordingVisitor expected;
+  auto module = ReadLazyModule(SpanU8{kTestModule}, features, errors);
+  EXPECT_EQ(visit::Result::Ok, visit::Visit(module, expected));
+  ExpectNoErrors(errors);
+
+  for (span_extent_t chunk_size = 1; chunk_size <= sizeof(kTestModule);
+       ++chunk_size) {
+    RecordingVisitor actual;
+    EXPECT_EQ(visit::Result::Ok,
+              VisitInChunks(SpanU8{kTestModule}, chunk_size, actual, errors));
+    EXPECT_EQ(expected.events, actual.events) << "chunk size " << chunk_size;
+    ExpectNoErrors(errors);
+  }
+}
+
+TEST(BinaryStreamingDecoderTest, VisitorFail) {
+  RecordingVisitor visitor;
+  visitor.fail_after = 3;
+  TestErrors errors;
+  EXPECT_EQ(visit::Result::Fail,
+            VisitInChunks(SpanU8{kTestModule}, 5, visitor, errors));
+  EXPECT_EQ(3u, visitor.events.size());
+  ExpectNoErrors(errors);
+}
+
+TEST(BinaryStreamingDecoderTest, Truncated) {
+  for (span_extent_t size : {span_extent_t{4}, span_extent_t{9},
+                             span_extent_t{30}, sizeof(kTestModule) - 1}) {
+    SpanU8 data = SpanU8{kTestModule}.first(size);
+
+    Features features;
+    TestErrors expected_errors, actual_errors;
+    RecordingVisitor expected, actual;
+    auto module = ReadLazyModule(data, features, expected_errors);
+    visit::Visit(module, expected);
+    VisitInChunks(data, 7, actual, actual_errors);
+
+    EXPECT_FALSE(expected_errors.errors.empty());
+    EXPECT_EQ(ErrorMessages(expected_errors), ErrorMessages(actual_errors))
+        << "size " << size;
+  }
+}
+
+TEST(BinaryStreamingDecoderTest, BadHeader) {
+  const SpanU8 headers[] = {
+      "\0ASM\x01\0\0\0"_su8,  // Bad magic.
+      "\0asm\x02\0\0\0"_su8,  // Bad version.
+  };
+  for (SpanU8 header : headers) {
+    for (span_extent_t chunk_size : {span_extent_t{1}, span_extent_t{8}}) {
+      TestErrors errors;
+      RecordingVisitor visitor;
+      EXPECT_EQ(visit::Result::Fail,
+                VisitInChunks(header, chunk_size, visitor, errors));
+      EXPECT_FALSE(errors.errors.empty());
+      // Neither BeginModule nor EndModule is called.
+      EXPECT_TRUE(visitor.events.empty());
+    }
+  }
+}
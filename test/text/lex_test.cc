@@ -17,6 +17,7 @@
 #include "wasp/text/read/lex.h"
 
 #include <algorithm>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -65,6 +66,10 @@ struct ExpectedToken {
 
 using TT = TokenType;
 
+SpanU8 ToSpanU8(const std::string& str) {
+  return SpanU8{reinterpret_cast<const u8*>(str.data()), str.size()};
+}
+
 SpanU8 ExpectLex(ExpectedToken et, SpanU8 data) {
   Token expected{Location{data.begin(), et.size}, et.type, et.immediate};
   auto actual = Lex(&data);
@@ -146,6 +151,22 @@ TEST(LexTest, Reserved) {
   ExpectLex({5, TT::Reserved}, "32.5x"_su8);
 }
 
+TEST(LexTest, Reserved_KeywordPrefix) {
+  // Keywords followed by more reserved characters.
+  ExpectLex({10, TT::Reserved}, "i32.constx"_su8);
+  ExpectLex({10, TT::Reserved}, "i32.const$"_su8);
+  ExpectLex({6, TT::Reserved}, "blocky"_su8);
+  ExpectLex({15, TT::Reserved}, "ref.null.extern"_su8);
+
+  // Keywords that are followed by a number, without the number.
+  ExpectLex({5, TT::Reserved}, "nan:0"_su8);
+  ExpectLex({6, TT::Reserved}, "nan:0x"_su8);
+  ExpectLex({7, TT::Reserved}, "nan:0xg"_su8);
+  ExpectLex({8, TT::Reserved}, "-nan:0xg"_su8);
+  ExpectLex({6, TT::Reserved}, "align= 4"_su8);
+  ExpectLex({7, TT::Reserved}, "offset=)"_su8);
+}
+
 TEST(LexTest, Whitespace) {
   for (u8 c : {' ', '\t', '\n'}) {
     ExpectLex({1, TT::Whitespace}, SpanU8(&c, 1));
@@ -157,6 +178,45 @@ TEST(LexTest, Whitespace) {
   ExpectLex({9, TT::Whitespace}, " \n\t \n\t \n\t"_su8);
 }
 
+// Long runs are scanned many bytes at a time; check that the end of the run
+// is found at every offset within and after the first few chunks.
+TEST(LexTest, LongRuns) {
+  for (u32 n = 1; n < 100; ++n) {
+    std::string whitespace;
+    for (u32 i = 0; i < n; ++i) {
+      whitespace += " \t\r\n"[i % 4];
+    }
+    std::string filler(n, 'a');
+    for (u32 i = 0; i < n; i += 7) {
+      filler[i] = ';';  // Not followed by `)`.
+    }
+
+    auto ws = whitespace + "x";
+    ExpectLex({n, TT::Whitespace}, ToSpanU8(ws));
+
+    auto line = ";;" + filler + "\nx";
+    ExpectLex({n + 3, TT::LineComment}, ToSpanU8(line));
+    auto invalid_line = ";;" + filler;
+    ExpectLex({n + 2, TT::InvalidLineComment}, ToSpanU8(invalid_line));
+
+    auto block = "(;" + filler + "(;;);)x";
+    ExpectLex({n + 8, TT::BlockComment}, ToSpanU8(block));
+    auto invalid_block = "(;" + filler;
+    ExpectLex({n + 2, TT::InvalidBlockComment}, ToSpanU8(invalid_block));
+
+    auto text = "\"" + std::string(n, 'a') + "\"x";
+    ExpectLex({n + 2, TT::Text, Text{string_view{text}.substr(0, n + 2), n}},
+              ToSpanU8(text));
+    auto escaped = "\"" + std::string(n, 'a') + "\\0a" + std::string(n, 'b') +
+                   "\"x";
+    ExpectLex({2 * n + 5, TT::Text,
+               Text{string_view{escaped}.substr(0, 2 * n + 5), 2 * n + 1}},
+              ToSpanU8(escaped));
+    auto newline = "\"" + std::string(n, 'a') + "\n\"";
+    ExpectLex({n + 3, TT::InvalidText}, ToSpanU8(newline));
+  }
+}
+
 TEST(LexTest, AlignEqNat) {
   ExpectLex({9, TT::AlignEqNat, LI::Nat(HU::No)}, "align=123"_su8);
   ExpectLex({11, TT::AlignEqNat, LI::Nat(HU::Yes)}, "align=1_234"_su8);
@@ -1228,3 +1288,36 @@ TEST(LexTest, Tokenizer) {
     EXPECT_EQ(0, t.count());
   }
 }
+
+TEST(LexTest, SplitParenGroups) {
+  auto span = "  (a (b) c) ;; )\n (; ) ;) (\"(\\\")\" ;; )\n ;)) (d"_su8;
+  EXPECT_EQ((std::vector<SpanU8>{span.subspan(2, 9), span.subspan(26, 16)}),
+            SplitParenGroups(span));
+
+  // Stops at the first token that isn't `(`.
+  span = "(a) b (c)"_su8;
+  EXPECT_EQ((std::vector<SpanU8>{span.subspan(0, 3)}), SplitParenGroups(span));
+  EXPECT_EQ(std::vector<SpanU8>{}, SplitParenGroups("(@a) (b)"_su8));
+  EXPECT_EQ(std::vector<SpanU8>{}, SplitParenGroups(")"_su8));
+
+  // Unclosed groups, strings and comments.
+  EXPECT_EQ(std::vector<SpanU8>{}, SplitParenGroups("(a (b)"_su8));
+  EXPECT_EQ(std::vector<SpanU8>{}, SplitParenGroups("(a \")\""_su8));
+  EXPECT_EQ(std::vector<SpanU8>{}, SplitParenGroups("(a (; ) ;"_su8));
+  EXPECT_EQ(std::vector<SpanU8>{}, SplitParenGroups("(a ;; )"_su8));
+}
+
+TEST(LexTest, TokenizerSeek) {
+  auto span = "(a b) (c)"_su8;
+  Tokenizer t{span};
+
+  t.Peek(1);
+  EXPECT_EQ(span, t.Remaining());
+
+  Token previous{span.subspan(4, 1), TokenType::Rpar};
+  t.Seek(span.begin() + 6, previous);
+  EXPECT_EQ(previous, t.Previous());
+  EXPECT_EQ(0, t.count());
+  EXPECT_EQ((Token{span.subspan(6, 1), TokenType::Lpar}), t.Read());
+  EXPECT_EQ(span.subspan(7), t.Remaining());
+}
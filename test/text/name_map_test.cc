@@ -128,3 +128,42 @@ TEST(TextNameMapTest, LetBindings) {
   ExpectGet(map, "$a"_sv, 0);
   ExpectGet(map, "$c"_sv, 2);
 }
+
+TEST(TextNameMapTest, PopRestoresShadowed) {
+  NameMap map;
+  map.NewBound("$a"_sv);  // 0
+  map.NewBound("$b"_sv);  // 1
+
+  map.Push();
+  EXPECT_TRUE(map.Has("$a"_sv));
+  EXPECT_FALSE(map.HasSinceLastPush("$a"_sv));
+  EXPECT_TRUE(map.NewBound("$a"_sv));
+  EXPECT_TRUE(map.NewBound("$c"_sv));
+  EXPECT_TRUE(map.HasSinceLastPush("$a"_sv));
+  EXPECT_FALSE(map.NewBound("$c"_sv));
+  // 0  1  2  3
+  // $a $c $a $b
+  ExpectGet(map, "$a"_sv, 0);
+  ExpectGet(map, "$b"_sv, 3);
+  ExpectGet(map, "$c"_sv, 1);
+
+  map.Pop();
+  ExpectGet(map, "$a"_sv, 0);
+  ExpectGet(map, "$b"_sv, 1);
+  EXPECT_FALSE(map.Has("$c"_sv));
+  EXPECT_FALSE(map.NewBound("$a"_sv));
+}
+
+TEST(TextNameMapTest, Reset) {
+  NameMap map;
+  map.NewBound("$a"_sv);
+  map.Push();
+  map.NewBound("$b"_sv);
+
+  map.Reset();
+  EXPECT_EQ(0u, map.Size());
+  EXPECT_FALSE(map.Has("$a"_sv));
+  EXPECT_FALSE(map.Has("$b"_sv));
+  EXPECT_TRUE(map.NewBound("$a"_sv));
+  ExpectGet(map, "$a"_sv, 0);
+}
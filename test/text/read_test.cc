@@ -3137,6 +3137,76 @@ TEST_F(TextReadTest, Module_MultipleStart) {
        "(start 0) (start 0)"_su8);
 }
 
+// Reads `span` in order and on several threads, and checks that the results,
+// the errors and where reading stopped are the same.
+template <typename Func>
+void ExpectSameModuleInParallel(Func&& func, SpanU8 span) {
+  TestErrors serial_errors;
+  ReadCtx serial_ctx{serial_errors};
+  Tokenizer serial_tokenizer{span};
+  auto serial = func(serial_tokenizer, serial_ctx);
+
+  TestErrors parallel_errors;
+  ReadCtx parallel_ctx{parallel_errors};
+  parallel_ctx.thread_count = 4;
+  Tokenizer parallel_tokenizer{span};
+  auto parallel = func(parallel_tokenizer, parallel_ctx);
+
+  EXPECT_EQ(serial, parallel);
+  ASSERT_EQ(serial_errors.errors.size(), parallel_errors.errors.size());
+  for (size_t i = 0; i < serial_errors.errors.size(); ++i) {
+    const auto& expected = serial_errors.errors[i];
+    const auto& actual = parallel_errors.errors[i];
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t j = 0; j < expected.size(); ++j) {
+      EXPECT_EQ(expected[j].loc.begin(), actual[j].loc.begin());
+      EXPECT_EQ(expected[j].loc.end(), actual[j].loc.end());
+      EXPECT_EQ(expected[j].message, actual[j].message);
+    }
+  }
+  EXPECT_EQ(serial_tokenizer.Previous(), parallel_tokenizer.Previous());
+  EXPECT_EQ(serial_tokenizer.Peek().loc.begin(),
+            parallel_tokenizer.Peek().loc.begin());
+}
+
+TEST_F(TextReadTest, Module_Parallel) {
+  for (auto span : {
+           "(type (func)) (func nop) (start 0)"_su8,
+           "(func (param i32) (; ) ;) ;; )\n local.get 0 drop) (data \")\")"_su8,
+           "(import \"m\" \"n\" (func)) (func (import \"m\" \"n\"))"_su8,
+           "(func) (func) (memory 1) extra (func)"_su8,
+           "(func) (func) )"_su8,
+           "(func) (func"_su8,
+           "(func) (func) (@a) (func)"_su8,
+       }) {
+    ExpectSameModuleInParallel(ReadModule, span);
+  }
+}
+
+TEST_F(TextReadTest, Module_Parallel_Errors) {
+  for (auto span : {
+           // Only the first item with an error is reported.
+           "(func) (func foo) (func bar)"_su8,
+           "(func) (func nop (i32.const 0 ()) (func bar)"_su8,
+           // These depend on the items before them.
+           "(func) (import \"m\" \"n\" (func)) (func)"_su8,
+           "(func) (func (import \"m\" \"n\")) (func)"_su8,
+           "(func) (start 0) (func) (start 0) (func)"_su8,
+       }) {
+    ExpectSameModuleInParallel(ReadModule, span);
+  }
+}
+
+TEST_F(TextReadTest, SingleModule_Parallel) {
+  for (auto span : {
+           "(module $m (func) (func nop))"_su8,
+           "(module (func) (func nop)"_su8,
+           "(module (func) (func) (func foo))"_su8,
+       }) {
+    ExpectSameModuleInParallel(ReadSingleModule, span);
+  }
+}
+
 TEST_F(TextReadTest, SingleModule) {
   // Can be optionally wrapped in (module).
   OK(ReadSingleModule, Module{}, "(module)"_su8);
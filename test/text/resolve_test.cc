@@ -243,6 +243,34 @@ TEST_F(TextResolveTest, FunctionTypeUse_DeferType) {
       defined_types[0]);
 }
 
+TEST_F(TextResolveTest, FunctionTypeMap_UseBeforeDefine) {
+  FunctionTypeMap& ftm = ctx.function_type_map;
+
+  ftm.Define(BoundFunctionType{{BVT{nullopt, VT_I32}}, {}});
+  // Deferred types are numbered after the defined types.
+  EXPECT_EQ(1u, ftm.Use(FunctionType{{VT_F32}, {}}));
+  EXPECT_EQ(2u, ftm.Use(FunctionType{{VT_I64}, {}}));
+  EXPECT_EQ(1u, ftm.Use(FunctionType{{VT_F32}, {}}));
+
+  // Uses find a defined type first. The deferred types are still numbered
+  // after all the defined types.
+  ftm.Define(BoundFunctionType{{BVT{"$a"_sv, VT_F32}}, {}});
+  EXPECT_EQ(1u, ftm.Use(FunctionType{{VT_F32}, {}}));
+  EXPECT_EQ(3u, ftm.Use(FunctionType{{VT_I64}, {}}));
+  EXPECT_EQ(4u, ftm.Use(FunctionType{{}, {VT_I64}}));
+
+  auto defined_types = ftm.EndModule();
+  ASSERT_EQ(5u, ftm.Size());
+  EXPECT_EQ((FunctionType{{VT_F32}, {}}), ftm.Get(2));
+  EXPECT_EQ((FunctionType{{VT_I64}, {}}), ftm.Get(3));
+  EXPECT_EQ((FunctionType{{}, {VT_I64}}), ftm.Get(4));
+  ASSERT_EQ(3u, defined_types.size());
+
+  // The deferred types are defined now.
+  EXPECT_EQ(3u, ftm.Use(FunctionType{{VT_I64}, {}}));
+  EXPECT_EQ(5u, ftm.Use(FunctionType{{VT_F64}, {}}));
+}
+
 TEST_F(TextResolveTest, FunctionTypeUse_NoFunctionTypeInContext) {
   FunctionTypeUse type_use;
   Resolve(ctx, type_use);
@@ -72,6 +72,21 @@ TEST(ArgParserTest, LongParam) {
   EXPECT_EQ("hello", param);
 }
 
+TEST(ArgParserTest, LongParamWithEquals) {
+  std::string param;
+  ArgParser parser{"prog"};
+  parser.Add("--param", "metavar", "help",
+             [&](string_view arg) {
+               param += arg;
+               param += ';';
+             });
+  parser.Add("--flag", "help", [&]() { param += "flag;"; });
+
+  std::vector<string_view> args{{"--param=hello", "--param=", "--flag=x"}};
+  parser.Parse(args);
+  EXPECT_EQ("hello;;", param);
+}
+
 TEST(ArgParserTest, BothParam) {
   std::string param;
   ArgParser parser{"prog"};
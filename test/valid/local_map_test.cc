@@ -30,8 +30,11 @@ void ExpectTypes(const LocalMap& locals,
   for (Index i = 0; i < value_types.size(); ++i) {
     const auto& value_type = value_types[i];
     EXPECT_EQ(value_type, locals.GetType(i)) << "at index " << i;
+    EXPECT_EQ(StackType{value_type}, locals.GetStackType(i))
+        << "at index " << i;
   }
   EXPECT_EQ(nullopt, locals.GetType(locals.GetCount() + 1));
+  EXPECT_EQ(nullopt, locals.GetStackType(locals.GetCount()));
 }
 
 TEST(ValidLocalMapTest, Append_CountType) {
@@ -164,3 +167,33 @@ TEST(ValidLocalMapTest, PopToEmpty) {
   locals.Pop();
   ExpectTypes(locals, {});
 }
+
+TEST(ValidLocalMapTest, DenseLimit) {
+  LocalMap locals{4};
+
+  EXPECT_TRUE(locals.Append(1, VT_I32));
+  locals.Push();
+  EXPECT_TRUE(locals.Append(3, VT_F32));
+  ExpectTypes(locals, {VT_F32, VT_F32, VT_F32, VT_I32});
+
+  // Exceeding the limit switches to the compressed representation only.
+  EXPECT_TRUE(locals.Append(1, VT_I64));
+  ExpectTypes(locals, {VT_F32, VT_F32, VT_F32, VT_I64, VT_I32});
+
+  locals.Pop();
+  ExpectTypes(locals, {VT_I32});
+
+  locals.Reset();
+  EXPECT_TRUE(locals.Append({VT_I64, VT_F64}));
+  ExpectTypes(locals, {VT_I64, VT_F64});
+}
+
+TEST(ValidLocalMapTest, DenseLimit_Large) {
+  LocalMap locals;
+  EXPECT_TRUE(locals.Append(LocalMap::kDefaultDenseLimit, VT_I32));
+  EXPECT_TRUE(locals.Append(1, VT_F32));
+  EXPECT_EQ(StackType::I32(), locals.GetStackType(0));
+  EXPECT_EQ(StackType::F32(),
+            locals.GetStackType(LocalMap::kDefaultDenseLimit));
+  EXPECT_EQ(nullopt, locals.GetStackType(LocalMap::kDefaultDenseLimit + 1));
+}
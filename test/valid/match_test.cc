@@ -33,6 +33,14 @@ using namespace ::wasp::valid::test;
 using namespace ::wasp::binary;
 using namespace ::wasp::binary::test;
 
+namespace {
+
+ValueType MakeRef(Index index, Null null = Null::No) {
+  return ValueType{ReferenceType{RefType{HeapType{index}, null}}};
+}
+
+}  // namespace
+
 enum Comparison {
   SAME,
   DIFF,
@@ -69,6 +77,10 @@ class ValidMatchTest : public ::testing::Test {
     ctx.match_types.Reset(ctx.types.size());
   }
 
+  void SetTypeClasses() {
+    ctx.same_types.SetClasses(ComputeTypeClasses(ctx.types));
+  }
+
   auto MakeDiagonalMatrix(size_t size) -> std::vector<Comparison>  {
     std::vector<Comparison> results(size * size, DIFF);
     for (size_t i = 0; i < size; ++i) {
@@ -300,6 +312,47 @@ TEST_F(ValidMatchTest, IsSame_ValueType_VarMutuallyRecursive) {
   EXPECT_TRUE(IsSame(ctx, VT_Ref1, VT_Ref2));
 }
 
+TEST_F(ValidMatchTest, IsSame_ValueType_TypeClasses) {
+  PushFunctionType({VT_I32}, {VT_Ref0});  // 0
+  PushFunctionType({VT_I32}, {VT_Ref2});  // 1
+  PushFunctionType({VT_I32}, {VT_Ref1});  // 2
+  PushFunctionType({VT_I32}, {MakeRef(4)});  // 3
+  PushFunctionType({VT_F32}, {MakeRef(3)});  // 4
+  SetTypeClasses();
+
+  EXPECT_TRUE(IsSame(ctx, VT_Ref0, VT_Ref1));
+  EXPECT_TRUE(IsSame(ctx, VT_Ref0, VT_Ref2));
+  EXPECT_TRUE(IsSame(ctx, VT_Ref1, VT_Ref2));
+  EXPECT_FALSE(IsSame(ctx, VT_Ref0, MakeRef(3)));
+  EXPECT_FALSE(IsSame(ctx, MakeRef(3), MakeRef(4)));
+  EXPECT_TRUE(IsMatch(ctx, VT_Ref1, VT_Ref0));
+}
+
+TEST_F(ValidMatchTest, ComputeTypeClasses) {
+  auto field = [](ValueType type) {
+    return FieldType{StorageType{type}, Mutability::Const};
+  };
+
+  PushFunctionType({}, {});                                          // 0
+  PushFunctionType({VT_Funcref}, {});                                // 1
+  PushFunctionType({VT_RefNullFunc}, {});                            // 2
+  PushStructType(StructType{FieldTypeList{field(MakeRef(3))}});      // 3
+  PushStructType(StructType{FieldTypeList{field(MakeRef(4))}});      // 4
+  PushStructType(
+      StructType{FieldTypeList{field(MakeRef(4, Null::Yes))}});      // 5
+  PushArrayType(ArrayType{field(VT_Ref0)});                          // 6
+  PushArrayType(
+      ArrayType{FieldType{StorageType{PackedType::I8}, Mutability::Const}});  // 7
+
+  auto classes = ComputeTypeClasses(ctx.types);
+  ASSERT_EQ(8u, classes.size());
+  EXPECT_EQ(classes[1], classes[2]);  // funcref == ref null func
+  EXPECT_EQ(classes[3], classes[4]);
+  EXPECT_NE(classes[0], classes[1]);
+  EXPECT_NE(classes[3], classes[5]);
+  EXPECT_NE(classes[6], classes[7]);
+}
+
 TEST_F(ValidMatchTest, IsSame_StorageType) {
   std::vector<StorageType> types{
       StorageType{VT_I32},
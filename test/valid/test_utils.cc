@@ -57,6 +57,19 @@ void ExpectErrorSubstr(const ExpectedError& expected, TestErrors& errors) {
   ClearErrors(errors);
 }
 
+void ExpectSameErrors(const TestErrors& expected, const TestErrors& actual) {
+  ASSERT_EQ(expected.errors.size(), actual.errors.size());
+  for (size_t i = 0; i < expected.errors.size(); ++i) {
+    const auto& expected_list = expected.errors[i];
+    const auto& actual_list = actual.errors[i];
+    ASSERT_EQ(expected_list.size(), actual_list.size());
+    for (size_t j = 0; j < expected_list.size(); ++j) {
+      EXPECT_EQ(expected_list[j].loc, actual_list[j].loc);
+      EXPECT_EQ(expected_list[j].message, actual_list[j].message);
+    }
+  }
+}
+
 void ClearErrors(TestErrors& errors) {
   errors.context_stack.clear();
   errors.errors.clear();
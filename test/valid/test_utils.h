@@ -37,6 +37,10 @@ void ExpectError(const ExpectedError& expected, TestErrors&);
 void ExpectErrorSubstr(const ExpectedError&, TestErrors&);
 void ClearErrors(TestErrors&);
 
+// Expects `actual` to have the same errors as `expected`, including their
+// locations.
+void ExpectSameErrors(const TestErrors& expected, const TestErrors& actual);
+
 }  // namespace wasp::valid::test
 
 #endif // WASP_VALID_TEST_UTILS_H_
@@ -0,0 +1,65 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "wasp/valid/types.h"
+
+#include "gtest/gtest.h"
+
+#include "test/binary/constants.h"
+#include "wasp/base/concat.h"
+#include "wasp/binary/formatters.h"
+#include "wasp/valid/formatters.h"
+
+using namespace ::wasp;
+using namespace ::wasp::valid;
+using namespace ::wasp::binary::test;
+
+TEST(ValidTypesTest, StackType_ValueTypeRoundTrip) {
+  const binary::ValueType value_types[] = {
+      VT_I32,          VT_I64,        VT_F32,         VT_F64,
+      VT_V128,         VT_Funcref,    VT_Externref,   VT_Anyref,
+      VT_Eqref,        VT_Exnref,     VT_I31ref,      VT_RefFunc,
+      VT_RefNullFunc,  VT_RefI31,     VT_RefNullI31,  VT_Ref0,
+      VT_RefNull0,     VT_Ref2,       VT_RefNull2,    VT_RTT_0_Func,
+      VT_RTT_0_0,      VT_RTT_1_Any,  VT_RTT_1_0,
+  };
+
+  for (const auto& value_type : value_types) {
+    StackType stack_type{value_type};
+    EXPECT_TRUE(stack_type.is_value_type());
+    EXPECT_FALSE(stack_type.is_any());
+    // value_type() has no locations, so compare the formatted types instead.
+    EXPECT_EQ(concat(value_type), concat(stack_type.value_type()));
+    EXPECT_EQ(stack_type, StackType{stack_type.value_type()});
+  }
+}
+
+TEST(ValidTypesTest, StackType_Equality) {
+  EXPECT_EQ(StackType::I32(), StackType{VT_I32});
+  EXPECT_EQ(StackType::Funcref(), StackType{VT_Funcref});
+  EXPECT_EQ(StackType{Any{}}, StackType{});
+  EXPECT_EQ(StackType{VT_Ref0}, StackType{VT_Ref0});
+
+  EXPECT_NE(StackType::I32(), StackType::I64());
+  EXPECT_NE(StackType::I32(), StackType{Any{}});
+  EXPECT_NE(StackType{VT_Ref0}, StackType{VT_RefNull0});
+  EXPECT_NE(StackType{VT_Ref0}, StackType{VT_Ref1});
+  EXPECT_NE(StackType{VT_RTT_0_0}, StackType{VT_RTT_1_0});
+  EXPECT_NE(StackType{VT_RTT_0_Func}, StackType{VT_RTT_0_0});
+  // The shorthand and its canonical form are distinct, as they are for
+  // binary::ValueType; IsSame treats them as the same type.
+  EXPECT_NE(StackType{VT_Funcref}, StackType{VT_RefNullFunc});
+}
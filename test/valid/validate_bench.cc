@@ -0,0 +1,178 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Microbenchmarks for the module-level bookkeeping in ValidCtx. Not run as
+// part of the tests; run `wasp_valid_bench [scale]` directly, preferably from
+// a release build.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "wasp/base/errors_nop.h"
+#include "wasp/base/features.h"
+#include "wasp/binary/types.h"
+#include "wasp/valid/valid_ctx.h"
+#include "wasp/valid/validate.h"
+
+using namespace ::wasp;
+using namespace ::wasp::binary;
+using namespace ::wasp::valid;
+
+namespace {
+
+// Runs `func` `repeat` times and prints the best time per operation.
+void Run(const char* name, size_t ops, int repeat,
+         const std::function<bool()>& func) {
+  double best = 1e30;
+  bool ok = true;
+  for (int i = 0; i < repeat; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    ok &= func();
+    std::chrono::duration<double> duration =
+        std::chrono::steady_clock::now() - start;
+    best = std::min(best, duration.count());
+  }
+  printf("%-28s %10zu ops %8.1f ns/op%s\n", name, ops, best * 1e9 / ops,
+         ok ? "" : " (FAILED)");
+}
+
+// A context with `count` functions of type () -> ().
+void InitContext(ValidCtx& ctx, Index count) {
+  ctx.types.push_back(DefinedType{FunctionType{}});
+  ctx.defined_type_count = 1;
+  ctx.same_types.Reset(1);
+  ctx.functions.assign(count, Function{0});
+}
+
+void BenchExports(Index count) {
+  std::vector<std::string> names(count);
+  for (Index i = 0; i < count; ++i) {
+    names[i] = "export_" + std::to_string(i);
+  }
+  std::vector<At<Export>> exports;
+  for (Index i = 0; i < count; ++i) {
+    exports.push_back(Export{ExternalKind::Function, names[i], i});
+  }
+
+  ErrorsNop errors;
+  Run("export names", count, 5, [&]() {
+    ValidCtx ctx{Features{}, errors};
+    InitContext(ctx, count);
+    ctx.export_names.reserve(count);
+    bool valid = true;
+    for (const auto& export_ : exports) {
+      valid &= Validate(ctx, export_);
+    }
+    return valid;
+  });
+}
+
+void BenchElementSegment(Index count) {
+  IndexList indexes;
+  for (Index i = 0; i < count; ++i) {
+    indexes.push_back(count - 1 - i);
+  }
+  At<ElementSegment> segment{ElementSegment{
+      SegmentType::Declared,
+      ElementList{ElementListWithIndexes{ExternalKind::Function, indexes}}}};
+
+  ErrorsNop errors;
+  Run("element segment indexes", count, 5, [&]() {
+    ValidCtx ctx{Features{}, errors};
+    InitContext(ctx, count);
+    return Validate(ctx, segment);
+  });
+}
+
+void BenchRefFunc(Index function_count, size_t instruction_count) {
+  Features features;
+  features.enable_reference_types();
+  features.enable_function_references();
+
+  std::mt19937 rng{0};
+  std::uniform_int_distribution<Index> dist{0, function_count - 1};
+  std::vector<At<Instruction>> instructions;
+  for (size_t i = 0; i < instruction_count; ++i) {
+    // Only even functions are declared.
+    instructions.push_back(
+        Instruction{Opcode::RefFunc, Index{dist(rng) & ~Index{1}}});
+    instructions.push_back(Instruction{Opcode::Drop});
+  }
+
+  ErrorsNop errors;
+  ValidCtx ctx{features, errors};
+  InitContext(ctx, function_count);
+  for (Index i = 0; i < function_count; i += 2) {
+    ctx.declared_functions.insert(i);
+  }
+
+  Run("ref.func + drop", instruction_count, 5, [&]() {
+    ctx.code_count = 0;
+    bool valid = BeginCode(ctx, Location{});
+    for (const auto& instr : instructions) {
+      valid &= Validate(ctx, instr);
+    }
+    return valid;
+  });
+}
+
+// Blocks that each produce an i32: `block (result i32) ... i32.const 0 end`.
+void BenchNestedBlocks(Index depth, int function_count) {
+  std::vector<At<Instruction>> instructions;
+  for (Index i = 0; i < depth; ++i) {
+    instructions.push_back(
+        Instruction{Opcode::Block, BlockType{ValueType::I32_NoLocation()}});
+  }
+  instructions.push_back(Instruction{Opcode::I32Const, s32{0}});
+  for (Index i = 0; i < depth; ++i) {
+    instructions.push_back(Instruction{Opcode::End});
+  }
+
+  ErrorsNop errors;
+  ValidCtx ctx{Features{}, errors};
+  InitContext(ctx, 1);
+
+  Run("nested blocks", size_t{depth} * function_count, 5, [&]() {
+    bool valid = true;
+    for (int i = 0; i < function_count; ++i) {
+      ctx.code_count = 0;
+      valid &= BeginCode(ctx, Location{});
+      for (const auto& instr : instructions) {
+        valid &= Validate(ctx, instr);
+      }
+    }
+    return valid;
+  });
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Index scale = argc > 1 ? static_cast<Index>(atoi(argv[1])) : 1;
+  scale = std::max(scale, Index{1});
+
+  BenchExports(200000 * scale);
+  BenchElementSegment(500000 * scale);
+  BenchRefFunc(500000 * scale, 2000000 * scale);
+  BenchNestedBlocks(1000, 200 * scale);
+  return 0;
+}
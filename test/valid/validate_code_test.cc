@@ -18,6 +18,9 @@
 #include "test/binary/constants.h"
 #include "test/valid/test_utils.h"
 #include "wasp/base/features.h"
+#include "wasp/binary/lazy_expression.h"
+#include "wasp/binary/read.h"
+#include "wasp/binary/read/read_ctx.h"
 #include "wasp/valid/valid_ctx.h"
 #include "wasp/valid/validate.h"
 
@@ -67,3 +70,113 @@ TEST(ValidateCodeTest, Locals) {
   ValidCtx ctx{errors};
   EXPECT_TRUE(Validate(ctx, Locals{10, VT_I32}, RequireDefaultable::Yes));
 }
+
+namespace {
+
+// Validates `body` as the body of a function of type [] -> [] with one i32
+// local, in a module with a memory, a mutable i32 global, an immutable i64
+// global and a function of type [i32] -> [i32].
+ExpressionResult ValidateBody(SpanU8 body, bool fused, TestErrors& errors) {
+  ValidCtx ctx{errors};
+  ctx.types.push_back(DefinedType{FunctionType{}});
+  ctx.types.push_back(DefinedType{FunctionType{{VT_I32}, {VT_I32}}});
+  ctx.defined_type_count = 2;
+  ctx.same_types.Reset(2);
+  ctx.match_types.Reset(2);
+  ctx.functions.push_back(Function{0});
+  ctx.functions.push_back(Function{1});
+  ctx.memories.push_back(MemoryType{Limits{1}});
+  ctx.globals.push_back(GlobalType{VT_I32, Mutability::Var});
+  ctx.globals.push_back(GlobalType{VT_I64, Mutability::Const});
+  EXPECT_TRUE(BeginCode(ctx, Location{}));
+  EXPECT_TRUE(Validate(ctx, Locals{1, VT_I32}, RequireDefaultable::Yes));
+
+  ReadCtx read_ctx{Features{}, errors};
+  if (fused) {
+    return ReadAndValidateExpression(ctx, read_ctx, body);
+  }
+  for (auto&& instr : ReadExpression(body, read_ctx)) {
+    if (!Validate(ctx, instr)) {
+      return ExpressionResult::Invalid;
+    }
+  }
+  // A read error ends the body early without a validation error.
+  return EndCode(body.last(0), read_ctx) && !errors.HasError()
+             ? ExpressionResult::Valid
+             : ExpressionResult::ReadError;
+}
+
+}  // namespace
+
+TEST(ValidateCodeTest, ReadAndValidateExpression) {
+  // i32.const 1  local.set 0  local.get 0  i32.load  call 1  drop
+  // block (result i32) i32.const 0 end  if nop else nop end
+  // global.get 0  global.set 0  i64.const 5  drop  f32.const 1  drop
+  // f64.const 0  drop  i32.const 0  i32.const 0  i32.store
+  // block block local.get 0 br_table 0 1 1 nop... end end
+  // memory.size  drop  unreachable  select  drop  return  end
+  const SpanU8 body =
+      "\x41\x01\x21\x00\x20\x00\x28\x02\x00\x10\x01\x1a"
+      "\x02\x7f\x41\x00\x0b\x04\x40\x01\x05\x01\x0b"
+      "\x23\x00\x24\x00\x42\x05\x1a\x43\x00\x00\x80\x3f\x1a"
+      "\x44\x00\x00\x00\x00\x00\x00\x00\x00\x1a\x41\x00\x41\x00\x36\x02\x00"
+      "\x02\x40\x02\x40\x20\x00\x0e\x02\x00\x01\x01"
+      "\x01\x01\x01\x01\x01\x01\x01\x01\x0b\x0b"
+      "\x3f\x00\x1a\x00\x1b\x1a\x0f\x0b"_su8;
+
+  for (bool fused : {false, true}) {
+    TestErrors errors;
+    EXPECT_EQ(ExpressionResult::Valid, ValidateBody(body, fused, errors));
+    wasp::test::ExpectNoErrors(errors);
+  }
+}
+
+TEST(ValidateCodeTest, ReadAndValidateExpression_SameErrors) {
+  const SpanU8 bodies[] = {
+      // i32.const 0  i32.load align=8
+      "\x41\x00\x28\x03\x00\x1a\x0b"_su8,
+      // i32.const 0  i64.const 0  i64.store align=16
+      "\x41\x00\x42\x00\x37\x04\x00\x0b"_su8,
+      // local.get 5
+      "\x20\x05\x1a\x0b"_su8,
+      // i64.const 0  local.set 0
+      "\x42\x00\x21\x00\x0b"_su8,
+      // i64.const 0  global.set 1
+      "\x42\x00\x24\x01\x0b"_su8,
+      // br 2
+      "\x0c\x02\x0b"_su8,
+      // call 2
+      "\x10\x02\x0b"_su8,
+      // block (result i64) i32.const 0 end
+      "\x02\x7e\x41\x00\x0b\x1a\x0b"_su8,
+      // i64.const 0  if
+      "\x42\x00\x04\x40\x0b\x0b"_su8,
+      // else
+      "\x05\x0b"_su8,
+      // block local.get 0 br_table 0 5 0 nop... end
+      "\x02\x40\x20\x00\x0e\x02\x00\x05\x00"
+      "\x01\x01\x01\x01\x01\x01\x01\x01\x0b\x0b"_su8,
+      // block (result i32) block local.get 0 br_table 0 1 nop... end end
+      "\x02\x7f\x02\x40\x20\x00\x0e\x01\x00\x01"
+      "\x01\x01\x01\x01\x01\x01\x01\x01\x0b\x0b\x1a\x0b"_su8,
+      // local.get 0  br_table 0 5, too close to the end to read quickly.
+      "\x20\x00\x0e\x01\x00\x05\x0b"_su8,
+      // end  nop
+      "\x0b\x01"_su8,
+      // block nop
+      "\x02\x40\x01"_su8,
+      // block  i32.const <truncated>
+      "\x02\x40\x41"_su8,
+      // memory.grow
+      "\x40\x00\x0b"_su8,
+  };
+
+  for (SpanU8 body : bodies) {
+    TestErrors expected_errors, actual_errors;
+    auto expected = ValidateBody(body, false, expected_errors);
+    auto actual = ValidateBody(body, true, actual_errors);
+    EXPECT_EQ(expected, actual);
+    EXPECT_TRUE(expected_errors.HasError());
+    ExpectSameErrors(expected_errors, actual_errors);
+  }
+}
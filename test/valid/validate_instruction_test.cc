@@ -287,6 +287,34 @@ TEST_F(ValidateInstructionTest, Block_Param) {
               errors);
 }
 
+TEST_F(ValidateInstructionTest, Block_LabelTypes) {
+  auto index = AddFunctionType(FunctionType{{VT_I32}, {VT_I32, VT_F32}});
+  // The function label has no types.
+  EXPECT_EQ(0u, ctx.label_types.size());
+
+  Ok(I{O::Block, BT_I32});
+  EXPECT_EQ(1u, ctx.label_types.size());
+
+  Ok(I{O::I32Const, s32{}});
+  Ok(I{O::Block, BlockType(index)});
+  EXPECT_EQ(4u, ctx.label_types.size());
+  const auto& label = ctx.label_stack.back();
+  EXPECT_EQ((StackTypeList{ST::I32()}), ctx.GetParamTypes(label));
+  EXPECT_EQ((StackTypeList{ST::I32(), ST::F32()}), ctx.GetResultTypes(label));
+  EXPECT_EQ((StackTypeList{ST::I32(), ST::F32()}), ctx.GetBrTypes(label));
+
+  Ok(I{O::F32Const, f32{}});
+  Ok(I{O::End});
+  EXPECT_EQ(1u, ctx.label_types.size());
+  EXPECT_EQ((StackTypeList{ST::I32()}),
+            ctx.GetResultTypes(ctx.label_stack.back()));
+
+  Ok(I{O::Drop});
+  Ok(I{O::End});
+  EXPECT_EQ(0u, ctx.label_types.size());
+  ExpectNoErrors(errors);
+}
+
 TEST_F(ValidateInstructionTest, Loop_Void) {
   Ok(I{O::Loop, BT_Void});
   Ok(I{O::End});
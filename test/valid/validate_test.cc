@@ -22,6 +22,7 @@
 #include "wasp/binary/formatters.h"
 #include "wasp/valid/valid_ctx.h"
 #include "wasp/valid/validate.h"
+#include "wasp/valid/validation_snapshot.h"
 
 using namespace ::wasp;
 using namespace ::wasp::binary;
@@ -1323,6 +1324,28 @@ TEST(ValidateTest, Module) {
   EXPECT_TRUE(Validate(ctx, module));
 }
 
+TEST(ValidateTest, Module_SnapshotWithoutLocations) {
+  TestErrors errors;
+  Module module;
+  module.types.push_back(DefinedType{FunctionType{}});
+  module.functions.push_back(Function{Index{0}});
+  module.codes.push_back(UnpackedCode{
+      LocalsList{},
+      UnpackedExpression{InstructionList{Instruction{Opcode::End}}}});
+
+  // The module has no locations, so it can't be hashed and nothing is
+  // skipped.
+  ValidationSnapshot snapshot;
+  for (int i = 0; i < 2; ++i) {
+    ValidCtx ctx{errors};
+    EXPECT_TRUE(Validate(ctx, module, snapshot));
+    EXPECT_FALSE(snapshot.context_hash.has_value());
+    EXPECT_TRUE(snapshot.context_valid);
+    ASSERT_EQ(1u, snapshot.codes.size());
+    EXPECT_TRUE(snapshot.codes[0].valid);
+  }
+}
+
 TEST(ValidateTest, TypeIndexOOBAfterTypeSection) {
   TestErrors errors;
   ValidCtx ctx{errors};
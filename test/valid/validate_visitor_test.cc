@@ -0,0 +1,319 @@
+//
+// Copyright 2020 WebAssembly Community Group participants
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "gtest/gtest.h"
+#include "test/valid/test_utils.h"
+#include "wasp/base/features.h"
+#include "wasp/binary/lazy_module.h"
+#include "wasp/binary/packed_expression.h"
+#include "wasp/binary/read.h"
+#include "wasp/binary/read/read_ctx.h"
+#include "wasp/binary/visitor.h"
+#include "wasp/valid/valid_ctx.h"
+#include "wasp/valid/validate_visitor.h"
+#include "wasp/valid/validation_snapshot.h"
+
+using namespace ::wasp;
+using namespace ::wasp::binary;
+using namespace ::wasp::valid;
+using namespace ::wasp::valid::test;
+
+namespace {
+
+bool ValidateModule(SpanU8 data,
+                    Index thread_count,
+                    TestErrors& errors,
+                    bool fused = false) {
+  Features features;
+  auto module = ReadLazyModule(data, features, errors);
+  ValidateVisitor visitor{features, errors, thread_count};
+  visitor.fused = fused;
+  return visit::Visit(module, visitor) == visit::Result::Ok &&
+         !errors.HasError();
+}
+
+// (module
+//   (func)
+//   (func)
+//   (func))
+const SpanU8 kValidModule =
+    "\0asm\x01\0\0\0"
+    "\x01\x04\x01\x60\x00\x00"
+    "\x03\x04\x03\x00\x00\x00"
+    "\x0a\x0a\x03"
+    "\x02\x00\x0b"
+    "\x02\x00\x0b"
+    "\x02\x00\x0b"_su8;
+
+// (module
+//   (func)
+//   (func i32.const 0)
+//   (func i32.const 1))
+const SpanU8 kInvalidModule =
+    "\0asm\x01\0\0\0"
+    "\x01\x04\x01\x60\x00\x00"
+    "\x03\x04\x03\x00\x00\x00"
+    "\x0a\x0e\x03"
+    "\x02\x00\x0b"
+    "\x04\x00\x41\x00\x0b"
+    "\x04\x00\x41\x01\x0b"_su8;
+
+// (module
+//   (func <unknown opcode 0xff>)
+//   (func i32.const 0))
+const SpanU8 kMalformedModule =
+    "\0asm\x01\0\0\0"
+    "\x01\x04\x01\x60\x00\x00"
+    "\x03\x03\x02\x00\x00"
+    "\x0a\x0a\x02"
+    "\x03\x00\xff\x0b"
+    "\x04\x00\x41\x00\x0b"_su8;
+
+}  // namespace
+
+TEST(ValidateVisitorTest, Parallel_Valid) {
+  for (Index thread_count : {1, 2, 4}) {
+    TestErrors errors;
+    EXPECT_TRUE(ValidateModule(kValidModule, thread_count, errors));
+    wasp::test::ExpectNoErrors(errors);
+  }
+}
+
+TEST(ValidateVisitorTest, Parallel_SameErrorsAsSerial) {
+  TestErrors serial_errors;
+  EXPECT_FALSE(ValidateModule(kInvalidModule, 1, serial_errors));
+  ASSERT_EQ(1u, serial_errors.errors.size());
+
+  for (Index thread_count : {2, 4}) {
+    TestErrors errors;
+    EXPECT_FALSE(ValidateModule(kInvalidModule, thread_count, errors));
+    ExpectSameErrors(serial_errors, errors);
+  }
+}
+
+TEST(ValidateVisitorTest, Fused_Valid) {
+  for (Index thread_count : {1, 2}) {
+    TestErrors errors;
+    EXPECT_TRUE(ValidateModule(kValidModule, thread_count, errors, true));
+    wasp::test::ExpectNoErrors(errors);
+  }
+}
+
+TEST(ValidateVisitorTest, Fused_SameErrors) {
+  TestErrors serial_errors;
+  EXPECT_FALSE(ValidateModule(kInvalidModule, 1, serial_errors));
+
+  for (Index thread_count : {1, 2}) {
+    TestErrors errors;
+    EXPECT_FALSE(ValidateModule(kInvalidModule, thread_count, errors, true));
+    ExpectSameErrors(serial_errors, errors);
+  }
+}
+
+TEST(ValidateVisitorTest, MalformedCode_SameErrors) {
+  // A read error ends the first body, but the second is still validated.
+  TestErrors serial_errors;
+  EXPECT_FALSE(ValidateModule(kMalformedModule, 1, serial_errors));
+  EXPECT_EQ(3u, serial_errors.errors.size());
+
+  for (bool fused : {false, true}) {
+    for (Index thread_count : {1, 2, 4}) {
+      TestErrors errors;
+      EXPECT_FALSE(
+          ValidateModule(kMalformedModule, thread_count, errors, fused));
+      ExpectSameErrors(serial_errors, errors);
+    }
+  }
+}
+
+namespace {
+
+bool ValidateModule(SpanU8 data,
+                    Features features,
+                    Index thread_count,
+                    ValidationSnapshot& snapshot,
+                    TestErrors& errors,
+                    bool fused = false) {
+  auto module = ReadLazyModule(data, features, errors);
+  ValidateVisitor visitor{features, errors, thread_count, &snapshot};
+  visitor.fused = fused;
+  return visit::Visit(module, visitor) == visit::Result::Ok &&
+         !errors.HasError();
+}
+
+// Returns a snapshot of kInvalidModule in which the second function is
+// recorded as valid, so skipping it can be observed.
+ValidationSnapshot MakeSnapshotWithValidSecondCode() {
+  ValidationSnapshot snapshot;
+  TestErrors errors;
+  // Use more than one thread so all bodies are recorded; serial validation
+  // stops at the first invalid body.
+  EXPECT_FALSE(ValidateModule(kInvalidModule, Features{}, 2, snapshot, errors));
+  EXPECT_EQ(3u, snapshot.codes.size());
+  snapshot.codes[1].valid = true;
+  return snapshot;
+}
+
+// Offset of the third function body in kInvalidModule.
+constexpr size_t kInvalidModuleThirdCodeOffset = 31;
+
+}  // namespace
+
+TEST(ValidateVisitorTest, Snapshot) {
+  for (Index thread_count : {1, 2, 4}) {
+    ValidationSnapshot snapshot;
+    TestErrors errors;
+    EXPECT_TRUE(
+        ValidateModule(kValidModule, Features{}, thread_count, snapshot, errors));
+    ASSERT_TRUE(snapshot.context_hash.has_value());
+    EXPECT_TRUE(snapshot.context_valid);
+    ASSERT_EQ(3u, snapshot.codes.size());
+    for (auto& code : snapshot.codes) {
+      EXPECT_TRUE(code.valid);
+    }
+    // Identical bodies have identical hashes.
+    EXPECT_EQ(snapshot.codes[0].hash, snapshot.codes[1].hash);
+
+    auto context_hash = *snapshot.context_hash;
+    EXPECT_TRUE(
+        ValidateModule(kValidModule, Features{}, thread_count, snapshot, errors));
+    EXPECT_EQ(context_hash, snapshot.context_hash);
+    EXPECT_EQ(3u, snapshot.codes.size());
+    wasp::test::ExpectNoErrors(errors);
+  }
+}
+
+TEST(ValidateVisitorTest, Snapshot_SkipsUnchangedCode) {
+  for (Index thread_count : {1, 2, 4}) {
+    auto snapshot = MakeSnapshotWithValidSecondCode();
+    TestErrors errors;
+    EXPECT_FALSE(ValidateModule(kInvalidModule, Features{}, thread_count,
+                                snapshot, errors));
+    // The second function is skipped, so the error is in the third.
+    ASSERT_EQ(1u, errors.errors.size());
+    ASSERT_FALSE(errors.errors[0].empty());
+    EXPECT_GE(errors.errors[0].back().loc.data(),
+              kInvalidModule.data() + kInvalidModuleThirdCodeOffset);
+    EXPECT_TRUE(snapshot.codes[1].valid);
+    EXPECT_FALSE(snapshot.codes[2].valid);
+  }
+}
+
+TEST(ValidateVisitorTest, Snapshot_ChangedCode) {
+  // (module
+  //   (func)
+  //   (func i32.const 2)
+  //   (func i32.const 1))
+  std::vector<u8> data(kInvalidModule.begin(), kInvalidModule.end());
+  data[kInvalidModuleThirdCodeOffset - 2] = 2;
+
+  auto snapshot = MakeSnapshotWithValidSecondCode();
+  TestErrors errors;
+  EXPECT_FALSE(ValidateModule(data, Features{}, 1, snapshot, errors));
+  ASSERT_EQ(1u, errors.errors.size());
+  ASSERT_FALSE(errors.errors[0].empty());
+  EXPECT_LT(errors.errors[0].back().loc.data(),
+            data.data() + kInvalidModuleThirdCodeOffset);
+}
+
+TEST(ValidateVisitorTest, Snapshot_ChangedContext) {
+  // Different features change the context hash, so nothing is skipped.
+  Features features;
+  features.enable_simd();
+  auto snapshot = MakeSnapshotWithValidSecondCode();
+  TestErrors errors;
+  EXPECT_FALSE(ValidateModule(kInvalidModule, features, 1, snapshot, errors));
+  ASSERT_EQ(1u, errors.errors.size());
+  ASSERT_FALSE(errors.errors[0].empty());
+  EXPECT_LT(errors.errors[0].back().loc.data(),
+            kInvalidModule.data() + kInvalidModuleThirdCodeOffset);
+  EXPECT_FALSE(snapshot.codes[1].valid);
+}
+
+TEST(ValidateVisitorTest, Snapshot_MalformedCode) {
+  // (module
+  //   (func nop nop))  ;; Missing the final end.
+  const SpanU8 data =
+      "\0asm\x01\0\0\0"
+      "\x01\x04\x01\x60\x00\x00"
+      "\x03\x02\x01\x00"
+      "\x0a\x05\x01"
+      "\x03\x00\x01\x01"_su8;
+
+  for (bool fused : {false, true}) {
+    for (Index thread_count : {1, 2}) {
+      ValidationSnapshot snapshot;
+      // The body must not be recorded as valid, so the second run reports
+      // the error again.
+      for (int run = 0; run < 2; ++run) {
+        TestErrors errors;
+        EXPECT_FALSE(ValidateModule(data, Features{}, thread_count, snapshot,
+                                    errors, fused));
+        EXPECT_FALSE(errors.errors.empty());
+      }
+      ASSERT_EQ(1u, snapshot.codes.size());
+      EXPECT_FALSE(snapshot.codes[0].valid);
+    }
+  }
+}
+
+TEST(ValidateVisitorTest, Snapshot_Module) {
+  // Snapshots taken by ValidateVisitor can be used when validating a
+  // binary::Module, and vice versa.
+  auto snapshot = MakeSnapshotWithValidSecondCode();
+  Features features;
+  TestErrors errors;
+  ReadCtx read_ctx{features, errors};
+  auto module = ReadModule(kInvalidModule, read_ctx);
+  ASSERT_TRUE(module.has_value());
+
+  ValidCtx ctx{features, errors};
+  EXPECT_FALSE(Validate(ctx, *module, snapshot));
+  ASSERT_EQ(1u, errors.errors.size());
+  ASSERT_FALSE(errors.errors[0].empty());
+  EXPECT_GE(errors.errors[0].back().loc.data(),
+            kInvalidModule.data() + kInvalidModuleThirdCodeOffset);
+
+  snapshot.codes[2].valid = true;
+  TestErrors visitor_errors;
+  EXPECT_TRUE(
+      ValidateModule(kInvalidModule, features, 1, snapshot, visitor_errors));
+}
+
+TEST(ValidateVisitorTest, PackedModule) {
+  // Validating a packed module reports the same errors as validating the
+  // unpacked one.
+  Features features;
+  TestErrors read_errors;
+  ReadCtx read_ctx{features, read_errors};
+  auto module = ReadModule(kInvalidModule, read_ctx);
+  ASSERT_TRUE(module.has_value());
+  auto packed = ReadPackedModule(kInvalidModule, read_ctx);
+  ASSERT_TRUE(packed.has_value());
+  wasp::test::ExpectNoErrors(read_errors);
+
+  TestErrors expected_errors, actual_errors;
+  ValidCtx expected_ctx{features, expected_errors};
+  ValidCtx actual_ctx{features, actual_errors};
+  EXPECT_FALSE(Validate(expected_ctx, *module));
+  EXPECT_FALSE(Validate(actual_ctx, *packed));
+  ExpectSameErrors(expected_errors, actual_errors);
+
+  TestErrors errors;
+  ValidCtx ctx{features, errors};
+  EXPECT_TRUE(Validate(ctx, *ReadPackedModule(kValidModule, read_ctx)));
+  wasp::test::ExpectNoErrors(errors);
+}